@@ -2,11 +2,30 @@
 # define RBTREE_HPP
 
 #include <stdexcept>
+#include <functional>
 #include "RBTreeIterator.hpp"
 #include "printMap.hpp"
 
 namespace ft
 {
+	/**
+	 * @brief rb_no_augment
+	 *
+	 * RBTree의 augment policy 기본값. 노드에 추가로 유지하는 값이 없다.
+	 *
+	 * augment policy는 서브트리 전체에서 계산되는 값(ex. interval_map의 서브트리 최대 끝점)을 노드의 value에 유지할 때 사용한다.
+	 * - enabled	: false이면 RBTree가 경로를 따라 update하는 작업 자체를 건너뛴다.
+	 * - update		: node의 두 자식이 이미 올바른 값을 가지고 있을 때 node의 값을 다시 계산한다. (nil 자식은 value == NULL)
+	 *				  tree가 가진 비교 함수 객체(value_comp)를 함께 받는다. 상태가 있는 비교 함수 객체도 tree와 같은 순서로 계산된다.
+	 * RBTree는 삽입/삭제로 바뀐 노드부터 root까지 update를 호출하고, 회전할 때는 내려간 노드와 올라간 노드 순서로 호출한다.
+	 */
+	struct rb_no_augment
+	{
+		static const bool enabled = false;
+		template <typename Node, typename Compare>
+		static void update(Node*, const Compare&) {}
+	};
+
 	/**
 	 * @brief RBTree class
 	 * map base - red black tree
@@ -63,10 +82,11 @@ namespace ft
 	 * @tparam T		value_type (pair of key and mapped_type)
 	 * @tparam Compare	A binary predicate that takes two element keys as arguments and returns a bool.
 	 * @tparam Alloc	Type of the allocator object used to define the storage allocation model.
+	 * @tparam Augment	서브트리 값을 유지하는 policy (rb_no_augment 참고)
 	 */
 	//typename NodeAlloc = std::allocator< ft::RB_TreeNode< T >
 	//typename NodeAlloc node_alloc_type
-	template < typename T, typename Compare = ft::less<T>, typename Alloc = std::allocator<T> >
+	template < typename T, typename Compare = ft::less<T>, typename Alloc = std::allocator<T>, typename Augment = ft::rb_no_augment >
 	class RBTree {
 		public :
 			/**
@@ -84,6 +104,11 @@ namespace ft
 			typedef typename ft::RBTreeIterator<T, T*, T&>	iterator;
 			typedef typename ft::RBTreeIterator<T, const T*, const T&>	const_iterator;
 			typedef typename Alloc::template rebind<node_type>::other	node_allocator_type;
+			typedef ft::three_way_traits<Compare>	three_way;
+			//find_batch에서 번갈아 진행하는 탐색의 수
+			enum { BATCH_GROUP = 16 };
+			//erase_if가 tree를 다시 만들지 정하기 전에 보는 최소 노드 수
+			enum { ERASE_IF_SAMPLE = 32 };
 			/**
 			 * @brief rebind
 			 *
@@ -101,65 +126,97 @@ namespace ft
 			 *
 			 */
 		private:
+			/**
+			 * @brief node_pool
+			 *
+			 * nil 노드와 함께 한 번에 할당되는 node 묶음(slab) 정보. _nil이 첫 멤버를 가리키므로 tree의 크기는 늘지 않는다.
+			 * - slabs		: compact/reserve로 한 번에 할당한 노드 묶음의 주소를 오름차순으로 정렬한 배열. 묶음의 첫 노드는 header로 사용한다.
+			 *			  (header->child[RIGHT] = 묶음의 끝) 정렬되어 있으므로 노드가 속한 묶음을 이분 탐색으로 찾는다.
+			 * - slab_count	: slabs에 있는 묶음의 수, slab_cap은 slabs 배열의 크기
+			 * - free		: slab 안에서 비어있는 노드의 목록. child[LEFT]로 연결한다.
+			 * - free_count	: free에 있는 노드의 수
+			 * slab 안의 노드는 하나씩 돌려줄 수 없으므로 삭제되면 free로 보내고, 새 노드는 free에서 먼저 꺼낸다.
+			 * slab은 모든 노드가 비었을 때(compact, shrink_to_fit, 소멸자) 한 번에 돌려준다.
+			 */
+			struct node_pool
+			{
+				node_type	nil;
+				node_type**	slabs;
+				size_type	slab_count;
+				size_type	slab_cap;
+				node_type*	free;
+				size_type	free_count;
+			};
+			typedef typename Alloc::template rebind<node_pool>::other	pool_allocator_type;
+			typedef typename Alloc::template rebind<node_type*>::other	slab_list_allocator_type;
+
 			/**
 			 * @brief Member variables
 			 */
 			node_type*	_root;
 			node_type*	_nil;
-			size_type	_size;
-			value_comp	_comp;
-			node_allocator_type	_node_alloc;
+			//비교 함수 객체와 node allocator는 대부분 빈 class이므로 size와 같은 자리에 저장한다. (ft::compressed_pair 참고)
+			ft::compressed_pair< value_comp, ft::compressed_pair<node_allocator_type, size_type> >	_impl;
+
+			value_comp& compare() { return (this->_impl.first()); }
+			const value_comp& compare() const { return (this->_impl.first()); }
+			node_allocator_type& node_alloc() { return (this->_impl.second().first()); }
+			const node_allocator_type& node_alloc() const { return (this->_impl.second().first()); }
+			size_type& node_count() { return (this->_impl.second().second()); }
+			const size_type& node_count() const { return (this->_impl.second().second()); }
 
 		public:
 			/**
 			 * @brief Member functions
 			 */
 			//Default constructor
-			RBTree() : _root(NULL), _nil(NULL), _size(0), _comp(value_comp()), _node_alloc(node_allocator_type())
+			//map/set이 받은 비교 함수 객체와 allocator를 그대로 저장한다.
+			explicit RBTree(const value_comp& comp = value_comp(), const allocator_type& alloc = allocator_type())
+				: _root(NULL), _nil(NULL), _impl(comp, ft::compressed_pair<node_allocator_type, size_type>(node_allocator_type(alloc), 0))
 			{
 				this->_nil = make_nil();
 				this->_root = this->_nil;
 			}
 
 			//Copy constructor
-			RBTree(const RBTree& x) : _root(NULL), _nil(NULL), _size(0), _comp(value_comp()), _node_alloc(node_allocator_type())
+			//비교 함수 객체와 allocator도 x의 것을 복사한다.
+			RBTree(const RBTree& x)
+				: _root(NULL), _nil(NULL), _impl(x.compare(), ft::compressed_pair<node_allocator_type, size_type>(x.node_alloc(), 0))
 			{
 				this->_nil = make_nil();
+				this->_root = this->_nil;
 				copy(x);
-				this->_nil->parent = get_max_value_node();
 			}
 
 			//Destructor
 			~RBTree()
 			{
 				clear();
-				_node_alloc.destroy(this->_nil);
-				_node_alloc.deallocate(this->_nil, 1);
+				release_slabs();
+				//nil 노드는 value가 생성되지 않았으므로 메모리만 돌려준다.
+				pool_allocator_type(node_alloc()).deallocate(pool(), 1);
 			}
 
 			//Assignment operator
 			RBTree& operator=(const RBTree& x)
 			{
 				if (this != &x)
+				{
+					this->compare() = x.compare();
 					copy(x);
+				}
 				return (*this);
 			}
 
+			//x의 모양과 색을 그대로 복제한다. -> 비교/회전 없이 O(n), 같은 key가 여러 개여도 그대로 복사된다.
 			void copy(const RBTree& x)
 			{
 				clear();
-				copy(x._root);
-			}
-
-			void copy(node_type* node)
-			{
-				if (node->value == NULL)
+				if (x.node_count() == 0)
 					return ;
-				insert(*node->value);
-				if (node->leftChild->value != NULL)
-					copy(node->leftChild);
-				if (node->rightChild->value != NULL)
-					copy(node->rightChild);
+				this->_root = clone(x._root, this->_nil);
+				this->node_count() = x.node_count();
+				this->_nil->set_parent(get_max_value_node());
 			}
 
 			//Iterators
@@ -167,8 +224,8 @@ namespace ft
 			node_type* get_begin() const
 			{
 				node_type* tmp = this->_root;
-				while (tmp->leftChild->value != NULL)
-					tmp = tmp->leftChild;
+				while (!tmp->child[LEFT]->is_nil())
+					tmp = tmp->child[LEFT];
 				return (tmp);
 			}
 
@@ -178,20 +235,122 @@ namespace ft
 				return (this->_nil);
 			}
 
+			//가장 큰 값을 가지는 노드. nil의 부모가 항상 가장 큰 노드를 가리키므로 O(1)이다. 비어있으면 nil
+			node_type* get_last() const
+			{
+				return (this->node_count() ? this->_nil->parent() : this->_nil);
+			}
+
+			//augment 값을 이용해 서브트리를 건너뛰며 탐색하는 컨테이너(interval_map)에서 사용한다.
+			node_type* get_root() const
+			{
+				return (this->_root);
+			}
+
 			//Capacity
 			bool empty() const
 			{
-				return (this->_size == 0);
+				return (this->node_count() == 0);
 			}
 
 			size_type size() const
 			{
-				return (this->_size);
+				return (this->node_count());
 			}
 
 			size_type max_size() const
 			{
-				return _node_alloc.max_size();
+				return node_alloc().max_size();
+			}
+
+			//allocator를 부르지 않고 가질 수 있는 노드의 수 (size + 비어있는 slab 노드)
+			size_type node_capacity() const
+			{
+				return (this->node_count() + pool()->free_count);
+			}
+
+			/**
+			 * @brief reserve
+			 *
+			 * 노드 n개를 allocator 호출 없이 가질 수 있도록 모자란 만큼을 slab 하나로 미리 할당한다.
+			 * 이후 삽입은 slab의 노드를 주소 순서대로 꺼내 쓰므로 삽입마다 allocator를 부르지 않는다.
+			 * 새 slab의 노드를 free에 연결하면서 page도 미리 만져두므로 삽입 중 page fault도 줄어든다.
+			 * clear 후에도 slab은 남는다. (vector::reserve와 같다) iterator는 무효화되지 않는다.
+			 */
+			void reserve(size_type n)
+			{
+				if (n > max_size())
+					throw(std::length_error("Error: ft::RBTree::reserve"));
+				if (n <= node_capacity())
+					return ;
+				size_type k = n - node_capacity();
+				node_type* slab = node_alloc().allocate(k + 1);
+				node_pool* p = pool();
+				try
+				{
+					add_slab(slab);
+				}
+				catch (...)
+				{
+					node_alloc().deallocate(slab, k + 1);
+					throw ;
+				}
+				slab->child[RIGHT] = slab + k + 1;
+				//앞쪽 노드가 먼저 나가도록 뒤에서부터 연결한다.
+				for (node_type* node = slab + k; node != slab; --node)
+				{
+					node->child[LEFT] = p->free;
+					p->free = node;
+				}
+				p->free_count += k;
+			}
+
+			/**
+			 * @brief shrink_to_fit
+			 *
+			 * 노드가 하나도 사용되지 않는 slab을 돌려준다. 노드를 옮기지 않으므로 iterator는 무효화되지 않는다.
+			 * 일부만 사용되는 slab은 남는다. (모두 돌려받으려면 compact로 노드를 한 곳에 모은다.)
+			 */
+			void shrink_to_fit()
+			{
+				node_pool* p = pool();
+				size_type kept = 0;
+				for (size_type i = 0; i < p->slab_count; ++i)
+				{
+					node_type* slab = p->slabs[i];
+					size_type cap = static_cast<size_type>(slab->child[RIGHT] - slab) - 1;
+					size_type unused = 0;
+					for (node_type* node = p->free; node != NULL; node = node->child[LEFT])
+						unused += in_slab(slab, node);
+					if (unused != cap)
+					{
+						//남는 묶음은 앞으로 당기므로 정렬 순서는 그대로이다.
+						p->slabs[kept++] = slab;
+						continue ;
+					}
+					for (node_type** free = &p->free; *free != NULL;)
+					{
+						if (in_slab(slab, *free))
+							*free = (*free)->child[LEFT];
+						else
+							free = &(*free)->child[LEFT];
+					}
+					p->free_count -= cap;
+					node_alloc().deallocate(slab, cap + 1);
+				}
+				p->slab_count = kept;
+			}
+
+			//Observers
+			//컨테이너의 key_comp/value_comp가 이 객체를 사용한다.
+			const value_comp& get_compare() const
+			{
+				return (compare());
+			}
+
+			allocator_type get_allocator() const
+			{
+				return (allocator_type(node_alloc()));
 			}
 
 			//Element access
@@ -251,41 +410,71 @@ namespace ft
 			 */
 			ft::pair<node_type*, bool> insert(const value_type& val, node_type* hint = NULL)
 			{
-				//val 값을 인자로 입력하여 노드를 생성한다.
-				node_type* new_node = make_node(val);
 				//노드가 삽일될 위치를 탐색한다. tree가 비어있을 경우를 대비해 초기 위치를 root로 설정한다.
 				node_type* position = this->_root;
-				//tree가 비어있을 경우, 생성한 노드(new_node)를 root로 지정한다.
-				if (this->_size == 0)
+				//tree가 비어있을 경우, val 값으로 노드를 생성해 root로 지정한다.
+				if (this->node_count() == 0)
+					return ft::make_pair(insert_root(make_node(val)), true); //새로 만든
+				//hint 바로 앞이나 뒤가 val의 자리이면 root부터 찾지 않고 바로 붙인다.
+				//single element의 경우 hint는 null
+				if (hint != NULL && !hint->is_nil())
 				{
-					this->_root = new_node;
-					this->_root->leftChild = this->_nil;
-					this->_root->rightChild = this->_nil;
-					this->_root->parent = this->_nil; //여기서 중요한 점이 root의 부모도 nil노드를 가리키게 설정
-					this->_root->color = BLACK;
-					this->_nil->parent = this->_root; //다시 nil의 부모를 root로 설정
-					this->_size++;
-					return ft::make_pair(this->_root, true); //새로 만든
+					node_type* res = check_hint(val, hint);
+					if (res != NULL)
+						return (ft::make_pair(res, res != hint));
 				}
-				//hint의 위치가 유효한지 확인한다.
-				//single element의 경우 hint는 null
-				if (hint != NULL && hint->value != NULL)
-					position = check_hint(val, hint);
-				//노드를 삽입할 위치를 탐색한다.
-				//leftchild와 rightchild에 삽입을 실패하면 false를 반환
-				ft::pair<node_type*, bool> is_valid = get_position(position, new_node);
+				//노드를 삽입할 위치(부모와 방향)를 탐색한다.
+				//같은 값이 이미 있으면 그 노드와 false를 반환 -> 노드는 위치를 찾은 후에 만들므로 실패해도 할당하지 않는다.
+				bool left = false;
+				ft::pair<node_type*, bool> is_valid = get_position(position, val, left);
 				if (is_valid.second == false)
-				{
-					_node_alloc.destroy(new_node);
-					_node_alloc.deallocate(new_node, 1);
 					return (is_valid);
-				}
 				//new_node 삽입 후 rbtree의 규칙(속성)에 따라 균형을 잡아야한다.
-				//이는 insert_case에 따라 rotate를 통해 진행한다.
-				insert_case1(new_node);
-				this->_size++;
-				this->_nil->parent = get_max_value_node();
-				return (ft::make_pair(new_node, true));
+				//이는 insert_case에 따라 rotate를 통해 진행한다. (attach)
+				return (ft::make_pair(attach(is_valid.first, make_node(val), left), true));
+			}
+
+			/**
+			 * @brief insert_equal
+			 *
+			 * multimap/multiset 에서 사용하는 삽입. insert와 달리 같은 key를 거부하지 않는다.
+			 * 같은 key가 이미 있으면 그 요소들의 가장 뒤(upper_bound 위치)에 삽입하므로 삽입 순서가 유지된다.
+			 *
+			 * hint가 있으면 hint 바로 앞에 삽입하는 것을 우선한다. (std::multimap과 같은 규칙)
+			 * - val <= *hint 이고 hint의 이전 요소 <= val 이면 hint 바로 앞
+			 * - *hint < val 이고 val <= hint의 다음 요소이면 hint 바로 뒤
+			 * - hint가 맞지 않으면 hint를 무시하고 root부터 찾는다.
+			 * 위치를 찾은 후의 재조정(insert_case)은 insert와 같다.
+			 * @param val
+			 * @param hint
+			 * @return node_type*	새로 삽입된 노드
+			 */
+			node_type* insert_equal(const value_type& val, node_type* hint = NULL)
+			{
+				node_type* new_node = make_node(val);
+				if (this->node_count() == 0)
+					return (insert_root(new_node));
+				if (hint != NULL && hint->is_nil())
+				{	//hint가 end()인 경우, 가장 큰 값 뒤에 붙일 수 있는지 확인한다.
+					node_type* max = this->_nil->parent();
+					if (!compare()(val, max->value))
+						return (attach(max, new_node, false));
+				}
+				else if (hint != NULL && !compare()(hint->value, val))
+				{
+					iterator prev(hint);
+					if (hint == get_begin() || !compare()(val, *(--prev)))
+						return (attach_before(hint, new_node));
+				}
+				else if (hint != NULL)
+				{
+					iterator next(hint);
+					if (++next == iterator(this->_nil) || !compare()(*next, val))
+						return (attach_after(hint, new_node));
+					//hint보다 뒤쪽에 들어가야 하므로 같은 key 중 가장 앞에 삽입한다.
+					return (attach_at_bound(new_node, false));
+				}
+				return (attach_at_bound(new_node, true));
 			}
 
 			/**
@@ -361,8 +550,59 @@ namespace ft
 			size_type erase(node_type* node)
 			{
 				//삭제할 노드가 nil 노드인 경우 0을 반환 -> map에서 삭제가 실패한 경우 0을 반환
-				if (node->value == NULL)
+				if (node->is_nil())
 					return (0);
+				unlink_node(node);
+				this->_nil->set_parent(get_max_value_node());
+				return (1);
+			}
+
+			/**
+			 * @brief erase_if
+			 *
+			 * pred(value)가 true인 노드를 모두 지우고 지운 수를 반환한다. pred는 노드마다 한 번씩 부른다.
+			 * erase를 반복하면 지울 때마다 최댓값 노드를 root부터 다시 찾고, 대부분을 지울 때는 재조정 회전이 노드 수만큼 일어난다.
+			 * 1. in-order로 순회하며 바로 지운다. erase는 노드를 옮겨 붙이므로 지우기 전에 구한 다음 노드는 그대로 유효하다.
+			 *    최댓값 노드(nil의 부모)는 마지막에 한 번만 찾는다.
+			 * 2. 지나온 노드의 절반 넘게 지웠다면 남은 노드는 rebuild_if로 처리한다. 남는 노드로 tree를 다시 조립하므로 회전이 없다.
+			 * 남는 노드는 옮기지 않으므로 남는 원소의 iterator/참조는 유효하다.
+			 * pred가 예외를 던지면 그때까지 지운 노드만 빠진 올바른 tree가 남는다.
+			 */
+			template <typename Predicate>
+			size_type erase_if(Predicate pred)
+			{
+				size_type removed = 0;
+				size_type visited = 0;
+				node_type* x = get_begin();
+				try
+				{
+					while (x != this->_nil && (visited < ERASE_IF_SAMPLE || removed * 2 <= visited))
+					{
+						node_type* next = next_node(x);
+						if (pred(x->value))
+						{
+							unlink_node(x);
+							++removed;
+						}
+						++visited;
+						x = next;
+					}
+				}
+				catch (...)
+				{
+					this->_nil->set_parent(get_max_value_node());
+					throw;
+				}
+				if (x != this->_nil)
+					return (removed + rebuild_if(pred, x));
+				this->_nil->set_parent(get_max_value_node());
+				return (removed);
+			}
+
+		private:
+			//erase에서 최댓값 노드(nil의 부모) 갱신을 뺀 것. node를 tree에서 떼고 재조정한 뒤 destroy한다.
+			void unlink_node(node_type* node)
+			{
 				//node의 왼쪽 서브트리에서 최댓값 / 오른쪽 서브트리에서 최솟값을 찾은 후 위치를 변경한다.
 				//기존 target위치에는 대체할 node가 들어가있다.
 				//target 노드 자체를 삭제해야 한다.
@@ -371,19 +611,21 @@ namespace ft
 				//child는 target노드의 non-nil child가 우선이다.
 				node_type* target = replace_erase_node(node);
 				node_type* child;
-				if (target->rightChild->value == NULL)
-					child = target->leftChild;
+				if (target->child[RIGHT]->is_nil())
+					child = target->child[LEFT];
 				else
-					child = target->rightChild;
+					child = target->child[RIGHT];
 
 				//1)target이 RED인 경우, 무조건 그 자식 노드들이 nil일 때만 발생한다(BLACK). target을 nil로 바꾸면 해결
 				replace_node(target, child);
-				if (target->color == BLACK)
+				//node와 자리를 바꾼 노드도 target의 조상이므로 target의 부모부터 root까지만 다시 계산하면 된다.
+				augment_path(target->parent());
+				if (target->color() == BLACK)
 				{
 					//2)target이 BLACK이고 child가 RED인 경우,
 					//target과 child의 색을 바꾸고 child의 색을 BLACK으로 바꾼다.
-					if (child->color == RED)
-						child->color = BLACK;
+					if (child->color() == RED)
+						child->set_color(BLACK);
 					else
 						delete_case1(child);
 					//3) target과 child가 모두 BLACK인 경우, child는 무조건 nil이었을 것이다.
@@ -391,64 +633,383 @@ namespace ft
 					//사실상 target노드의 두 자식은 모두 nil이다. -> child노드도 nil
 					//replace_node에서 child(nil)->parent를 상황에 맞게 설정
 				}
-				this->_size--;
-				if (target->parent->value == NULL)
+				this->node_count()--;
+				if (target->parent()->is_nil())
 					this->_root = this->_nil;
-				delete target;
-				this->_nil->parent = get_max_value_node();
-				return (1);
+				destroy_node(target);
+			}
+
+			/**
+			 * @brief rebuild_if
+			 *
+			 * erase_if에서 대부분의 노드를 지울 때 사용한다. from부터 pred가 true인 노드를 지우고, 남은 노드로 balanced tree를 다시 만든다. O(n)
+			 * compact와 같이 in-order로 방문한 노드의 child[LEFT]는 다시 읽지 않으므로, 그 자리로 남는 노드와 지울 노드를 각각 이어둔다.
+			 * from 앞의 노드는 erase_if가 이미 확인했으므로 pred 없이 남긴다.
+			 * 지울 노드는 뒤의 순회가 부모로 거쳐갈 수 있으므로 순회가 끝난 후에 destroy한다.
+			 * pred가 예외를 던지면 남은 노드를 모두 남긴 tree를 만든 후 다시 던진다.
+			 */
+			template <typename Predicate>
+			size_type rebuild_if(Predicate& pred, node_type* from)
+			{
+				node_type* keep = NULL;
+				node_type* keep_tail = NULL;
+				node_type* drop = NULL;
+				size_type kept = 0;
+				node_type* x = get_begin();
+				for (; x != from; x = next_node(x))
+					append_node(keep, keep_tail, x, kept);
+				try
+				{
+					while (x != this->_nil)
+					{
+						node_type* next = next_node(x);
+						if (pred(x->value))
+						{
+							x->child[LEFT] = drop;
+							drop = x;
+						}
+						else
+							append_node(keep, keep_tail, x, kept);
+						x = next;
+					}
+				}
+				catch (...)
+				{
+					for (; x != this->_nil; x = next_node(x))
+						append_node(keep, keep_tail, x, kept);
+					rebuild(keep, keep_tail, drop, kept);
+					throw;
+				}
+				return (rebuild(keep, keep_tail, drop, kept));
+			}
+
+			//list의 끝(tail)에 node를 child[LEFT]로 잇는다.
+			static void append_node(node_type*& head, node_type*& tail, node_type* node, size_type& count)
+			{
+				if (tail == NULL)
+					head = node;
+				else
+					tail->child[LEFT] = node;
+				tail = node;
+				++count;
+			}
+
+			//drop의 노드를 destroy하고 keep의 노드로 tree를 만든다. 지운 노드의 수를 반환한다.
+			size_type rebuild(node_type* keep, node_type* keep_tail, node_type* drop, size_type kept)
+			{
+				while (drop != NULL)
+				{
+					node_type* next = drop->child[LEFT];
+					destroy_node(drop);
+					drop = next;
+				}
+				//모든 level을 채우는 높이까지는 black, 그 아래 마지막 level만 red로 두면 모든 경로의 black 수가 같다.
+				size_type red_depth = 0;
+				while ((static_cast<size_type>(2) << red_depth) - 1 <= kept)
+					++red_depth;
+				this->_root = build_balanced(keep, kept, 0, red_depth);
+				this->_root->set_parent(this->_nil);
+				this->_nil->set_parent(kept == 0 ? this->_nil : keep_tail);
+				size_type removed = this->node_count() - kept;
+				this->node_count() = kept;
+				return (removed);
 			}
 
+			//child[LEFT]로 이어진 list의 앞에서부터 n개로 높이가 최소인 서브트리를 만들고, list를 사용한 다음 노드로 옮긴다.
+			node_type* build_balanced(node_type*& list, size_type n, size_type depth, size_type red_depth)
+			{
+				if (n == 0)
+					return (this->_nil);
+				size_type left_count = (n - 1) / 2;
+				node_type* left = build_balanced(list, left_count, depth + 1, red_depth);
+				node_type* node = list;
+				list = list->child[LEFT];
+				node->init(depth == red_depth ? RED : BLACK);
+				node->child[LEFT] = left;
+				node->child[RIGHT] = build_balanced(list, n - 1 - left_count, depth + 1, red_depth);
+				if (!left->is_nil())
+					left->set_parent(node);
+				if (!node->child[RIGHT]->is_nil())
+					node->child[RIGHT]->set_parent(node);
+				if (Augment::enabled)
+					Augment::update(node, compare());
+				return (node);
+			}
+
+		public:
+
 			void swap(RBTree& x)
 			{
 				swap(_root, x._root);
 				swap(_nil, x._nil);
-				swap(_comp, x._comp);
-				swap(_node_alloc, x._node_alloc);
-				swap(_size, x._size);
+				swap(compare(), x.compare());
+				swap(node_alloc(), x.node_alloc());
+				swap(node_count(), x.node_count());
 			}
 
-			void clear(node_type* node = NULL)
+			//모든 노드를 지운다. 비어있는 tree의 nil은 자기 자신을 부모로 가리킨다.
+			//(reverse iterator는 nil의 부모에서 올라가 rend를 찾으므로 지운 노드를 가리키게 두면 안 된다.)
+			void clear()
 			{
-				if (node == NULL)
-					node = this->_root;
-				if (node->leftChild->value != NULL)
+				if (!this->_root->is_nil())
+					destroy_subtree(this->_root);
+				this->_root = this->_nil;
+				this->_nil->set_parent(this->_nil);
+				this->node_count() = 0;
+			}
+
+			/**
+			 * @brief compact
+			 *
+			 * 모든 노드를 한 번에 할당한 연속된 메모리로 in-order 순서대로 옮긴다. tree의 모양과 색은 그대로이다.
+			 * 삽입/삭제가 오래 반복된 tree는 노드가 heap 여기저기에 흩어져 순회할 때마다 cache/TLB miss가 난다.
+			 * 옮긴 후에는 순회가 메모리를 앞에서부터 차례로 읽고, 위쪽 노드들도 적은 수의 page에 모인다.
+			 *
+			 * 1. value를 새 노드로 복사한다. 복사 중 예외가 나면 새 메모리만 돌려주고 tree는 그대로 둔다.
+			 * 2. 링크를 새 노드로 복사하고, 옛 노드의 child[LEFT]에 새 주소를 적어둔다. (in-order로 방문할 때 왼쪽 서브트리는 이미 지나왔다.)
+			 * 3. 새 노드의 부모/자식 포인터를 옛 노드에 적어둔 새 주소로 바꾸고 옛 노드를 돌려준다.
+			 * 옛 slab은 모두 비게 되므로 돌려준다. (reserve로 남겨둔 노드도 함께 없어진다.)
+			 * 모든 iterator/포인터/참조가 무효화된다. O(n)
+			 */
+			void compact()
+			{
+				size_type n = this->node_count();
+				if (n == 0)
+				{
+					release_slabs();
+					return ;
+				}
+				node_type* slab = node_alloc().allocate(n + 1);
+				node_type* block = slab + 1;
+				node_type** list = NULL;
+				size_type i = 0;
+				try
+				{
+					//옛 slab을 돌려준 후에는 실패하면 안 되므로 새 목록도 미리 할당한다.
+					list = slab_list_allocator_type(node_alloc()).allocate(1);
+					for (node_type* x = get_begin(); x != this->_nil; x = next_node(x), ++i)
+						allocator_type(node_alloc()).construct(&block[i].value, x->value);
+				}
+				catch (...)
 				{
-					clear(node->leftChild);
-					node->leftChild = this->_nil;
+					while (i > 0)
+						allocator_type(node_alloc()).destroy(&block[--i].value);
+					if (list != NULL)
+						slab_list_allocator_type(node_alloc()).deallocate(list, 1);
+					node_alloc().deallocate(slab, n + 1);
+					throw;
 				}
-				if (node->rightChild->value != NULL)
+				i = 0;
+				for (node_type* x = get_begin(); x != this->_nil; ++i)
 				{
-					clear(node->rightChild);
-					node->rightChild = this->_nil;
+					node_type* next = next_node(x);
+					block[i].init(x->color());
+					block[i].set_parent(x->parent());
+					block[i].child[LEFT] = x->child[LEFT];
+					block[i].child[RIGHT] = x->child[RIGHT];
+					x->child[LEFT] = &block[i];
+					allocator_type(node_alloc()).destroy(&x->value);
+					x = next;
 				}
-				// delete
-				if (node->value != NULL)
+				for (i = 0; i < n; ++i)
+					block[i].set_parent(forward(block[i].parent()));
+				for (i = 0; i < n; ++i)
 				{
-					if (node == this->_root)
-						this->_root = this->_nil;
-					_node_alloc.destroy(node);
-					_node_alloc.deallocate(node, 1);
-					this->_size--;
+					for (int dir = LEFT; dir <= RIGHT; ++dir)
+					{
+						node_type* old = block[i].child[dir];
+						block[i].child[dir] = forward(old);
+						if (old != this->_nil && !pooled(old))
+							node_alloc().deallocate(old, 1);
+					}
 				}
+				node_type* old_root = this->_root;
+				this->_root = forward(old_root);
+				if (!pooled(old_root))
+					node_alloc().deallocate(old_root, 1);
+				//옛 slab의 노드는 모두 비었다.
+				release_slabs();
+				slab->child[RIGHT] = block + n;
+				list[0] = slab;
+				pool()->slabs = list;
+				pool()->slab_count = 1;
+				pool()->slab_cap = 1;
+				this->_nil->set_parent(&block[n - 1]);
 			}
 
 			//Operations
-			node_type* find(value_type val) const
+			/**
+			 * @brief find
+			 *
+			 * 비교 함수 객체가 한 번에 비교할 수 있으면(three_way_traits) 노드마다 compare 한 번으로 방향과 일치 여부를 정한다.
+			 * 그렇지 않으면 lower_bound처럼 노드마다 비교 한 번으로 끝까지 내려간 뒤, 찾은 후보와 val이 같은지 마지막에 한 번 확인한다.
+			 * (예전에는 노드마다 comp(val, x) || comp(x, val) 와 방향 결정까지 최대 세 번 비교했다.)
+			 * 어느 쪽이든 다음 노드는 비교 결과를 child의 index로 사용해 분기 없이 고른다.
+			 */
+			node_type* find(const value_type& val) const
 			{
-				node_type* res = this->_root;
-				if (this->_size == 0)
+				if (three_way::enabled)
+				{
+					node_type* node = this->_root;
+					while (!node->is_nil())
+					{
+						prefetch_children(node);
+						int res = three_way::compare(compare(), val, node->value);
+						if (res == 0)
+							return (node);
+						node = node->child[res > 0];
+					}
+					return (this->_nil);
+				}
+				node_type* res = lower_bound(val);
+				if (res->is_nil() || compare()(val, res->value))
 					return (this->_nil);
-				while (res->value != NULL && (_comp(val, *res->value) || _comp(*res->value, val)))
+				return (res);
+			}
+
+			/**
+			 * @brief find_batch
+			 *
+			 * 서로 독립인 key n개를 찾아 out[i]에 노드(없으면 nil)를 쓴다.
+			 * find를 하나씩 부르면 level마다 다음 노드를 읽을 때 cache miss를 기다리게 된다.
+			 * 여기서는 BATCH_GROUP개의 탐색을 한 level씩 번갈아 진행한다.
+			 * 한 탐색이 다음 child를 정하면 그 노드를 prefetch 해두고, 나머지 탐색을 진행하는 동안 메모리 읽기가 겹쳐지게 한다. (group prefetching)
+			 * - 탐색 종료는 node == _nil 포인터 비교로 확인한다. (prefetch 직후 노드를 읽지 않기 위해)
+			 * - 노드마다 lower_bound처럼 비교 한 번, 끝에서 찾은 후보와 같은지 한 번 더 확인한다.
+			 *
+			 * @param keys	찾을 key 배열
+			 * @param n		key의 수
+			 * @param out	결과를 쓸 배열. node_type*로 대입할 수 있는 타입(iterator 등)이면 된다.
+			 * @param comp	comp(value, key), comp(key, value) 두 방향 비교를 제공하는 함수 객체 (map은 key와 pair를 비교하는 adapter를 넘긴다.)
+			 */
+			template <typename Key, typename Output, typename KeyCompare>
+			void find_batch(const Key* keys, size_type n, Output* out, KeyCompare comp) const
+			{
+				node_type* cur[BATCH_GROUP];
+				node_type* res[BATCH_GROUP];
+				for (size_type first = 0; first < n; first += BATCH_GROUP)
 				{
-					if (_comp(val, *res->value))
-						res = res->leftChild;
-					else
-						res = res->rightChild;
+					size_type g = (n - first < BATCH_GROUP) ? n - first : static_cast<size_type>(BATCH_GROUP);
+					const Key* key = keys + first;
+					for (size_type i = 0; i < g; ++i)
+					{
+						cur[i] = this->_root;
+						res[i] = this->_nil;
+					}
+					size_type active = g;
+					while (active)
+					{
+						active = 0;
+						for (size_type i = 0; i < g; ++i)
+						{
+							node_type* node = cur[i];
+							if (node == this->_nil)
+								continue;
+							bool right = comp(node->value, key[i]);
+							res[i] = right ? res[i] : node;
+							node = node->child[right];
+							FT_PREFETCH(node);
+							cur[i] = node;
+							active += (node != this->_nil);
+						}
+					}
+					for (size_type i = 0; i < g; ++i)
+						out[first + i] = (res[i] == this->_nil || comp(key[i], res[i]->value)) ? this->_nil : res[i];
+				}
+			}
+
+			/**
+			 * @brief finger search
+			 *
+			 * 오름차순으로 정렬된 key들을 차례로 찾을 때, 매번 root에서 시작하지 않고 이전 결과(finger)에서 시작한다.
+			 * finger에서 부모로 올라가다가, 왼쪽 자식 쪽에서 올라온 부모가 key보다 작지 않으면 멈춘다.
+			 * -> 그 부모가 lower_bound 후보가 되고, 지금 서브트리 안에서 lower_bound처럼 내려간다.
+			 * key가 finger에서 d만큼 떨어져 있으면 O(log d)만큼만 올라가고 내려오므로, 정렬된 m개의 key는 O(m log(n/m))이다.
+			 * key가 finger보다 작으면 이전 key보다 작을 수도 있으므로(정렬되지 않은 입력) root부터 찾는다. 결과는 항상 lower_bound와 같다.
+			 *
+			 * @param finger	이전 key의 lower_bound 결과. NULL이면 root부터 찾는다.
+			 * @param key		찾을 key. 이전 key보다 작지 않을 때 finger search가 된다.
+			 * @param comp		comp(value, key), comp(key, value)를 제공하는 함수 객체 (find_batch와 같다.)
+			 * @return node_type*	key의 lower_bound (없으면 nil)
+			 */
+			template <typename Key, typename KeyCompare>
+			node_type* finger_lower_bound(node_type* finger, const Key& key, KeyCompare comp) const
+			{
+				node_type* res = this->_nil;
+				node_type* node = this->_root;
+				if (finger == this->_nil)
+				{	//finger가 nil이면 모든 요소가 이전 key보다 작았다. 최댓값이 이번 key보다도 작으면 그대로 nil이다.
+					if (this->node_count() == 0 || comp(this->_nil->parent()->value, key))
+						return (this->_nil);
+				}
+				else if (finger != NULL && !comp(key, finger->value))
+				{
+					node = finger;
+					for (node_type* parent = node->parent(); parent != this->_nil; node = parent, parent = node->parent())
+					{
+						if (parent->child[LEFT] == node && !comp(parent->value, key))
+						{
+							res = parent;
+							break ;
+						}
+					}
+				}
+				while (node != this->_nil)
+				{
+					prefetch_children(node);
+					bool right = comp(node->value, key);
+					res = right ? res : node;
+					node = node->child[right];
 				}
 				return (res);
 			}
 
+			/**
+			 * @brief find_sorted_batch
+			 *
+			 * 오름차순으로 정렬된 keys[0..n)를 finger search로 찾아 out[i]에 노드(없으면 nil)를 쓴다.
+			 * 순서가 거꾸로 된 key는 root부터 다시 찾으므로 느려질 뿐 결과는 find와 같다.
+			 */
+			template <typename Key, typename Output, typename KeyCompare>
+			void find_sorted_batch(const Key* keys, size_type n, Output* out, KeyCompare comp) const
+			{
+				node_type* finger = NULL;
+				for (size_type i = 0; i < n; ++i)
+				{
+					finger = finger_lower_bound(finger, keys[i], comp);
+					out[i] = (finger == this->_nil || comp(keys[i], finger->value)) ? this->_nil : finger;
+				}
+			}
+
+			/**
+			 * @brief insert_sorted
+			 *
+			 * 오름차순으로 정렬된 범위를 삽입한다. 위치는 finger search로 찾고, 이미 있는 key는 건너뛴다. (map/set의 insert와 같다.)
+			 * 새 노드는 lower_bound 바로 앞에 붙이고, 다음 key의 finger가 된다.
+			 * finger는 항상 이전 값과 같은 노드이므로, 값이 finger보다 작으면(순서가 거꾸로 되면) finger_lower_bound가 root부터 찾는다.
+			 */
+			template <typename InputIterator>
+			void insert_sorted(InputIterator first, InputIterator last)
+			{
+				node_type* finger = NULL;
+				for (; first != last; ++first)
+				{
+					const value_type& val = *first;
+					if (this->node_count() == 0)
+					{
+						finger = insert_root(make_node(val));
+						continue ;
+					}
+					finger = finger_lower_bound(finger, val, compare());
+					if (finger != this->_nil && !compare()(val, finger->value))
+						continue ;
+					if (finger == this->_nil)
+						finger = attach(this->_nil->parent(), make_node(val), false);
+					else
+						finger = attach_before(finger, make_node(val));
+				}
+			}
+
 			/**
 			 * @brief lower_bound & upper_bound
 			 *
@@ -461,23 +1022,49 @@ namespace ft
 			 */
 
 			//val보다 크거나 같은 범위를 구하기 위함.
+			//root부터 내려가면서 val보다 작지 않은 노드를 만나면 후보로 기억하고 왼쪽으로, 작으면 오른쪽으로 간다. -> O(logN)
 			node_type* lower_bound(const value_type& val) const
 			{
-				iterator it(get_begin());
-				iterator ite(get_end());
-				while (it != ite && _comp(*it, val))
-					it++;
-				return (it.base());
+				node_type* res = this->_nil;
+				node_type* node = this->_root;
+				while (!node->is_nil())
+				{
+					//비교 결과를 자식 index로 사용한다. 후보 갱신은 조건부 대입(cmov)으로 컴파일되므로 분기가 없다.
+					prefetch_children(node);
+					bool right = compare()(node->value, val);
+					res = right ? res : node;
+					node = node->child[right];
+				}
+				return (res);
 			}
 
 			//val보다 큰 범위를 구하는 함수
 			node_type* upper_bound(const value_type& val) const
 			{
-				iterator it(get_begin());
+				node_type* res = this->_nil;
+				node_type* node = this->_root;
+				while (!node->is_nil())
+				{
+					prefetch_children(node);
+					bool right = !compare()(val, node->value);
+					res = right ? res : node;
+					node = node->child[right];
+				}
+				return (res);
+			}
+
+			//lower_bound부터 val과 같은 요소의 수를 센다. -> O(logN + k)
+			size_type count(const value_type& val) const
+			{
+				size_type n = 0;
+				iterator it(lower_bound(val));
 				iterator ite(get_end());
-				while (it != ite && !_comp(val, *it))
-					it++;
-				return (it.base());
+				while (it != ite && !compare()(val, *it))
+				{
+					++n;
+					++it;
+				}
+				return (n);
 			}
 
 			//test end print map function
@@ -487,8 +1074,8 @@ namespace ft
 			//노드의 조상노드을 반환한다.
 			node_type* get_grandparent(node_type* node) const
 			{
-				if (node != NULL && node->parent != NULL)
-					return (node->parent->parent);
+				if (node != NULL && node->parent() != NULL)
+					return (node->parent()->parent());
 				else
 					return (NULL);
 			}
@@ -499,19 +1086,20 @@ namespace ft
 				node_type* grand = get_grandparent(node);
 				if (grand == NULL)
 					return (NULL);
-				if (grand->leftChild == node->parent)
-					return (grand->rightChild);
-				else
-					return (grand->leftChild);
+				return (grand->child[!dir_of(node->parent())]);
 			}
 
 			//노드의 형제노드를 반환한다.
 			node_type* get_sibling(node_type* node) const
 			{
-				if (node == node->parent->leftChild)
-					return (node->parent->rightChild);
-				else
-					return (node->parent->leftChild);
+				return (node->parent()->child[!dir_of(node)]);
+			}
+
+			//노드가 부모의 어느 쪽 자식인지 반환한다. (LEFT / RIGHT)
+			//왼쪽/오른쪽이 대칭인 재조정 코드는 이 방향(dir)과 반대 방향(!dir)으로 한 번만 작성한다.
+			static int dir_of(const node_type* node)
+			{
+				return (node == node->parent()->child[RIGHT]);
 			}
 
 			//tree에서 가장 큰 값을 가지는 노드를 찾는다.
@@ -519,93 +1107,332 @@ namespace ft
 			node_type* get_max_value_node() const
 			{
 				node_type* tmp = _root;
-				while (tmp->rightChild->value != NULL)
-					tmp = tmp->rightChild;
+				while (!tmp->child[RIGHT]->is_nil())
+					tmp = tmp->child[RIGHT];
 				return (tmp);
 			}
 
 			//nil 노드를 만든다.
 			//아무런 값이 없는 노드, tree의 leat노드이다.
+			//nil 노드의 value는 생성하지 않는다.
 			node_type* make_nil()
 			{
-				node_type* res = _node_alloc.allocate(1);
-				_node_alloc.construct(res, node_type());
-				res->color = BLACK;
-				res->leftChild = res;
-				res->rightChild = res;
-				res->parent = res;
-				res->value = NULL;
+				node_pool* res = pool_allocator_type(node_alloc()).allocate(1);
+				res->slabs = NULL;
+				res->slab_count = 0;
+				res->slab_cap = 0;
+				res->free = NULL;
+				res->free_count = 0;
+				res->nil.init_nil();
+				return (&res->nil);
+			}
+
+			node_pool* pool() const
+			{
+				return (reinterpret_cast<node_pool*>(this->_nil));
+			}
+
+			static bool in_slab(const node_type* slab, const node_type* node)
+			{
+				std::less<const node_type*> before;
+				return (before(slab, node) && before(node, slab->child[RIGHT]));
+			}
+
+			//node가 slab 안에 있는지 확인한다. 시작 주소가 node 이하인 마지막 slab을 이분 탐색으로 찾아 그 범위만 본다. O(log slab 수)
+			bool pooled(const node_type* node) const
+			{
+				const node_pool* p = pool();
+				std::less<const node_type*> before;
+				size_type lo = 0;
+				size_type hi = p->slab_count;
+				while (lo < hi)
+				{
+					size_type mid = lo + (hi - lo) / 2;
+					if (before(node, p->slabs[mid]))
+						hi = mid;
+					else
+						lo = mid + 1;
+				}
+				return (lo != 0 && in_slab(p->slabs[lo - 1], node));
+			}
+
+			//slab을 주소 순서를 지키며 목록에 추가한다. 배열이 가득 찼으면 두 배로 늘린다.
+			//할당이 실패하면 목록은 그대로이다. slab은 reserve할 때만 추가되므로 옮기는 비용은 문제되지 않는다.
+			void add_slab(node_type* slab)
+			{
+				node_pool* p = pool();
+				slab_list_allocator_type list_alloc(node_alloc());
+				if (p->slab_count == p->slab_cap)
+				{
+					size_type cap = (p->slab_cap == 0) ? 1 : p->slab_cap * 2;
+					node_type** list = list_alloc.allocate(cap);
+					for (size_type i = 0; i < p->slab_count; ++i)
+						list[i] = p->slabs[i];
+					if (p->slabs != NULL)
+						list_alloc.deallocate(p->slabs, p->slab_cap);
+					p->slabs = list;
+					p->slab_cap = cap;
+				}
+				std::less<const node_type*> before;
+				size_type i = p->slab_count;
+				for (; i > 0 && before(slab, p->slabs[i - 1]); --i)
+					p->slabs[i] = p->slabs[i - 1];
+				p->slabs[i] = slab;
+				p->slab_count++;
+			}
+
+			//비어있는 slab 노드가 있으면 그것을 먼저 사용한다.
+			node_type* allocate_node()
+			{
+				node_pool* p = pool();
+				if (p->free == NULL)
+					return (node_alloc().allocate(1));
+				node_type* res = p->free;
+				p->free = res->child[LEFT];
+				p->free_count--;
 				return (res);
 			}
 
-			//value 값을 가지는 노드를 만든다.
+			void deallocate_node(node_type* node)
+			{
+				node_pool* p = pool();
+				if (p->slab_count != 0 && pooled(node))
+				{
+					node->child[LEFT] = p->free;
+					p->free = node;
+					p->free_count++;
+				}
+				else
+					node_alloc().deallocate(node, 1);
+			}
+
+			//slab 안의 노드가 모두 비어있을 때 호출한다.
+			void release_slabs()
+			{
+				node_pool* p = pool();
+				for (size_type i = 0; i < p->slab_count; ++i)
+				{
+					node_type* slab = p->slabs[i];
+					node_alloc().deallocate(slab, static_cast<size_type>(slab->child[RIGHT] - slab));
+				}
+				if (p->slabs != NULL)
+					slab_list_allocator_type(node_alloc()).deallocate(p->slabs, p->slab_cap);
+				p->slabs = NULL;
+				p->slab_count = 0;
+				p->slab_cap = 0;
+				p->free = NULL;
+				p->free_count = 0;
+			}
+
+			//in-order로 다음 노드. 오른쪽 자식과 부모 링크만 따라가므로 compact 중 child[LEFT]를 바꾼 노드를 지나가도 된다.
+			node_type* next_node(node_type* node) const
+			{
+				iterator it(node);
+				return ((++it).base());
+			}
+
+			//compact 중 옛 노드의 child[LEFT]에 적어둔 새 주소
+			node_type* forward(node_type* old) const
+			{
+				return (old == this->_nil ? this->_nil : old->child[LEFT]);
+			}
+
+			//value 값을 가지는 노드를 만든다. 노드와 value를 한 번에 할당하고 value만 노드 안에 생성한다.
 			//노드의 색/자식/부모는 삽입 후 tree의 속성에 맞게 재조정 후 결정한다.
 			node_type* make_node(const value_type& val)
 			{
-				node_type* res = _node_alloc.allocate(1);
-				_node_alloc.construct(res, node_type(val));
+				node_type* res = allocate_node();
+				res->init();
+				try
+				{
+					allocator_type(node_alloc()).construct(&res->value, val);
+				}
+				catch (...)
+				{
+					deallocate_node(res);
+					throw;
+				}
+				return (res);
+			}
+
+			void destroy_node(node_type* node)
+			{
+				allocator_type(node_alloc()).destroy(&node->value);
+				deallocate_node(node);
+			}
+
+			//node를 root로 하는 서브트리의 노드를 모두 destroy한다. 링크는 정리하지 않는다.
+			void destroy_subtree(node_type* node)
+			{
+				if (!node->child[LEFT]->is_nil())
+					destroy_subtree(node->child[LEFT]);
+				if (!node->child[RIGHT]->is_nil())
+					destroy_subtree(node->child[RIGHT]);
+				destroy_node(node);
+			}
+
+			//src를 root로 하는 서브트리를 복제해 parent 아래에 붙일 수 있는 서브트리를 반환한다.
+			node_type* clone(node_type* src, node_type* parent)
+			{
+				if (src->is_nil())
+					return (this->_nil);
+				node_type* res = make_node(src->value);
+				res->set_color(src->color());
+				res->set_parent(parent);
+				res->child[LEFT] = clone(src->child[LEFT], res);
+				res->child[RIGHT] = clone(src->child[RIGHT], res);
 				return (res);
 			}
 
+			//비어있는 tree에 node를 root로 넣는다.
+			node_type* insert_root(node_type* node)
+			{
+				this->_root = node;
+				this->_root->child[LEFT] = this->_nil;
+				this->_root->child[RIGHT] = this->_nil;
+				this->_root->set_parent(this->_nil); //여기서 중요한 점이 root의 부모도 nil노드를 가리키게 설정
+				this->_root->set_color(BLACK);
+				this->_nil->set_parent(this->_root); //다시 nil의 부모를 root로 설정
+				augment_path(this->_root);
+				this->node_count()++;
+				return (this->_root);
+			}
+
+			//node를 parent의 (비어있는) 왼쪽/오른쪽 자식으로 붙이고 재조정한다.
+			node_type* attach(node_type* parent, node_type* node, bool left)
+			{
+				//가장 큰 노드의 오른쪽에 붙는 경우에만 최댓값이 바뀐다. (재조정 회전은 in-order 순서를 바꾸지 않는다.)
+				node_type* max = (!left && parent == this->_nil->parent()) ? node : this->_nil->parent();
+				if (left)
+					parent->child[LEFT] = node;
+				else
+					parent->child[RIGHT] = node;
+				node->set_parent(parent);
+				node->child[LEFT] = _nil;
+				node->child[RIGHT] = _nil;
+				node->set_color(RED);
+				augment_path(node);
+				insert_case1(node);
+				this->node_count()++;
+				this->_nil->set_parent(max);
+				return (node);
+			}
+
+			//in-order 순서에서 pos 바로 앞에 node를 붙인다.
+			//pos의 왼쪽이 비어있으면 왼쪽 자식, 아니면 왼쪽 서브트리의 가장 오른쪽 노드의 오른쪽 자식
+			node_type* attach_before(node_type* pos, node_type* node)
+			{
+				if (pos->child[LEFT]->is_nil())
+					return (attach(pos, node, true));
+				pos = pos->child[LEFT];
+				while (!pos->child[RIGHT]->is_nil())
+					pos = pos->child[RIGHT];
+				return (attach(pos, node, false));
+			}
+
+			//in-order 순서에서 pos 바로 뒤에 node를 붙인다.
+			node_type* attach_after(node_type* pos, node_type* node)
+			{
+				if (pos->child[RIGHT]->is_nil())
+					return (attach(pos, node, false));
+				pos = pos->child[RIGHT];
+				while (!pos->child[LEFT]->is_nil())
+					pos = pos->child[LEFT];
+				return (attach(pos, node, true));
+			}
+
+			//같은 key를 가진 요소들의 뒤(upper == true) 또는 앞(upper == false)에 node를 붙인다.
+			node_type* attach_at_bound(node_type* node, bool upper)
+			{
+				node_type* parent = this->_root;
+				bool left = false;
+				while (true)
+				{
+					left = upper ? compare()(node->value, parent->value) : !compare()(parent->value, node->value);
+					node_type* next = left ? parent->child[LEFT] : parent->child[RIGHT];
+					if (next->is_nil())
+						break;
+					parent = next;
+				}
+				return (attach(parent, node, left));
+			}
+
 			/**
 			 * Hint 쓰는 경우. (hint가 적절한 위치인 경우)
-			 * inserted value는 hint node의 right-sub-tree로 들어간다.
-			 * 공통 조건 :  hint < inserted value 인 경우.
-			 * 1) hint가 leftChild인 경우, inserted value < hint-parent 이면, hint부터 탐색.
-			 * 2) hint가 rightChild인 경우, parent를 따라가다가 처음으로 leftChild인  d노드의 parent보다 작으면 hint부터 탐색.
+			 * - val < *hint 이고 hint의 이전 요소 < val 이면 hint 바로 앞에 붙인다.
+			 * - *hint < val 이고 val < hint의 다음 요소이면 hint 바로 뒤에 붙인다.
+			 * - val == *hint 이면 삽입하지 않는다.
+			 * 예전에는 hint의 서브트리부터 탐색했는데, val의 자리가 서브트리 밖이면 같은 key가 중복으로 삽입될 수 있었다.
+			 * @return node_type*	새로 붙인 노드, 같은 값을 가진 hint, hint가 맞지 않으면 NULL
 			 */
-			node_type* check_hint(value_type val, node_type* hint)
+			node_type* check_hint(const value_type& val, node_type* hint)
 			{
-				if (_comp(*hint->value, *_root->value) && _comp(val, *hint->value))
-					return (hint);
-				else if (_comp(*hint->value, *_root->value) && _comp(*hint->value, val))
-					return (_root);
-				else if (_comp(*_root->value, *hint->value) && _comp(val, *hint->value))
-					return (_root);
-				else if (_comp(*_root->value, *hint->value) && _comp(*hint->value, val))
-					return (hint);
+				if (compare()(val, hint->value))
+				{
+					iterator prev(hint);
+					if (hint == get_begin() || compare()(*(--prev), val))
+						return (attach_before(hint, make_node(val)));
+				}
+				else if (compare()(hint->value, val))
+				{
+					iterator next(hint);
+					if (++next == iterator(this->_nil) || compare()(val, *next))
+						return (attach_after(hint, make_node(val)));
+				}
 				else
-					return (_root);
+					return (hint);
+				return (NULL);
 			}
 
-			//노드를 삽입할 위치를 탐색하는 함수이다.
-			//make_pair로 한 쌍의 pair를 만든 후 삽입이 가능한지 true/false를 반환한다.
-			ft::pair<node_type*, bool> get_position(node_type* position, node_type* node)
+			/**
+			 * @brief prefetch_children
+			 *
+			 * 분기 없이 내려가면 다음 노드의 주소가 비교가 끝나야 정해지므로, 분기 예측으로 미리 읽어오던 효과가 사라진다.
+			 * 비교하는 동안 두 자식을 모두 미리 요청해서 메모리 대기 시간을 비교와 겹친다.
+			 */
+			static void prefetch_children(const node_type* node)
 			{
-				while (position->value != NULL)
+				FT_PREFETCH(node->child[LEFT]);
+				FT_PREFETCH(node->child[RIGHT]);
+			}
+
+			/**
+			 * @brief get_position
+			 *
+			 * position부터 내려가면서 val을 붙일 부모와 방향(left)을 찾는다.
+			 * 같은 값을 가진 노드가 있으면 그 노드와 false를 반환한다.
+			 * find와 같이 three way 비교가 가능하면 노드마다 compare 한 번,
+			 * 아니면 노드마다 비교 한 번으로 내려가면서 val보다 크지 않은 마지막 노드(prev)를 기억하고 마지막에 prev와 같은지 확인한다.
+			 */
+			ft::pair<node_type*, bool> get_position(node_type* position, const value_type& val, bool& left)
+			{
+				node_type* parent = position;
+				if (three_way::enabled)
 				{
-					if (_comp(*node->value, *position->value)) //position을 기준으로 leftchild로 들어감
+					while (!position->is_nil())
 					{
-						if (position->leftChild->value == NULL)
-						{
-							position->leftChild = node;
-							node->parent = position;
-							node->leftChild = _nil;
-							node->rightChild = _nil;
-							node->color = RED;
-							break;
-						}
-						else
-							position = position->leftChild;
+						prefetch_children(position);
+						int res = three_way::compare(compare(), val, position->value);
+						if (res == 0)
+							return (ft::make_pair(position, false));
+						parent = position;
+						left = (res < 0);
+						position = position->child[!left];
 					}
-					else if (_comp(*position->value, *node->value)) //position을 기준으로 rightchild로 들어감
-					{
-						if (position->rightChild->value == NULL)
-						{
-							position->rightChild = node;
-							node->parent = position;
-							node->leftChild = _nil;
-							node->rightChild = _nil;
-							node->color = RED;
-							break;
-						}
-						else
-							position = position->rightChild;
-					}
-					else
-						return (ft::make_pair(position, false));
+					return (ft::make_pair(parent, true));
 				}
-				return (ft::make_pair(position, true));
+				node_type* prev = NULL;
+				while (!position->is_nil())
+				{
+					parent = position;
+					prefetch_children(position);
+					left = compare()(val, position->value);
+					prev = left ? prev : position;
+					position = position->child[!left];
+				}
+				if (prev != NULL && !compare()(prev->value, val))
+					return (ft::make_pair(prev, false));
+				return (ft::make_pair(parent, true));
 			}
 
 			node_type* replace_erase_node(node_type* node)
@@ -624,74 +1451,74 @@ namespace ft
 				 */
 
 				node_type* res;
-				if (node->leftChild->value != NULL)
+				if (!node->child[LEFT]->is_nil())
 				{
-					res = node->leftChild;
-					while (res->rightChild->value != NULL)
-						res = res->rightChild;
+					res = node->child[LEFT];
+					while (!res->child[RIGHT]->is_nil())
+						res = res->child[RIGHT];
 				}
-				else if (node->rightChild->value != NULL)
+				else if (!node->child[RIGHT]->is_nil())
 				{
-					res = node->rightChild;
-					while (res->leftChild->value != NULL)
-						res = res->leftChild;
+					res = node->child[RIGHT];
+					while (!res->child[LEFT]->is_nil())
+						res = res->child[LEFT];
 				}
 				else
 					return (node);
 
-				node_type* tmp_parent = node->parent;
-				node_type* tmp_left = node->leftChild;
-				node_type* tmp_right = node->rightChild;
-				RBColor tmp_color = node->color;
+				node_type* tmp_parent = node->parent();
+				node_type* tmp_left = node->child[LEFT];
+				node_type* tmp_right = node->child[RIGHT];
+				RBColor tmp_color = node->color();
 
 				//node의 left/rightChild 설정
-				node->leftChild = res->leftChild;
-				if (res->leftChild->value != NULL)
-					res->leftChild->parent = node;
-				node->rightChild = res->rightChild;
-				if (res->rightChild->value != NULL)
-					res->rightChild->parent = node;
+				node->child[LEFT] = res->child[LEFT];
+				if (!res->child[LEFT]->is_nil())
+					res->child[LEFT]->set_parent(node);
+				node->child[RIGHT] = res->child[RIGHT];
+				if (!res->child[RIGHT]->is_nil())
+					res->child[RIGHT]->set_parent(node);
 
 				//res를 node->parent의 left/rightChild로 설정
-				if (tmp_parent->leftChild == node)
-					tmp_parent->leftChild = res;
-				else if (tmp_parent->rightChild == node)
-					tmp_parent->rightChild = res;
+				if (tmp_parent->child[LEFT] == node)
+					tmp_parent->child[LEFT] = res;
+				else if (tmp_parent->child[RIGHT] == node)
+					tmp_parent->child[RIGHT] = res;
 
 				if (res == tmp_left)
 				{
 					//res의 형제를 res의 left/rightChild로 연결
-					tmp_right->parent = res;
-					res->rightChild = tmp_right;
+					tmp_right->set_parent(res);
+					res->child[RIGHT] = tmp_right;
 					//node를 res의 left/rightChild로 연결
-					node->parent = res;
-					res->leftChild = node;
+					node->set_parent(res);
+					res->child[LEFT] = node;
 				}
 				else if (res == tmp_right)
 				{
-					tmp_left->parent = res;
-					res->leftChild = tmp_left;
-					node->parent = res;
-					res->rightChild = node;
+					tmp_left->set_parent(res);
+					res->child[LEFT] = tmp_left;
+					node->set_parent(res);
+					res->child[RIGHT] = node;
 				}
 				else
 				{
 					//res와 node가 멀리 떨어진 경우
-					tmp_left->parent = res;
-					res->leftChild = tmp_left;
-					tmp_right->parent = res;
-					res->rightChild = tmp_right;
-					node->parent = res->parent;
-					res->parent->rightChild = node;
+					tmp_left->set_parent(res);
+					res->child[LEFT] = tmp_left;
+					tmp_right->set_parent(res);
+					res->child[RIGHT] = tmp_right;
+					node->set_parent(res->parent());
+					res->parent()->child[RIGHT] = node;
 				}
 
 				//res의 parent 연결
-				res->parent = tmp_parent;
+				res->set_parent(tmp_parent);
 
-				if (res->parent->value == NULL)
+				if (res->parent()->is_nil())
 					this->_root = res;
-				node->color = res->color;
-				res->color = tmp_color;
+				node->set_color(res->color());
+				res->set_color(tmp_color);
 
 				return (node);
 			}
@@ -699,11 +1526,17 @@ namespace ft
 			void replace_node(node_type* node, node_type* child)
 			{
 				//노드의 부모가 NULL이 되는 경우를 delete_case에 오지 않게 미리 처리할 수 있다.
-				child->parent = node->parent;
-				if (node->parent->leftChild == node)
-					node->parent->leftChild = child;
-				else// if (node->parent->rightChild == node)
-					node->parent->rightChild = child;
+				child->set_parent(node->parent());
+				node->parent()->child[dir_of(node)] = child;
+			}
+
+			//node부터 root까지 augment 값을 다시 계산한다. 재조정(회전) 전에 호출해야 한다.
+			void augment_path(node_type* node)
+			{
+				if (!Augment::enabled)
+					return ;
+				for (; !node->is_nil(); node = node->parent())
+					Augment::update(node, compare());
 			}
 
 			void insert_case1(node_type* node)
@@ -712,10 +1545,10 @@ namespace ft
 				 * @brief insert_case1
 				 * 삽입된 새로운 노드가 root노드가 아닌 경우
 				 */
-				if (node->parent->value != NULL)
+				if (!node->parent()->is_nil())
 					insert_case2(node);
 				else
-					node->color = BLACK;
+					node->set_color(BLACK);
 			}
 
 			void insert_case2(node_type* node)
@@ -728,7 +1561,7 @@ namespace ft
 				 * 삽입되는 새로운 노드의 색은 항상 red
 				 */
 
-				if (node->parent->color == RED)
+				if (node->parent()->color() == RED)
 					insert_case3(node);
 			}
 
@@ -746,12 +1579,12 @@ namespace ft
 
 				node_type* uncle = get_uncle(node);
 				node_type* grand;
-				if (uncle->value != NULL && uncle->color == RED)
+				if (!uncle->is_nil() && uncle->color() == RED)
 				{
-					node->parent->color = BLACK;
-					uncle->color = BLACK;
+					node->parent()->set_color(BLACK);
+					uncle->set_color(BLACK);
 					grand = get_grandparent(node);
-					grand->color = RED;
+					grand->set_color(RED);
 					insert_case1(grand);
 				}
 				else
@@ -773,17 +1606,12 @@ namespace ft
 				 * -> 4번 속성을 만족하기 않았기 떄문
 				 */
 				// If new_node's parent is red and uncle is black,
-				node_type* grand = get_grandparent(node);
-				// new_node is parent's rightChild and parent is grand's leftChild,
-				if (node == node->parent->rightChild && node->parent == grand->leftChild)
-				{
-					rotate_left(node->parent);
-					node = node->leftChild;
-				} // new_node is parent's leftChild and parent is grand's rightChild,
-				else if (node == node->parent->leftChild && node->parent == grand->rightChild)
+				// new_node and parent are on different sides (parent is grand's child[dir]),
+				int dir = dir_of(node->parent());
+				if (dir_of(node) != dir)
 				{
-					rotate_right(node->parent);
-					node = node->rightChild;
+					rotate(node->parent(), dir);
+					node = node->child[dir];
 				}
 				insert_case5(node);
 			}
@@ -804,67 +1632,41 @@ namespace ft
 				 *
 				 */
 				node_type* grand = get_grandparent(node);
-				node->parent->color = BLACK;
-				grand->color = RED;
-				if (node == node->parent->leftChild)
-					rotate_right(grand);
-				else
-					rotate_left(grand);
+				node->parent()->set_color(BLACK);
+				grand->set_color(RED);
+				rotate(grand, !dir_of(node));
 			}
 
-/**
+			/**
 			 * @brief rotate
 			 *
 			 * rbtree의 밸런싱을 잡고 rbtree의 속성에 맞게 재조정을 하기위해 사용한다.
-			 * rotate_left, rotate_right 두 종류의 rotate가 있다.
+			 * rotate(node, LEFT)는 예전의 rotate_left, rotate(node, RIGHT)는 rotate_right이다.
+			 * node의 반대쪽(!dir) 자식이 node의 자리로 올라가고 node는 그 자식의 dir쪽 자식으로 내려간다.
 			 * rotate 후 자식노드의 변경이 생기므로 유의하자.
 			 *
 			 * @param node
+			 * @param dir	node가 내려갈 방향
 			 */
-			//child가 node의 오른쪽 자식일 경우 rotate_left를 한다.
-			void rotate_left(node_type* node)
-			{
-				node_type* child = node->rightChild;
-				node_type* parent = node->parent;
-				//node를 기준으로 왼쪽으로 회전하는 경우
-				if (child->leftChild->value != NULL)
-					child->leftChild->parent = node;
-				node->rightChild = child->leftChild;
-				node->parent = child;
-				child->leftChild = node;
-				child->parent = parent;
-				//node가 부모의 왼쪽 자식인지 오른쪽 자식인지 판단.
-				if (parent->value != NULL)
-				{
-					if (parent->leftChild == node)
-						parent->leftChild = child;
-					else
-						parent->rightChild = child;
-				}
-				else
-					this->_root = child;
-			}
-
-			//child가 node의 오른쪽 자식일 경우 rotate_left를 한다.
-			void rotate_right(node_type* node)
+			void rotate(node_type* node, int dir)
 			{
-				node_type* child = node->leftChild;
-				node_type* parent = node->parent;
-				if (child->rightChild->value != NULL)
-					child->rightChild->parent = node;
-				node->leftChild = child->rightChild;
-				node->parent = child;
-				child->rightChild = node;
-				child->parent = parent;
-				if (parent->value != NULL)
-				{
-					if (parent->rightChild == node)
-						parent->rightChild = child;
-					else
-						parent->leftChild = child;
-				}
+				node_type* child = node->child[!dir];
+				node_type* parent = node->parent();
+				node_type* inner = child->child[dir];
+				if (!inner->is_nil())
+					inner->set_parent(node);
+				node->child[!dir] = inner;
+				node->set_parent(child);
+				child->child[dir] = node;
+				child->set_parent(parent);
+				//node가 부모의 왼쪽 자식인지 오른쪽 자식인지에 따라 child를 연결한다.
+				if (!parent->is_nil())
+					parent->child[parent->child[RIGHT] == node] = child;
 				else
 					this->_root = child;
+				//node가 child의 아래로 내려갔으므로 node를 먼저 계산한다.
+				Augment::update(node, compare());
+				Augment::update(child, compare());
 			}
 
 			void delete_case1(node_type* node)
@@ -878,7 +1680,7 @@ namespace ft
 				 *
 				 * 이 경우가 아닌 경우, delete_case2로 넘어간다.
 				 */
-				if (node->parent->value != NULL)
+				if (!node->parent()->is_nil())
 					delete_case2(node);
 			}
 
@@ -899,14 +1701,11 @@ namespace ft
 				 * (red의 자식은 black이라는 속성)
 				 */
 				node_type* sibling = get_sibling(node);
-				if (sibling->color == RED)
+				if (sibling->color() == RED)
 				{
-					node->parent->color = RED;
-					sibling->color = BLACK;
-					if (node == node->parent->leftChild)
-						rotate_left(node->parent);
-					else
-						rotate_right(node->parent);
+					node->parent()->set_color(RED);
+					sibling->set_color(BLACK);
+					rotate(node->parent(), dir_of(node));
 				}
 				delete_case3(node);
 			}
@@ -950,10 +1749,10 @@ namespace ft
 				 * -> 이를 해결하기위해 delete_case1부터 시작하는 rebalancing 과정을 수행해야 한다.
 				 */
 				node_type* sibling = get_sibling(node);
-				if (node->parent->color == BLACK && sibling->color == BLACK && sibling->leftChild->color == BLACK && sibling->rightChild->color == BLACK)
+				if (node->parent()->color() == BLACK && sibling->color() == BLACK && sibling->child[LEFT]->color() == BLACK && sibling->child[RIGHT]->color() == BLACK)
 				{
-					sibling->color = RED;
-					delete_case1(node->parent);
+					sibling->set_color(RED);
+					delete_case1(node->parent());
 				}
 				else
 					delete_case4(node);
@@ -977,10 +1776,10 @@ namespace ft
 				 * @param node
 				 */
 				node_type* sibling = get_sibling(node);
-				if (node->parent->color == RED && sibling->color == BLACK && sibling->leftChild->color == BLACK && sibling->rightChild->color == BLACK)
+				if (node->parent()->color() == RED && sibling->color() == BLACK && sibling->child[LEFT]->color() == BLACK && sibling->child[RIGHT]->color() == BLACK)
 				{
-					sibling->color = RED;
-					node->parent->color = BLACK;
+					sibling->set_color(RED);
+					node->parent()->set_color(BLACK);
 				}
 				else
 					delete_case5(node);
@@ -1000,22 +1799,15 @@ namespace ft
 				 * -> delete_case6를 적용하여 해결
 				 *
 				 */
-				node_type* sibling = get_sibling(node);
+				//near: 형제 노드의 node쪽 자식, far: 형제 노드의 반대쪽 자식
+				int dir = dir_of(node);
+				node_type* sibling = node->parent()->child[!dir];
 
-				if (sibling->color == BLACK)
+				if (sibling->color() == BLACK && sibling->child[!dir]->color() == BLACK && sibling->child[dir]->color() == RED)
 				{
-					if (node == node->parent->leftChild && sibling->rightChild->color == BLACK && sibling->leftChild->color == RED)
-					{
-						sibling->color = RED;
-						sibling->leftChild->color = BLACK;
-						rotate_right(sibling);
-					}
-					else if (node == node->parent->rightChild && sibling->leftChild->color == BLACK && sibling->rightChild->color == RED)
-					{
-						sibling->color = RED;
-						sibling->rightChild->color = BLACK;
-						rotate_left(sibling);
-					}
+					sibling->set_color(RED);
+					sibling->child[dir]->set_color(BLACK);
+					rotate(sibling, !dir);
 				}
 				delete_case6(node);
 			}
@@ -1036,19 +1828,12 @@ namespace ft
 				 * 결과론적인 방법
 				 * (오른쪽) 형제는 부모의 색으로, (오른쪽) 형제의 (오른쪽) 자녀는 black으로 부모는 black으로 바꾼 후에 부모를 기준으로 (왼쪽)으로 회전하여 해결
 				 */
-				node_type* sibling = get_sibling(node);
-				sibling->color = node->parent->color;
-				node->parent->color = BLACK;
-				if (node == node->parent->leftChild)
-				{
-					sibling->rightChild->color = BLACK;
-					rotate_left(node->parent);
-				}
-				else
-				{
-					sibling->leftChild->color = BLACK;
-					rotate_right(node->parent);
-				}
+				int dir = dir_of(node);
+				node_type* sibling = node->parent()->child[!dir];
+				sibling->set_color(node->parent()->color());
+				node->parent()->set_color(BLACK);
+				sibling->child[!dir]->set_color(BLACK);
+				rotate(node->parent(), dir);
 			}
 
 			template <typename _T>
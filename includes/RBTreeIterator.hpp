@@ -36,17 +36,10 @@ namespace ft
 			 */
 			//Default constructor
 			RBTreeIterator(node_type* ptr = NULL) : _node(ptr) {}
-			//Copy constructor
-			RBTreeIterator(const RBTreeIterator<T>& copy) : _node(copy.base()) {}
-			//Assignment operator
-			RBTreeIterator& operator=(const RBTreeIterator& copy)
-			{
-				if (this != &copy)
-					this->_node = copy.base();
-				return (*this);
-			}
-			//Destructor
-			virtual ~RBTreeIterator() {}
+			//iterator -> const_iterator 변환
+			//template 생성자는 copy constructor가 아니므로 copy/assignment/destructor는 compiler가 만든 trivial한 것을 쓴다.
+			template <typename U>
+			RBTreeIterator(const RBTreeIterator<U, U*, U&>& copy) : _node(copy.base()) {}
 			//Getter
 			node_type* const &base() const
 			{
@@ -58,31 +51,31 @@ namespace ft
 			 */
 			reference operator*() const
 			{
-				return (*this->_node->value);
+				return (this->_node->value);
 			}
 			pointer operator->() const
 			{
-				return (this->_node->value);
+				return (&this->_node->value);
 			}
 
 			RBTreeIterator& operator++()
 			{
 				node_type* tmp = NULL;
-				if (_node->rightChild->value != NULL)
+				if (!_node->child[RIGHT]->is_nil())
 				{	// if rightChild exists,
-					tmp = _node->rightChild;
+					tmp = _node->child[RIGHT];
 					// search the leftmost of the rightChild.
-					while (tmp->leftChild->value != NULL)
-						tmp = tmp->leftChild;
+					while (!tmp->child[LEFT]->is_nil())
+						tmp = tmp->child[LEFT];
 				}
 				else
 				{	// if rightChild doesn't exist,
-					tmp = _node->parent;
-					if (tmp->rightChild == _node)
+					tmp = _node->parent();
+					if (tmp->child[RIGHT] == _node)
 					{	// if current node is rightChild,
-						while (tmp->parent->rightChild == tmp)
-							tmp = tmp->parent;
-						tmp = tmp->parent;
+						while (tmp->parent()->child[RIGHT] == tmp)
+							tmp = tmp->parent();
+						tmp = tmp->parent();
 					}
 				}
 				_node = tmp;
@@ -99,23 +92,23 @@ namespace ft
 			RBTreeIterator& operator--()
 			{
 				node_type* tmp = NULL;
-				if (_node->value == NULL)
-					tmp = _node->parent;
-				else if (_node->leftChild->value != NULL)
+				if (_node->is_nil())
+					tmp = _node->parent();
+				else if (!_node->child[LEFT]->is_nil())
 				{	// if leftChild exists,
-					tmp = _node->leftChild;
+					tmp = _node->child[LEFT];
 					// search the rightmost of the leftChild.
-					while (tmp->rightChild->value != NULL)
-						tmp = tmp->rightChild;
+					while (!tmp->child[RIGHT]->is_nil())
+						tmp = tmp->child[RIGHT];
 				}
 				else
 				{	// if leftChild doesn't exist,
-					tmp = _node->parent;
-					if (tmp->leftChild == _node)
+					tmp = _node->parent();
+					if (tmp->child[LEFT] == _node)
 					{	// if current node is leftChild,
-						while (tmp->parent->leftChild == tmp)
-							tmp = tmp->parent;
-						tmp = tmp->parent;
+						while (tmp->parent()->child[LEFT] == tmp)
+							tmp = tmp->parent();
+						tmp = tmp->parent();
 					}
 				}
 				_node = tmp;
@@ -144,6 +137,131 @@ namespace ft
 
 
 	};
+
+	/**
+	 * @brief Red Black Tree Reverse Iterator
+	 *
+	 * tree 컨테이너의 reverse_iterator
+	 * ft::reverse_iterator는 base의 다음 위치를 들고 있다가 *, -> 할 때마다 복사본을 --해서 참조한다.
+	 * RBTreeIterator의 --는 부모 방향으로 root까지 올라갈 수 있으므로 *rit, rit->second만 해도 원소마다 tree를 여러 번 탐색하게 된다.
+	 * 이 iterator는 지금 가리키는 원소의 노드를 직접 들고 있어서 *, ->는 노드를 바로 읽고, ++/--에서만 tree를 이동한다.
+	 * rend()는 nil 노드를 가리킨다.
+	 *
+	 * base()는 std::reverse_iterator처럼 가리키는 원소의 다음 위치(정방향 iterator)를 돌려준다.
+	 */
+	template <typename T, typename Pointer = T*, typename Reference = T&>
+	class RBTreeReverseIterator
+	{
+		public :
+			typedef ft::RBTreeIterator<T, Pointer, Reference>	iterator_type;
+			typedef typename iterator_type::value_type		value_type;
+			typedef typename iterator_type::pointer			pointer;
+			typedef typename iterator_type::reference		reference;
+			typedef typename iterator_type::difference_type	difference_type;
+			typedef typename iterator_type::iterator_category	iterator_category;
+			typedef ft::RBTreeNode<T> node_type;
+		protected :
+			node_type* _node;
+
+		public:
+			//Default constructor, 노드를 직접 가리킨다. (컨테이너의 rbegin, rend에서 사용)
+			RBTreeReverseIterator(node_type* ptr = NULL) : _node(ptr) {}
+			//정방향 iterator it의 바로 앞 원소를 가리킨다. (std::reverse_iterator(it)와 같은 위치)
+			explicit RBTreeReverseIterator(iterator_type it) : _node((--it).base()) {}
+			//reverse_iterator -> const_reverse_iterator 변환
+			template <typename U>
+			RBTreeReverseIterator(const RBTreeReverseIterator<U, U*, U&>& copy) : _node(copy.node()) {}
+
+			node_type* const &node() const
+			{
+				return (this->_node);
+			}
+
+			iterator_type base() const
+			{
+				if (_node->is_nil())
+					return (iterator_type(leftmost(_node)));
+				iterator_type it(_node);
+				return (++it);
+			}
+
+			/**
+			 * @brief Operators
+			 */
+			reference operator*() const
+			{
+				return (this->_node->value);
+			}
+			pointer operator->() const
+			{
+				return (&this->_node->value);
+			}
+
+			//앞 원소로 이동한다. 가장 작은 원소 다음은 nil(rend)이다.
+			RBTreeReverseIterator& operator++()
+			{
+				iterator_type it(_node);
+				_node = (--it).base();
+				return (*this);
+			}
+
+			RBTreeReverseIterator operator++(int)
+			{
+				RBTreeReverseIterator tmp = *this;
+				++(*this);
+				return (tmp);
+			}
+
+			//뒤 원소로 이동한다. rend(nil)에서는 가장 작은 원소로 간다.
+			RBTreeReverseIterator& operator--()
+			{
+				if (_node->is_nil())
+					_node = leftmost(_node);
+				else
+				{
+					iterator_type it(_node);
+					_node = (++it).base();
+				}
+				return (*this);
+			}
+
+			RBTreeReverseIterator operator--(int)
+			{
+				RBTreeReverseIterator tmp = *this;
+				--(*this);
+				return (tmp);
+			}
+
+		private :
+			//nil의 부모(가장 큰 원소)에서 root까지 올라간 후 가장 왼쪽 노드를 찾는다. 비어있으면 nil
+			static node_type* leftmost(node_type* nil)
+			{
+				node_type* tmp = nil->parent();
+				if (tmp->is_nil())
+					return (nil);
+				while (!tmp->parent()->is_nil())
+					tmp = tmp->parent();
+				while (!tmp->child[LEFT]->is_nil())
+					tmp = tmp->child[LEFT];
+				return (tmp);
+			}
+	};
+
+	/**
+	 * @brief Relational operators
+	 * reverse_iterator와 const_reverse_iterator를 섞어서 비교할 수 있도록 non-member template으로 둔다.
+	 */
+	template <typename T, typename P1, typename R1, typename P2, typename R2>
+	bool operator==(const RBTreeReverseIterator<T, P1, R1>& lhs, const RBTreeReverseIterator<T, P2, R2>& rhs)
+	{
+		return (lhs.node() == rhs.node());
+	}
+
+	template <typename T, typename P1, typename R1, typename P2, typename R2>
+	bool operator!=(const RBTreeReverseIterator<T, P1, R1>& lhs, const RBTreeReverseIterator<T, P2, R2>& rhs)
+	{
+		return (lhs.node() != rhs.node());
+	}
 } // namespace ft
 
 #endif
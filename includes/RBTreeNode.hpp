@@ -2,6 +2,7 @@
 # define RBTREENODE_HPP
 
 #include <memory>
+#include <cstddef>
 
 /**
  * @brief Red-Black Tree Node
@@ -9,66 +10,81 @@
  * Node에 필요한 요소
  * value
  * parent
- * left child
- * right child
+ * child[LEFT], child[RIGHT]
  * color
+ *
+ * 자식을 leftChild/rightChild 두 멤버가 아닌 배열로 둔다.
+ * 탐색할 때 비교 결과(bool)를 그대로 index로 사용해 node = node->child[comp(x, val)] 처럼 분기 없이 내려갈 수 있다.
+ *
+ * 노드는 포인터 3개와 value로만 이루어진다. (pair<long, long>이면 40 byte로 cache line 하나에 들어간다.)
+ * - 노드는 포인터 크기로 정렬되므로 parent 주소의 하위 2bit는 항상 0이다. 이 자리에 color와 nil 여부를 저장한다.
+ * - value는 따로 할당하지 않고 노드 안에 둔다. 노드와 value를 한 번에 할당하고, 읽을 때도 포인터를 한 번 덜 따라간다.
+ * - allocator는 노드마다 들고 있지 않고 RBTree가 하나만 가진다.
+ *
+ * 노드는 생성자로 만들지 않는다. RBTree가 메모리를 할당한 후 init/init_nil로 링크를 설정하고 value만 allocator로 생성한다.
+ * nil 노드의 value는 생성되지 않으므로 읽으면 안 된다. (is_nil()로 확인)
  */
 namespace ft
 {
 	enum RBColor { RED = false, BLACK = true };
+	enum RBDir { LEFT = 0, RIGHT = 1 };
 
-	template < typename T, typename Alloc = std::allocator<T> >
+	template < typename T >
 	struct RBTreeNode {
 	public :
 		typedef T	value_type;
 		typedef RBTreeNode*	node;
 
-		value_type*	value;
-		node	parent;
-		node	leftChild;
-		node	rightChild;
-		RBColor	color;
-		Alloc	alloc;
+	private :
+		static const size_t	COLOR_BIT = 1;
+		static const size_t	NIL_BIT = 2;
+		static const size_t	FLAG_MASK = COLOR_BIT | NIL_BIT;
+
+		size_t	_parent;
+
+	public :
+		node	child[2];
+		value_type	value;
 
-		//default
-		RBTreeNode() : value(NULL), parent(NULL), leftChild(NULL), rightChild(NULL), color(BLACK), alloc(Alloc()) {}
+		//값을 가지는 노드의 링크를 초기화한다. 새로 삽입되는 노드는 red
+		void init(RBColor c = RED)
+		{
+			_parent = static_cast<size_t>(c);
+			child[LEFT] = NULL;
+			child[RIGHT] = NULL;
+		}
+
+		//nil 노드는 black이고 부모와 자식이 자기 자신을 가리킨다.
+		void init_nil()
+		{
+			_parent = reinterpret_cast<size_t>(this) | NIL_BIT | BLACK;
+			child[LEFT] = this;
+			child[RIGHT] = this;
+		}
 
-		//initialization
-		RBTreeNode(const T& val) : value(NULL), parent(NULL), leftChild(NULL), rightChild(NULL), color(RED), alloc(Alloc())
+		node parent() const
 		{
-			value = alloc.allocate(1);
-			alloc.construct(value, val);
+			return (reinterpret_cast<node>(_parent & ~FLAG_MASK));
 		}
 
-		//copy
-		RBTreeNode(const RBTreeNode& copy) : value(NULL), parent(NULL), leftChild(NULL), rightChild(NULL), color(RED), alloc(Alloc())
+		void set_parent(node p)
 		{
-			if (copy.value != NULL)
-			{
-				value = alloc.allocate(1);
-				alloc.construct(value, *copy.value);
-				color = copy.color;
-			}
+			_parent = reinterpret_cast<size_t>(p) | (_parent & FLAG_MASK);
 		}
 
-		//destruct
-		~RBTreeNode()
+		RBColor color() const
 		{
-			if (value != NULL)
-			{
-				alloc.destroy(value);
-				alloc.deallocate(value, 1);
-			}
+			return (static_cast<RBColor>(_parent & COLOR_BIT));
 		}
 
-		bool operator==(const RBTreeNode& node) const
+		void set_color(RBColor c)
 		{
-			return (*this->value == *node->value);
+			_parent = (_parent & ~COLOR_BIT) | static_cast<size_t>(c);
 		}
 
-		bool operator!=(const RBTreeNode& node) const
+		bool is_nil() const
 		{
-			return (*this->value != *node->value);
+			return ((_parent & NIL_BIT) != 0);
 		}
 	};
 } // namespace ft
@@ -31,14 +31,9 @@ namespace ft
 		public:
 		VectorIterator(pointer ptr = NULL) : _ptr(ptr) {} //default constructor
 
-		VectorIterator(const VectorIterator<T> &other) : _ptr(other.base()) {} // copy constructor
-
-		VectorIterator &operator=(const VectorIterator<T> &other) //assignment operator
-		{
-			if (this != &other)
-				this->_ptr = other.base();
-			return (*this);
-		}
+		//copy constructor, assignment operator, destructor는 compiler가 만든 것을 그대로 쓴다.
+		//직접 정의하거나 virtual 소멸자를 두면 trivially copyable이 아니게 되고 vptr 때문에 포인터 두 개 크기가 되어
+		//포인터 루프처럼 register에 두거나 vectorize 할 수 없다.
 
 		operator VectorIterator<const T>() const //overloading type casting
 		{
@@ -50,8 +45,6 @@ namespace ft
 			return (this->_ptr);
 		}
 
-		virtual ~VectorIterator() {} // destructor
-
 		/**
 		 * @brief operator
 		 */
@@ -212,6 +205,15 @@ namespace ft
 	{
 		return (lhs.base() - rhs.base());
 	}
+
+	//VectorIterator는 vector의 연속된 메모리를 가리킨다. (ft::contiguous_iterator 참고)
+	template <typename T>
+	struct contiguous_iterator< ft::VectorIterator<T> >
+	{
+		static const bool value = true;
+		typedef T value_type;
+		static T* address(const ft::VectorIterator<T>& it) { return (it.base()); }
+	};
 };
 
 #endif
@@ -0,0 +1,355 @@
+#ifndef INTERVAL_MAP_HPP
+# define INTERVAL_MAP_HPP
+
+#include "RBTree.hpp"
+
+namespace ft
+{
+	template <class Key, class T, class Compare>
+	struct interval_augment;
+
+	/**
+	 * @brief interval_entry
+	 *
+	 * interval_map의 요소. map의 pair<key, value>처럼 사용할 수 있다.
+	 * first			: 구간 [first.first, first.second)
+	 * second			: mapped value
+	 * max_end()		: 이 노드를 root로 하는 서브트리에서 가장 큰 끝점
+	 *				  interval_augment만 바꿀 수 있다. 사용자가 바꾸면 질의가 서브트리를 잘못 건너뛰므로 읽기만 허용한다.
+	 */
+	template <class Key, class T>
+	struct interval_entry : public ft::pair<const ft::pair<Key, Key>, T>
+	{
+		typedef ft::pair<const ft::pair<Key, Key>, T>	base_type;
+
+		interval_entry() : base_type(), _max_end() {}
+		interval_entry(const ft::pair<Key, Key>& interval, const T& val) : base_type(interval, val), _max_end(interval.second) {}
+
+		const Key& max_end() const { return (this->_max_end); }
+
+		private:
+			template <class K, class U, class C>
+			friend struct interval_augment;
+
+			Key	_max_end;
+	};
+
+	/**
+	 * @brief interval_augment
+	 *
+	 * RBTree의 augment policy. 노드의 max_end = max(자신의 끝점, 왼쪽 서브트리 max_end, 오른쪽 서브트리 max_end)
+	 * max는 tree가 저장한 비교 함수 객체로 구한다. (기본 생성한 Compare를 쓰면 상태가 있는 비교 함수 객체에서 순서가 달라진다.)
+	 */
+	template <class Key, class T, class Compare>
+	struct interval_augment
+	{
+		static const bool enabled = true;
+
+		//value_comp는 interval_map::value_compare이다. 그 안에 저장된 key 비교 함수 객체로 끝점을 비교한다.
+		template <typename Node, typename ValueCompare>
+		static void update(Node* node, const ValueCompare& value_comp)
+		{
+			const Compare& comp = value_comp.comp();
+			interval_entry<Key, T>& val = node->value;
+			val._max_end = val.first.second;
+			if (!node->child[LEFT]->is_nil() && comp(val._max_end, node->child[LEFT]->value.max_end()))
+				val._max_end = node->child[LEFT]->value.max_end();
+			if (!node->child[RIGHT]->is_nil() && comp(val._max_end, node->child[RIGHT]->value.max_end()))
+				val._max_end = node->child[RIGHT]->value.max_end();
+		}
+	};
+
+	/**
+	 * @brief interval_map class
+	 *
+	 * 반열린 구간 [start, end)를 key로 값을 저장하고, 어떤 구간과 겹치는 요소들을 빠르게 찾는 컨테이너
+	 * 예약/일정처럼 시작 시간으로 정렬된 구간에서 "[a, b)와 겹치는 것은?"을 묻는 경우에 사용한다.
+	 *
+	 * map에 시작점을 key로 저장하고 lower_bound부터 훑으면, 아주 긴 구간 하나가 앞에 있을 때 전부 확인해야 하므로 최악 O(N)이다.
+	 * interval_map은 map과 같은 RBTree를 사용하되 노드마다 서브트리의 최대 끝점(max_end)을 유지한다. (augmented red-black tree)
+	 * - 서브트리의 max_end <= a 이면 그 서브트리에는 [a, b)와 겹치는 구간이 없다.
+	 * - 노드의 시작점 >= b 이면 오른쪽 서브트리에도 겹치는 구간이 없다.
+	 * 위 두 조건으로 서브트리를 건너뛰므로 겹치는 k개를 찾는 데 O(logN + k)
+	 *
+	 * 구간은 시작점 순서로 정렬되며 시작점이 같은 구간은 삽입된 순서로 저장된다. (multimap처럼 중복 허용)
+	 *
+	 * @tparam Key		구간 끝점의 타입
+	 * @tparam T		Type of the mapped value.(mapped_type)
+	 * @tparam Compare	A binary predicate that takes two element keys as arguments and returns a bool.(key_compare)
+	 * @tparam Alloc	Type of the allocator object used to define the storage allocation model.(allocator_type)
+	 */
+	template < class Key, class T, class Compare = ft::less<Key>, class Alloc = std::allocator< ft::interval_entry<Key, T> > >
+	class interval_map {
+		public :
+			/**
+			 * @brief Member types
+			 */
+			typedef Key	key_type;
+			typedef T	mapped_type;
+			typedef ft::pair<Key, Key>	interval_type;
+			typedef ft::interval_entry<Key, T>	value_type;
+			typedef Compare	key_compare;
+
+			//시작점으로 비교한다.
+			class value_compare : binary_function<value_type, value_type, bool>, protected ft::ebo_holder<Compare>
+			{
+				friend class interval_map;
+				friend struct interval_augment<Key, T, Compare>;
+				protected:
+					//Compare가 빈 class이면 value_compare도 빈 class가 되어 RBTree에서 크기를 차지하지 않는다. (ft::ebo_holder 참고)
+					value_compare(Compare c) : ft::ebo_holder<Compare>(c) {}
+					const Compare& comp() const { return (this->get()); }
+				public:
+					value_compare() : ft::ebo_holder<Compare>() {}
+					bool operator()(const value_type& lhs, const value_type& rhs) const
+					{
+						return (comp()(lhs.first.first, rhs.first.first));
+					}
+			};
+			typedef Alloc	allocator_type;
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename ft::RBTreeIterator<value_type, value_type*, value_type&>	iterator;
+			typedef typename ft::RBTreeIterator<value_type, const value_type*, const value_type&>	const_iterator;
+			typedef ft::RBTreeReverseIterator<value_type, value_type*, value_type&>	reverse_iterator;
+			typedef ft::RBTreeReverseIterator<value_type, const value_type*, const value_type&>	const_reverse_iterator;
+			typedef typename allocator_type::difference_type	difference_type;
+			typedef typename allocator_type::size_type			size_type;
+			typedef ft::interval_augment<Key, T, Compare>		augment_type;
+			typedef ft::RBTree<value_type, value_compare, allocator_type, augment_type>	rb_tree;
+			typedef ft::RBTreeNode<value_type>					node_type;
+
+		/**
+		 * @brief Member variables
+		 */
+		private:
+			rb_tree			_tree;
+
+			//비교 함수 객체는 tree가 value_compare 안에 하나만 가진다.
+			const key_compare& comp() const
+			{
+				return (this->_tree.get_compare().comp());
+			}
+
+		public:
+			explicit interval_map (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _tree(value_compare(comp), alloc) {}
+
+			interval_map (const interval_map& x) : _tree(x._tree) {}
+
+			~interval_map() {}
+
+			//tree를 그대로 복제하므로 max_end도 다시 계산할 필요가 없다.
+			interval_map& operator=(const interval_map& x)
+			{
+				if (this != &x)
+					this->_tree = x._tree;
+				return *this;
+			}
+
+			// Iterators:
+			iterator begin()
+			{
+				return iterator(this->_tree.get_begin());
+			}
+			const_iterator begin() const
+			{
+				return const_iterator(this->_tree.get_begin());
+			}
+			iterator end()
+			{
+				return iterator(this->_tree.get_end());
+			}
+			const_iterator end() const
+			{
+				return const_iterator(this->_tree.get_end());
+			}
+			reverse_iterator rbegin()
+			{
+				return reverse_iterator(this->_tree.get_last());
+			}
+			const_reverse_iterator rbegin() const
+			{
+				return const_reverse_iterator(this->_tree.get_last());
+			}
+			reverse_iterator rend()
+			{
+				return reverse_iterator(this->_tree.get_end());
+			}
+			const_reverse_iterator rend() const
+			{
+				return const_reverse_iterator(this->_tree.get_end());
+			}
+
+			//Capacity
+			bool empty() const
+			{
+				return (this->_tree.empty());
+			}
+			size_type size() const
+			{
+				return (this->_tree.size());
+			}
+			size_type max_size() const
+			{
+				return (this->_tree.max_size());
+			}
+
+			/**
+			 * @brief insert
+			 *
+			 * [start, end) 구간에 val을 저장한다. 겹치는 구간이 있어도 항상 삽입된다.
+			 * 빈 구간(end <= start)은 어떤 구간과도 겹치지 않으므로 허용하지 않는다.
+			 */
+			iterator insert(const key_type& start, const key_type& end, const mapped_type& val = mapped_type())
+			{
+				if (!comp()(start, end))
+					throw std::invalid_argument("Error: ft::interval_map::insert");
+				return (iterator(this->_tree.insert_equal(value_type(interval_type(start, end), val))));
+			}
+
+			void erase(iterator position)
+			{
+				this->_tree.erase(position.base());
+			}
+
+			void erase(iterator first, iterator last)
+			{
+				while (first != last)
+					erase(first++);
+			}
+
+			void swap(interval_map& x)
+			{
+				this->_tree.swap(x._tree);
+			}
+
+			void clear()
+			{
+				this->_tree.clear();
+			}
+
+			//Observers
+			key_compare key_comp() const
+			{
+				return (comp());
+			}
+
+			/**
+			 * @brief overlap
+			 *
+			 * [lo, hi)와 겹치는 (start < hi && lo < end) 모든 요소의 iterator를 시작점 순서로 out에 쓴다.
+			 * const interval_map에서는 const_iterator를 쓴다.
+			 * @return OutputIterator	마지막으로 쓴 다음 위치
+			 */
+			template <class OutputIterator>
+			OutputIterator overlap(const key_type& lo, const key_type& hi, OutputIterator out)
+			{
+				collect<iterator>(this->_tree.get_root(), lo, hi, false, out);
+				return (out);
+			}
+
+			template <class OutputIterator>
+			OutputIterator overlap(const key_type& lo, const key_type& hi, OutputIterator out) const
+			{
+				collect<const_iterator>(this->_tree.get_root(), lo, hi, false, out);
+				return (out);
+			}
+
+			/**
+			 * @brief stab
+			 *
+			 * point를 포함하는 (start <= point < end) 모든 요소의 iterator를 시작점 순서로 out에 쓴다.
+			 */
+			template <class OutputIterator>
+			OutputIterator stab(const key_type& point, OutputIterator out)
+			{
+				collect<iterator>(this->_tree.get_root(), point, point, true, out);
+				return (out);
+			}
+
+			template <class OutputIterator>
+			OutputIterator stab(const key_type& point, OutputIterator out) const
+			{
+				collect<const_iterator>(this->_tree.get_root(), point, point, true, out);
+				return (out);
+			}
+
+			/**
+			 * @brief find_overlap
+			 *
+			 * [lo, hi)와 겹치는 요소 중 시작점이 가장 작은 요소를 반환한다. 없으면 end()
+			 * 빈 자리인지 확인하는 경우처럼 겹치는 요소가 있는지만 알면 될 때 O(logN)
+			 */
+			iterator find_overlap(const key_type& lo, const key_type& hi)
+			{
+				return (iterator(first_overlap(lo, hi)));
+			}
+
+			const_iterator find_overlap(const key_type& lo, const key_type& hi) const
+			{
+				return (const_iterator(first_overlap(lo, hi)));
+			}
+
+			//lo 이상인 시작점을 가진 첫 번째 요소
+			iterator lower_bound(const key_type& lo)
+			{
+				return (iterator(this->_tree.lower_bound(value_type(interval_type(lo, lo), mapped_type()))));
+			}
+
+			allocator_type get_allocator() const
+			{
+				return (this->_tree.get_allocator());
+			}
+
+		private:
+			//겹치는 요소 중 시작점이 가장 작은 노드. 없으면 end 노드
+			node_type* first_overlap(const key_type& lo, const key_type& hi) const
+			{
+				node_type* node = this->_tree.get_root();
+				while (!node->is_nil() && comp()(lo, node->value.max_end()))
+				{
+					//왼쪽 서브트리에 lo 이후에 끝나는 구간이 있다면, 겹치는 구간이 있는 경우 가장 왼쪽은 항상 왼쪽 서브트리에 있다.
+					if (!node->child[LEFT]->is_nil() && comp()(lo, node->child[LEFT]->value.max_end()))
+						node = node->child[LEFT];
+					else if (overlaps(node, lo, hi, false))
+						return (node);
+					else if (comp()(node->value.first.first, hi))
+						node = node->child[RIGHT];
+					else
+						break;
+				}
+				return (this->_tree.get_end());
+			}
+
+			//stab인 경우 [point, point] 를 포함하는 구간을 찾는다.
+			bool overlaps(node_type* node, const key_type& lo, const key_type& hi, bool stab) const
+			{
+				const interval_type& iv = node->value.first;
+				bool before_hi = stab ? !comp()(hi, iv.first) : comp()(iv.first, hi);
+				return (before_hi && comp()(lo, iv.second));
+			}
+
+			//in-order로 내려가면서 겹칠 수 없는 서브트리는 건너뛴다. Iterator는 out에 쓸 iterator 타입
+			template <class Iterator, class OutputIterator>
+			void collect(node_type* node, const key_type& lo, const key_type& hi, bool stab, OutputIterator& out) const
+			{
+				if (node->is_nil() || !comp()(lo, node->value.max_end()))
+					return ;
+				collect<Iterator>(node->child[LEFT], lo, hi, stab, out);
+				if (overlaps(node, lo, hi, stab))
+					*out++ = Iterator(node);
+				//오른쪽 서브트리의 시작점은 모두 node의 시작점 이상이다.
+				if (stab ? !comp()(hi, node->value.first.first) : comp()(node->value.first.first, hi))
+					collect<Iterator>(node->child[RIGHT], lo, hi, stab, out);
+			}
+	};
+
+	// swap
+	template <class Key, class T, class Compare, class Alloc>
+	void swap(interval_map<Key, T, Compare, Alloc>& x, interval_map<Key, T, Compare, Alloc>& y)
+	{
+		x.swap(y);
+	}
+} // namespace ft
+
+#endif
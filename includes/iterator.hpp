@@ -1,7 +1,7 @@
 #ifndef ITERATOR_HPP
 # define ITERATOR_HPP
 
-// #include <iterator>
+#include <iterator>
 #include <cstddef>
 
 /**
@@ -93,6 +93,36 @@ namespace ft
 		typedef const T& reference;
 	};
 
+	/**
+	 * @brief iterator_category_of
+	 * iterator의 category를 ft tag로 맞춘다.
+	 * std::list, std::istream_iterator 같은 std iterator는 std tag를 가지므로 ft tag로 overload된 함수를 고를 수 없다.
+	 * std tag는 같은 단계의 ft tag로 바꾸고, ft tag는 그대로 둔다.
+	 */
+	template <class Category>
+	struct iterator_tag_of { typedef Category type; };
+
+	template <>
+	struct iterator_tag_of<std::input_iterator_tag> { typedef input_iterator_tag type; };
+
+	template <>
+	struct iterator_tag_of<std::output_iterator_tag> { typedef output_iterator_tag type; };
+
+	template <>
+	struct iterator_tag_of<std::forward_iterator_tag> { typedef forward_iterator_tag type; };
+
+	template <>
+	struct iterator_tag_of<std::bidirectional_iterator_tag> { typedef bidirectional_iterator_tag type; };
+
+	template <>
+	struct iterator_tag_of<std::random_access_iterator_tag> { typedef random_access_iterator_tag type; };
+
+	template <class Iterator>
+	struct iterator_category_of
+	{
+		typedef typename iterator_tag_of<typename iterator_traits<Iterator>::iterator_category>::type	type;
+	};
+
 	/**
 	 * @brief iterator
 	 * iterator 클래스를 파생하는데 사용할 수 있는 기본 클래스 템플릿
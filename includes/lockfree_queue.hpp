@@ -0,0 +1,443 @@
+#ifndef LOCKFREE_QUEUE_HPP
+# define LOCKFREE_QUEUE_HPP
+
+#include <memory>
+#include <stdexcept>
+#include "utils.hpp"
+
+/**
+ * @brief bounded lock-free queues
+ *
+ * thread 사이에 요소를 넘겨주기 위한 고정 크기 ring buffer.
+ * mutex로 보호한 stack과 달리 lock을 잡지 않고 atomic 연산만으로 동기화한다.
+ * c++98에는 std::atomic이 없으므로 gcc/clang의 __atomic builtin을 사용한다.
+ *
+ * 공통 사항
+ * - capacity는 생성 시 2의 거듭제곱으로 올림하고, 이후 바뀌지 않는다. -> index & mask로 slot을 구한다.
+ * - 저장 공간은 생성자에서 allocator로 한 번에 allocate하고, 요소는 push 할 때 construct, pop 할 때 destroy 한다.
+ * - head/tail(index)은 계속 증가만 하는 값이고 slot은 index & mask 이다. (size_t가 한 바퀴 도는 일은 고려하지 않는다.)
+ * - 서로 다른 thread가 쓰는 index는 FT_CACHE_LINE_SIZE로 정렬된 자리에 두어 false sharing을 막는다. (FT_CACHE_ALIGNED)
+ *   정렬은 queue 객체 자체가 정렬되어 있을 때만 의미가 있다. stack/static 객체는 컴파일러가 정렬하지만
+ *   c++98의 new는 FT_CACHE_LINE_SIZE 정렬을 보장하지 않는다. (보통 16 byte) heap에 둘 때는 정렬된 메모리에 placement new로 만든다.
+ * - 복사할 수 없다.
+ */
+#ifndef FT_CACHE_LINE_SIZE
+# define FT_CACHE_LINE_SIZE 64
+#endif
+#define FT_CACHE_ALIGNED __attribute__((aligned(FT_CACHE_LINE_SIZE)))
+
+namespace ft
+{
+	namespace lockfree_detail
+	{
+		//n 이상인 가장 작은 2의 거듭제곱
+		inline size_t round_up_pow2(size_t n)
+		{
+			size_t res = 1;
+			while (res < n)
+				res <<= 1;
+			return (res);
+		}
+
+		inline void cpu_relax()
+		{
+#if defined(__i386__) || defined(__x86_64__)
+			__builtin_ia32_pause();
+#endif
+		}
+	} // namespace lockfree_detail
+
+	/**
+	 * @brief spsc_queue
+	 *
+	 * producer 한 개, consumer 한 개 전용 queue.
+	 * producer만 _tail을 쓰고 consumer만 _head를 쓰기 때문에 CAS 없이 load/store(acquire/release)만 필요하다.
+	 * 각자 상대방 index를 _cached_*에 복사해두고, 그 값으로 판단할 수 없을 때만 상대방 cache line을 읽는다.
+	 *
+	 * @tparam T		Type of the elements.
+	 * @tparam Alloc	Type of the allocator object used to define the storage allocation model.
+	 */
+	template < typename T, typename Alloc = std::allocator<T> >
+	class spsc_queue
+	{
+		public:
+			typedef T			value_type;
+			typedef Alloc		allocator_type;
+			typedef typename allocator_type::pointer	pointer;
+			typedef typename allocator_type::size_type	size_type;
+
+		private:
+			allocator_type	_alloc;
+			pointer			_buffer;
+			size_type		_mask;
+			//consumer 소유
+			size_type		_head FT_CACHE_ALIGNED;
+			size_type		_cached_tail;
+			//producer 소유. 정렬 때문에 객체 크기도 cache line의 배수가 되어 뒤에 오는 객체와 line을 나누지 않는다.
+			size_type		_tail FT_CACHE_ALIGNED;
+			size_type		_cached_head;
+
+			spsc_queue(const spsc_queue&);
+			spsc_queue& operator=(const spsc_queue&);
+
+		public:
+			explicit spsc_queue(size_type capacity, const allocator_type& alloc = allocator_type())
+			: _alloc(alloc), _buffer(NULL), _mask(0), _head(0), _cached_tail(0), _tail(0), _cached_head(0)
+			{
+				if (capacity == 0 || capacity > _alloc.max_size())
+					throw(std::length_error("Error: ft::spsc_queue"));
+				capacity = lockfree_detail::round_up_pow2(capacity);
+				this->_buffer = this->_alloc.allocate(capacity);
+				this->_mask = capacity - 1;
+			}
+
+			//소멸 시점에는 다른 thread가 접근하지 않는다고 가정한다.
+			~spsc_queue()
+			{
+				for (size_type i = this->_head; i != this->_tail; ++i)
+					this->_alloc.destroy(this->_buffer + (i & this->_mask));
+				this->_alloc.deallocate(this->_buffer, this->_mask + 1);
+			}
+
+			size_type capacity() const
+			{
+				return (this->_mask + 1);
+			}
+
+			//다른 thread가 동시에 push/pop 하고 있다면 근사값이다.
+			size_type size() const
+			{
+				size_type tail = __atomic_load_n(&this->_tail, __ATOMIC_ACQUIRE);
+				size_type head = __atomic_load_n(&this->_head, __ATOMIC_ACQUIRE);
+				return (tail - head);
+			}
+
+			bool empty() const
+			{
+				return (size() == 0);
+			}
+
+			/**
+			 * @brief producer
+			 * 가득 차 있으면 false를 반환한다.
+			 */
+			bool push(const value_type& val)
+			{
+				size_type tail = this->_tail;
+				if (tail - this->_cached_head > this->_mask)
+				{
+					this->_cached_head = __atomic_load_n(&this->_head, __ATOMIC_ACQUIRE);
+					if (tail - this->_cached_head > this->_mask)
+						return (false);
+				}
+				this->_alloc.construct(this->_buffer + (tail & this->_mask), val);
+				__atomic_store_n(&this->_tail, tail + 1, __ATOMIC_RELEASE);
+				return (true);
+			}
+
+			//[first, first + n) 중 들어갈 수 있는 만큼 넣고, 넣은 개수를 반환한다. index는 마지막에 한 번만 publish 한다.
+			template <class InputIterator>
+			size_type push_n(InputIterator first, size_type n)
+			{
+				size_type tail = this->_tail;
+				size_type free_slots = this->_mask + 1 - (tail - this->_cached_head);
+				if (free_slots < n)
+				{
+					this->_cached_head = __atomic_load_n(&this->_head, __ATOMIC_ACQUIRE);
+					free_slots = this->_mask + 1 - (tail - this->_cached_head);
+					if (free_slots < n)
+						n = free_slots;
+				}
+				//복사가 예외를 던지면 이미 만든 요소까지만 publish 한다.
+				size_type i = 0;
+				try
+				{
+					for (; i < n; ++i, ++first)
+						this->_alloc.construct(this->_buffer + ((tail + i) & this->_mask), *first);
+				}
+				catch (...)
+				{
+					if (i != 0)
+						__atomic_store_n(&this->_tail, tail + i, __ATOMIC_RELEASE);
+					throw ;
+				}
+				if (n != 0)
+					__atomic_store_n(&this->_tail, tail + n, __ATOMIC_RELEASE);
+				return (n);
+			}
+
+			/**
+			 * @brief consumer
+			 * 비어 있으면 false를 반환한다.
+			 */
+			bool pop(value_type& out)
+			{
+				size_type head = this->_head;
+				if (head == this->_cached_tail)
+				{
+					this->_cached_tail = __atomic_load_n(&this->_tail, __ATOMIC_ACQUIRE);
+					if (head == this->_cached_tail)
+						return (false);
+				}
+				pointer slot = this->_buffer + (head & this->_mask);
+				out = *slot;
+				this->_alloc.destroy(slot);
+				__atomic_store_n(&this->_head, head + 1, __ATOMIC_RELEASE);
+				return (true);
+			}
+
+			//최대 n개를 out에 꺼내고, 꺼낸 개수를 반환한다.
+			template <class OutputIterator>
+			size_type pop_n(OutputIterator out, size_type n)
+			{
+				size_type head = this->_head;
+				size_type ready = this->_cached_tail - head;
+				if (ready < n)
+				{
+					this->_cached_tail = __atomic_load_n(&this->_tail, __ATOMIC_ACQUIRE);
+					ready = this->_cached_tail - head;
+					if (ready < n)
+						n = ready;
+				}
+				//대입이 예외를 던지면 이미 꺼내서 destroy한 요소까지만 publish 한다.
+				size_type i = 0;
+				try
+				{
+					for (; i < n; ++i, ++out)
+					{
+						pointer slot = this->_buffer + ((head + i) & this->_mask);
+						*out = *slot;
+						this->_alloc.destroy(slot);
+					}
+				}
+				catch (...)
+				{
+					if (i != 0)
+						__atomic_store_n(&this->_head, head + i, __ATOMIC_RELEASE);
+					throw ;
+				}
+				if (n != 0)
+					__atomic_store_n(&this->_head, head + n, __ATOMIC_RELEASE);
+				return (n);
+			}
+
+			allocator_type get_allocator() const
+			{
+				return (this->_alloc);
+			}
+	};
+
+	/**
+	 * @brief mpmc_queue
+	 *
+	 * producer/consumer 수에 제한이 없는 queue. (Dmitry Vyukov의 bounded MPMC queue)
+	 *
+	 * 각 slot은 sequence 번호를 가진다.
+	 * - sequence == pos       : pos번째 push가 쓸 수 있는 빈 slot
+	 * - sequence == pos + 1   : pos번째 pop이 읽을 수 있는 slot
+	 * push/pop은 _enqueue_pos/_dequeue_pos를 CAS로 선점한 뒤 slot에 쓰거나 읽고,
+	 * sequence를 다음 상태로 release store하여 상대편에게 넘긴다.
+	 * slot의 sequence가 한 바퀴(capacity) 전 값이면 full, 아직 안 쓰였으면 empty 이다.
+	 *
+	 * sequence 배열과 값 배열은 각각 allocator로 할당한다. (값은 push 시점에만 construct)
+	 *
+	 * slot을 CAS로 선점한 뒤에는 되돌릴 수 없으므로 (뒤의 slot을 다른 thread가 이미 선점했을 수 있다)
+	 * 요소의 복사 생성과 복사 대입은 예외를 던지지 않아야 한다. ft::is_nothrow_copyable로 컴파일 시에 확인한다.
+	 * 직접 만든 타입은 복사 생성자와 대입 연산자를 throw()로 선언하거나 is_nothrow_copyable을 특수화한다.
+	 *
+	 * @tparam T		Type of the elements.
+	 * @tparam Alloc	Type of the allocator object used to define the storage allocation model.
+	 */
+	template < typename T, typename Alloc = std::allocator<T> >
+	class mpmc_queue
+	{
+		public:
+			typedef T			value_type;
+			typedef Alloc		allocator_type;
+			typedef typename allocator_type::pointer	pointer;
+			typedef typename allocator_type::size_type	size_type;
+			typedef typename Alloc::template rebind<size_type>::other	sequence_allocator_type;
+
+		private:
+			//복사가 예외를 던질 수 있는 타입이면 배열 크기가 -1이 되어 컴파일되지 않는다.
+			typedef char	value_must_be_nothrow_copyable[ft::is_nothrow_copyable<T>::value ? 1 : -1];
+
+			allocator_type			_alloc;
+			sequence_allocator_type	_seq_alloc;
+			pointer					_buffer;
+			size_type*				_sequence;
+			size_type				_mask;
+			size_type				_enqueue_pos FT_CACHE_ALIGNED;
+			size_type				_dequeue_pos FT_CACHE_ALIGNED;
+
+			mpmc_queue(const mpmc_queue&);
+			mpmc_queue& operator=(const mpmc_queue&);
+
+		public:
+			explicit mpmc_queue(size_type capacity, const allocator_type& alloc = allocator_type())
+			: _alloc(alloc), _seq_alloc(sequence_allocator_type(alloc)), _buffer(NULL), _sequence(NULL), _mask(0), _enqueue_pos(0), _dequeue_pos(0)
+			{
+				if (capacity == 0 || capacity > _alloc.max_size())
+					throw(std::length_error("Error: ft::mpmc_queue"));
+				capacity = lockfree_detail::round_up_pow2(capacity);
+				this->_buffer = this->_alloc.allocate(capacity);
+				this->_sequence = this->_seq_alloc.allocate(capacity);
+				for (size_type i = 0; i < capacity; ++i)
+					this->_seq_alloc.construct(this->_sequence + i, i);
+				this->_mask = capacity - 1;
+			}
+
+			//소멸 시점에는 다른 thread가 접근하지 않는다고 가정한다.
+			~mpmc_queue()
+			{
+				for (size_type i = this->_dequeue_pos; i != this->_enqueue_pos; ++i)
+					this->_alloc.destroy(this->_buffer + (i & this->_mask));
+				this->_alloc.deallocate(this->_buffer, this->_mask + 1);
+				this->_seq_alloc.deallocate(this->_sequence, this->_mask + 1);
+			}
+
+			size_type capacity() const
+			{
+				return (this->_mask + 1);
+			}
+
+			//다른 thread가 동시에 push/pop 하고 있다면 근사값이다.
+			size_type size() const
+			{
+				size_type enq = __atomic_load_n(&this->_enqueue_pos, __ATOMIC_RELAXED);
+				size_type deq = __atomic_load_n(&this->_dequeue_pos, __ATOMIC_RELAXED);
+				return (enq > deq ? enq - deq : 0);
+			}
+
+			bool empty() const
+			{
+				return (size() == 0);
+			}
+
+			//가득 차 있으면 false를 반환한다.
+			bool push(const value_type& val)
+			{
+				size_type pos = __atomic_load_n(&this->_enqueue_pos, __ATOMIC_RELAXED);
+				while (true)
+				{
+					size_type seq = __atomic_load_n(this->_sequence + (pos & this->_mask), __ATOMIC_ACQUIRE);
+					ptrdiff_t diff = static_cast<ptrdiff_t>(seq - pos);
+					if (diff == 0)
+					{
+						if (__atomic_compare_exchange_n(&this->_enqueue_pos, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+							break;
+					}
+					else if (diff < 0)
+						return (false);
+					else
+						pos = __atomic_load_n(&this->_enqueue_pos, __ATOMIC_RELAXED);
+					lockfree_detail::cpu_relax();
+				}
+				this->_alloc.construct(this->_buffer + (pos & this->_mask), val);
+				__atomic_store_n(this->_sequence + (pos & this->_mask), pos + 1, __ATOMIC_RELEASE);
+				return (true);
+			}
+
+			/**
+			 * @brief push_n
+			 * pos부터 연속으로 비어있는 slot을 최대 n개 확인한 뒤 CAS 한 번으로 한꺼번에 선점한다.
+			 * 넣은 개수를 반환한다. (가득 차 있으면 0)
+			 */
+			template <class InputIterator>
+			size_type push_n(InputIterator first, size_type n)
+			{
+				size_type pos = __atomic_load_n(&this->_enqueue_pos, __ATOMIC_RELAXED);
+				size_type count;
+				while (true)
+				{
+					count = 0;
+					while (count < n && count <= this->_mask
+						&& __atomic_load_n(this->_sequence + ((pos + count) & this->_mask), __ATOMIC_ACQUIRE) == pos + count)
+						++count;
+					if (count == 0)
+					{
+						size_type seq = __atomic_load_n(this->_sequence + (pos & this->_mask), __ATOMIC_ACQUIRE);
+						if (static_cast<ptrdiff_t>(seq - pos) < 0)
+							return (0);
+						pos = __atomic_load_n(&this->_enqueue_pos, __ATOMIC_RELAXED);
+					}
+					else if (__atomic_compare_exchange_n(&this->_enqueue_pos, &pos, pos + count, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+						break;
+					lockfree_detail::cpu_relax();
+				}
+				for (size_type i = 0; i < count; ++i, ++first)
+				{
+					size_type slot = (pos + i) & this->_mask;
+					this->_alloc.construct(this->_buffer + slot, *first);
+					__atomic_store_n(this->_sequence + slot, pos + i + 1, __ATOMIC_RELEASE);
+				}
+				return (count);
+			}
+
+			//비어 있으면 false를 반환한다.
+			bool pop(value_type& out)
+			{
+				size_type pos = __atomic_load_n(&this->_dequeue_pos, __ATOMIC_RELAXED);
+				while (true)
+				{
+					size_type seq = __atomic_load_n(this->_sequence + (pos & this->_mask), __ATOMIC_ACQUIRE);
+					ptrdiff_t diff = static_cast<ptrdiff_t>(seq - (pos + 1));
+					if (diff == 0)
+					{
+						if (__atomic_compare_exchange_n(&this->_dequeue_pos, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+							break;
+					}
+					else if (diff < 0)
+						return (false);
+					else
+						pos = __atomic_load_n(&this->_dequeue_pos, __ATOMIC_RELAXED);
+					lockfree_detail::cpu_relax();
+				}
+				pointer slot = this->_buffer + (pos & this->_mask);
+				out = *slot;
+				this->_alloc.destroy(slot);
+				__atomic_store_n(this->_sequence + (pos & this->_mask), pos + this->_mask + 1, __ATOMIC_RELEASE);
+				return (true);
+			}
+
+			//push_n과 같은 방식으로 읽을 수 있는 slot을 최대 n개 선점해서 꺼낸다.
+			template <class OutputIterator>
+			size_type pop_n(OutputIterator out, size_type n)
+			{
+				size_type pos = __atomic_load_n(&this->_dequeue_pos, __ATOMIC_RELAXED);
+				size_type count;
+				while (true)
+				{
+					count = 0;
+					while (count < n && count <= this->_mask
+						&& __atomic_load_n(this->_sequence + ((pos + count) & this->_mask), __ATOMIC_ACQUIRE) == pos + count + 1)
+						++count;
+					if (count == 0)
+					{
+						size_type seq = __atomic_load_n(this->_sequence + (pos & this->_mask), __ATOMIC_ACQUIRE);
+						if (static_cast<ptrdiff_t>(seq - (pos + 1)) < 0)
+							return (0);
+						pos = __atomic_load_n(&this->_dequeue_pos, __ATOMIC_RELAXED);
+					}
+					else if (__atomic_compare_exchange_n(&this->_dequeue_pos, &pos, pos + count, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+						break;
+					lockfree_detail::cpu_relax();
+				}
+				for (size_type i = 0; i < count; ++i, ++out)
+				{
+					size_type slot = (pos + i) & this->_mask;
+					*out = this->_buffer[slot];
+					this->_alloc.destroy(this->_buffer + slot);
+					__atomic_store_n(this->_sequence + slot, pos + i + this->_mask + 1, __ATOMIC_RELEASE);
+				}
+				return (count);
+			}
+
+			allocator_type get_allocator() const
+			{
+				return (this->_alloc);
+			}
+	};
+} // namespace ft
+
+#endif
@@ -48,22 +48,30 @@ namespace ft
 			 * 반환되는 comp 객체는 멤버타입 map::value_compare의 객체로 내부 comp 객체를 사용하여,
 			 * 적절한 비교함수 클래스를 생성하는 중첩 클래스
 			 */
-			class value_compare : binary_function<value_type, value_type, bool>
+			class value_compare : binary_function<value_type, value_type, bool>, protected ft::ebo_holder<Compare>
 			{
+				friend class map;
 				protected:
-					Compare comp;
-					value_compare(Compare c) : comp(c) {}
+					//Compare가 빈 class이면 value_compare도 빈 class가 되어 RBTree에서 크기를 차지하지 않는다. (ft::ebo_holder 참고)
+					value_compare(Compare c) : ft::ebo_holder<Compare>(c) {}
+					const Compare& comp() const { return (this->get()); }
 				// constructed with map's comparison object
 				public:
 					typedef value_type	first_argument_type;
 					typedef value_type	second_argument_type;
 					typedef bool		result_type;
+					//key_compare가 한 번에 비교할 수 있으면 RBTree가 compare를 사용한다. (ft::three_way_traits 참고)
+					static const bool	three_way = ft::key_three_way<Compare>::enabled;
 					//construct a new value_compare object
-					value_compare() : comp() {}
+					value_compare() : ft::ebo_holder<Compare>() {}
 					//compares two values of type value_type
 					bool operator()(const value_type& lhs, const value_type& rhs) const
 					{
-						return (comp(lhs.first, rhs.first));
+						return (comp()(lhs.first, rhs.first));
+					}
+					int compare(const value_type& lhs, const value_type& rhs) const
+					{
+						return (ft::key_three_way<Compare>::compare(comp(), lhs.first, rhs.first));
 					}
 			};
 			typedef Alloc	allocator_type;
@@ -73,27 +81,47 @@ namespace ft
 			typedef typename allocator_type::const_pointer		const_pointer;
 			typedef typename ft::RBTreeIterator<value_type, value_type*, value_type&>	iterator;
 			typedef typename ft::RBTreeIterator<value_type, const value_type*, const value_type&>	const_iterator;
-			typedef ft::reverse_iterator<iterator>				reverse_iterator;
-			typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+			typedef ft::RBTreeReverseIterator<value_type, value_type*, value_type&>	reverse_iterator;
+			typedef ft::RBTreeReverseIterator<value_type, const value_type*, const value_type&>	const_reverse_iterator;
 			typedef typename allocator_type::difference_type	difference_type;
 			typedef typename allocator_type::size_type			size_type;
-			typedef ft::RBTree<value_type, value_compare>		rb_tree;
+			typedef ft::RBTree<value_type, value_compare, allocator_type>	rb_tree;
 			typedef ft::RBTreeNode<value_type>					node_type;
 
 		/**
 		 * @brief Member variables
 		 */
 		private:
-			allocator_type	_alloc;
 			rb_tree			_tree;
-			key_compare	_comp;
+
+			//비교 함수 객체는 tree가 value_compare 안에 하나만 가진다.
+			const key_compare& comp() const
+			{
+				return (this->_tree.get_compare().comp());
+			}
+
+			//key와 노드의 pair를 바로 비교한다. find_batch에서 key마다 pair를 만들지 않기 위해 사용
+			struct key_value_compare
+			{
+				key_compare	comp;
+
+				key_value_compare(const key_compare& c) : comp(c) {}
+				bool operator()(const value_type& x, const key_type& k) const
+				{
+					return (comp(x.first, k));
+				}
+				bool operator()(const key_type& k, const value_type& x) const
+				{
+					return (comp(k, x.first));
+				}
+			};
 
 		public:
 			/**
 			 * @brief Member functions
 			 */
 			//Empty constructor
-			explicit map (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _alloc(alloc), _tree(), _comp(comp) {}
+			explicit map (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _tree(value_compare(comp), alloc) {}
 
 			//Range constructor
 			//[first,last) 범위와 동일한 수의 요소로 컨테이너를 구성하고 각 요소는 해당 범위의 해당 요소로 구성한다
@@ -101,17 +129,14 @@ namespace ft
 			map (InputIterator first, InputIterator last,
 					const key_compare& comp = key_compare(),
 					const allocator_type& alloc = allocator_type(),
-					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) : _alloc(alloc), _tree(), _comp(comp)
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) : _tree(value_compare(comp), alloc)
 			{
 				insert(first, last);
 			}
 
 			//Copy constructor
 			//x에 있는 각 요소의 복사본을 사용하여 컨테이너를 구성한다
-			map (const map& x) : _alloc(x._alloc), _tree(), _comp(x._comp)
-			{
-				*this = x;
-			}
+			map (const map& x) : _tree(x._tree) {}
 
 			//Destructor
 			~map() {}
@@ -120,7 +145,7 @@ namespace ft
 			map& operator=(const map& x)
 			{
 				if (this != &x)
-					this->_tree.copy(x._tree);
+					this->_tree = x._tree;
 				return *this;
 			}
 
@@ -145,20 +170,20 @@ namespace ft
 
 			reverse_iterator rbegin()
 			{
-				return reverse_iterator(this->_tree.get_end());
+				return reverse_iterator(this->_tree.get_last());
 			}
 			const_reverse_iterator rbegin() const
 			{
-				return const_reverse_iterator(this->_tree.get_end());
+				return const_reverse_iterator(this->_tree.get_last());
 			}
 
 			reverse_iterator rend()
 			{
-				return reverse_iterator(this->_tree.get_begin());
+				return reverse_iterator(this->_tree.get_end());
 			}
 			const_reverse_iterator rend() const
 			{
-				return const_reverse_iterator(this->_tree.get_begin());
+				return const_reverse_iterator(this->_tree.get_end());
 			}
 
 			//Capacity
@@ -175,6 +200,29 @@ namespace ft
 				return (this->_tree.max_size());
 			}
 
+			/**
+			 * @brief reserve & node_capacity & shrink_to_fit (ft 확장)
+			 *
+			 * reserve		: 요소 n개까지 allocator 호출 없이 삽입할 수 있도록 노드를 큰 묶음(slab)으로 미리 할당한다.
+			 * node_capacity	: allocator 호출 없이 가질 수 있는 요소의 수
+			 * shrink_to_fit	: 사용하지 않는 slab을 돌려준다.
+			 * 어느 것도 iterator를 무효화하지 않는다. (RBTree::reserve 참고)
+			 */
+			void reserve(size_type n)
+			{
+				this->_tree.reserve(n);
+			}
+
+			size_type node_capacity() const
+			{
+				return (this->_tree.node_capacity());
+			}
+
+			void shrink_to_fit()
+			{
+				this->_tree.shrink_to_fit();
+			}
+
 			/**
 			 * @brief Element access
 			 *
@@ -186,7 +234,7 @@ namespace ft
 			 */
 			mapped_type& operator[](const key_type& k)
 			{
-				return (*(_tree.insert(ft::make_pair(k, mapped_type())).first)).value->second;
+				return (*(_tree.insert(ft::make_pair(k, mapped_type())).first)).value.second;
 			}
 
 			/**
@@ -279,6 +327,18 @@ namespace ft
 					erase(first++);
 			}
 
+			/**
+			 * @brief erase_if
+			 *
+			 * pred(value)가 true인 요소를 모두 지우고 지운 수를 반환한다. 동일한 이름의 non-member function이 이 함수를 부른다.
+			 * erase를 반복하는 것과 달리 한 번의 순회로 끝나고, 대부분을 지울 때는 tree를 다시 조립한다. (RBTree::erase_if 참고)
+			 */
+			template <class Predicate>
+			size_type erase_if(Predicate pred)
+			{
+				return (this->_tree.erase_if(pred));
+			}
+
 			/**
 			 * @brief swap
 			 *
@@ -300,6 +360,18 @@ namespace ft
 				this->_tree.clear();
 			}
 
+			/**
+			 * @brief compact
+			 *
+			 * 모든 노드를 하나의 연속된 메모리로 key 순서대로 옮긴다. (ft 확장, RBTree::compact 참고)
+			 * 삽입/삭제가 오래 반복되어 노드가 흩어진 map의 순회와 탐색이 빨라진다.
+			 * 요소와 순서는 바뀌지 않지만 모든 iterator, 포인터, 참조가 무효화된다.
+			 */
+			void compact()
+			{
+				this->_tree.compact();
+			}
+
 			//Observers
 			/**
 			 * @brief key_comp
@@ -309,7 +381,7 @@ namespace ft
 			 */
 			key_compare key_comp() const
 			{
-				return (key_compare());
+				return (comp());
 			}
 
 			/**
@@ -322,7 +394,7 @@ namespace ft
 			 */
 			value_compare value_comp() const
 			{
-				return (value_compare());
+				return (this->_tree.get_compare());
 			}
 
 			//Operations
@@ -348,6 +420,49 @@ namespace ft
 				return (const_iterator(this->_tree.find(value_type(k, mapped_type()))));
 			}
 
+			/**
+			 * @brief find_batch
+			 *
+			 * keys[0..n)를 각각 find한 결과를 out[0..n)에 쓴다. (없으면 end)
+			 * 여러 key의 탐색을 번갈아 진행하면서 다음 노드를 prefetch 하므로, 큰 map에서 find를 n번 부르는 것보다 cache miss 대기가 겹쳐진다.
+			 * @param keys	찾을 key 배열
+			 * @param n		key의 수
+			 * @param out	결과 iterator를 쓸 배열 (n개 이상)
+			 */
+			void find_batch(const key_type* keys, size_type n, iterator* out)
+			{
+				this->_tree.find_batch(keys, n, out, key_value_compare(comp()));
+			}
+
+			void find_batch(const key_type* keys, size_type n, const_iterator* out) const
+			{
+				this->_tree.find_batch(keys, n, out, key_value_compare(comp()));
+			}
+
+			/**
+			 * @brief find_sorted_batch / insert_sorted_batch
+			 *
+			 * 오름차순으로 정렬된 입력을 이전 결과 위치에서부터 찾는다. (finger search, RBTree::finger_lower_bound 참고)
+			 * m개의 정렬된 key가 O(m log n) 대신 O(m log(n/m))이 된다. 순서가 거꾸로 된 곳에서는 root부터 다시 찾으므로 느려질 뿐 결과는 find/insert와 같다.
+			 * insert_sorted_batch는 insert(first, last)처럼 이미 있는 key는 건너뛴다.
+			 * key 사이의 간격이 넓으면(큰 map에서 드문드문 찾는 경우) 이전 결과를 기다려야 하므로 find_batch가 더 빠를 수 있다.
+			 */
+			void find_sorted_batch(const key_type* keys, size_type n, iterator* out)
+			{
+				this->_tree.find_sorted_batch(keys, n, out, key_value_compare(comp()));
+			}
+
+			void find_sorted_batch(const key_type* keys, size_type n, const_iterator* out) const
+			{
+				this->_tree.find_sorted_batch(keys, n, out, key_value_compare(comp()));
+			}
+
+			template <class InputIterator>
+			void insert_sorted_batch(InputIterator first, InputIterator last)
+			{
+				this->_tree.insert_sorted(first, last);
+			}
+
 			/**
 			 * @brief count
 			 *
@@ -362,7 +477,7 @@ namespace ft
 			 */
 			size_type count(const key_type& k) const
 			{
-				if (this->_tree.find(value_type(k, mapped_type()))->value != NULL)
+				if (!this->_tree.find(value_type(k, mapped_type()))->is_nil())
 					return (1);
 				else
 					return (0);
@@ -457,7 +572,7 @@ namespace ft
 			 */
 			allocator_type get_allocator() const
 			{
-				return (this->_alloc);
+				return (this->_tree.get_allocator());
 			}
 
 			void showTree()
@@ -513,6 +628,13 @@ namespace ft
 	{
 		x.swap(y);
 	}
+
+	// erase_if
+	template <class Key, class T, class Compare, class Alloc, class Predicate>
+	typename map<Key, T, Compare, Alloc>::size_type erase_if(map<Key, T, Compare, Alloc>& c, Predicate pred)
+	{
+		return (c.erase_if(pred));
+	}
 } // namespace ft
 
 #endif
@@ -0,0 +1,405 @@
+#ifndef MULTIMAP_HPP
+# define MULTIMAP_HPP
+
+#include "RBTree.hpp"
+
+namespace ft
+{
+	/**
+	 * @brief multimap class
+	 *
+	 * map과 같이 pair<key, value>를 key 기준으로 정렬해서 저장하지만, 같은 key를 가진 요소가 여러 개 존재할 수 있다.
+	 * map과 같은 RBTree를 사용하고 삽입만 RBTree::insert_equal을 사용한다.
+	 * 같은 key를 가진 요소들은 삽입된 순서대로 이어져 있으며, equal_range로 한 번에 얻을 수 있다.
+	 *
+	 * map<key, vector<value> >로 대신하던 경우에 비해
+	 * - 요소마다 별도의 vector 할당이 없고
+	 * - key와 상관없이 전체를 정렬된 순서로 순회할 수 있으며
+	 * - 요소 하나를 iterator로 바로 지울 수 있다.
+	 *
+	 * @tparam Key	Type of the keys.(key_type)
+	 * @tparam T	Type of the mapped value.(mapped_type)
+	 * @tparam Compare	A binary predicate that takes two element keys as arguments and returns a bool.(key_compare)
+	 * @tparam Alloc	Type of the allocator object used to define the storage allocation model.(allocator_type)
+	 */
+	template < class Key, class T, class Compare = ft::less<Key>, class Alloc = std::allocator< ft::pair<const Key, T> > >
+	class multimap {
+		public :
+			/**
+			 * @brief Member types
+			 */
+			typedef const Key	key_type;
+			typedef T	mapped_type;
+			typedef ft::pair<key_type, mapped_type>	value_type;
+			typedef Compare	key_compare;
+
+			//map::value_compare와 같다.
+			class value_compare : binary_function<value_type, value_type, bool>, protected ft::ebo_holder<Compare>
+			{
+				friend class multimap;
+				protected:
+					//Compare가 빈 class이면 value_compare도 빈 class가 되어 RBTree에서 크기를 차지하지 않는다. (ft::ebo_holder 참고)
+					value_compare(Compare c) : ft::ebo_holder<Compare>(c) {}
+					const Compare& comp() const { return (this->get()); }
+				public:
+					typedef value_type	first_argument_type;
+					typedef value_type	second_argument_type;
+					typedef bool		result_type;
+					value_compare() : ft::ebo_holder<Compare>() {}
+					bool operator()(const value_type& lhs, const value_type& rhs) const
+					{
+						return (comp()(lhs.first, rhs.first));
+					}
+			};
+			typedef Alloc	allocator_type;
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+			typedef typename ft::RBTreeIterator<value_type, value_type*, value_type&>	iterator;
+			typedef typename ft::RBTreeIterator<value_type, const value_type*, const value_type&>	const_iterator;
+			typedef ft::RBTreeReverseIterator<value_type, value_type*, value_type&>	reverse_iterator;
+			typedef ft::RBTreeReverseIterator<value_type, const value_type*, const value_type&>	const_reverse_iterator;
+			typedef typename allocator_type::difference_type	difference_type;
+			typedef typename allocator_type::size_type			size_type;
+			typedef ft::RBTree<value_type, value_compare, allocator_type>	rb_tree;
+			typedef ft::RBTreeNode<value_type>					node_type;
+
+		/**
+		 * @brief Member variables
+		 */
+		private:
+			rb_tree			_tree;
+
+			//비교 함수 객체는 tree가 value_compare 안에 하나만 가진다.
+			const key_compare& comp() const
+			{
+				return (this->_tree.get_compare().comp());
+			}
+
+		public:
+			/**
+			 * @brief Member functions
+			 */
+			//Empty constructor
+			explicit multimap (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _tree(value_compare(comp), alloc) {}
+
+			//Range constructor
+			//[first,last)의 모든 요소를 중복된 key까지 포함해서 삽입한다.
+			template <class InputIterator>
+			multimap (InputIterator first, InputIterator last,
+					const key_compare& comp = key_compare(),
+					const allocator_type& alloc = allocator_type(),
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) : _tree(value_compare(comp), alloc)
+			{
+				insert(first, last);
+			}
+
+			//Copy constructor
+			multimap (const multimap& x) : _tree(x._tree) {}
+
+			//Destructor
+			~multimap() {}
+
+			//Assignment operator
+			//RBTree::copy는 tree의 모양을 그대로 복제하므로 같은 key의 순서도 유지된다.
+			multimap& operator=(const multimap& x)
+			{
+				if (this != &x)
+					this->_tree = x._tree;
+				return *this;
+			}
+
+			// Iterators:
+			iterator begin()
+			{
+				return iterator(this->_tree.get_begin());
+			}
+			const_iterator begin() const
+			{
+				return const_iterator(this->_tree.get_begin());
+			}
+
+			iterator end()
+			{
+				return iterator(this->_tree.get_end());
+			}
+			const_iterator end() const
+			{
+				return const_iterator(this->_tree.get_end());
+			}
+
+			reverse_iterator rbegin()
+			{
+				return reverse_iterator(this->_tree.get_last());
+			}
+			const_reverse_iterator rbegin() const
+			{
+				return const_reverse_iterator(this->_tree.get_last());
+			}
+
+			reverse_iterator rend()
+			{
+				return reverse_iterator(this->_tree.get_end());
+			}
+			const_reverse_iterator rend() const
+			{
+				return const_reverse_iterator(this->_tree.get_end());
+			}
+
+			//Capacity
+			bool empty() const
+			{
+				return (this->_tree.empty());
+			}
+			size_type size() const
+			{
+				return (this->_tree.size());
+			}
+			size_type max_size() const
+			{
+				return (this->_tree.max_size());
+			}
+
+			//노드를 미리 할당한다. (map::reserve 참고)
+			void reserve(size_type n)
+			{
+				this->_tree.reserve(n);
+			}
+
+			size_type node_capacity() const
+			{
+				return (this->_tree.node_capacity());
+			}
+
+			void shrink_to_fit()
+			{
+				this->_tree.shrink_to_fit();
+			}
+
+			/**
+			 * @brief Modifiers
+			 *
+			 * insert
+			 * map과 달리 같은 key가 있어도 항상 삽입에 성공한다. -> 반환값도 pair가 아닌 iterator
+			 * 같은 key가 이미 있다면 그 요소들의 뒤에 삽입된다.
+			 *
+			 * erase
+			 * key로 지우면 그 key를 가진 모든 요소를 지우고 지운 수를 반환한다.
+			 *
+			 * operator[]는 어떤 요소를 가리켜야 할지 정할 수 없으므로 제공하지 않는다.
+			 */
+			//1. single element
+			iterator insert(const value_type& val)
+			{
+				return (iterator(this->_tree.insert_equal(val)));
+			}
+
+			//2. with hint
+			//val이 hint 바로 앞에 들어갈 수 있으면 그 위치에 삽입한다. (탐색 없이 상수 시간 + 재조정)
+			iterator insert(iterator position, const value_type& val)
+			{
+				return (iterator(this->_tree.insert_equal(val, position.base())));
+			}
+
+			//3. range
+			//[first, last) 구간의 element를 중복 여부와 상관없이 모두 insert.
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last,
+			typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+			{
+				while (first != last)
+					this->_tree.insert_equal(*first++);
+			}
+
+			void erase(iterator position)
+			{
+				this->_tree.erase(position.base());
+			}
+
+			//k와 같은 key를 가진 모든 요소를 지우고 지워진 요소의 수를 반환한다.
+			size_type erase(const key_type& k)
+			{
+				ft::pair<iterator, iterator> range = equal_range(k);
+				size_type n = 0;
+				while (range.first != range.second)
+				{
+					erase(range.first++);
+					++n;
+				}
+				return (n);
+			}
+
+			void erase(iterator first, iterator last)
+			{
+				while (first != last)
+					erase(first++);
+			}
+
+			template <class Predicate>
+			size_type erase_if(Predicate pred)
+			{
+				return (this->_tree.erase_if(pred));
+			}
+
+			void swap(multimap& x)
+			{
+				this->_tree.swap(x._tree);
+			}
+
+			void clear()
+			{
+				this->_tree.clear();
+			}
+
+			//모든 노드를 하나의 연속된 메모리로 key 순서대로 옮긴다. 모든 iterator가 무효화된다. (map::compact 참고)
+			void compact()
+			{
+				this->_tree.compact();
+			}
+
+			//Observers
+			key_compare key_comp() const
+			{
+				return (comp());
+			}
+
+			value_compare value_comp() const
+			{
+				return (this->_tree.get_compare());
+			}
+
+			//Operations
+			/**
+			 * @brief find
+			 *
+			 * k와 같은 key를 가진 요소 중 하나를 가리키는 iterator를 반환한다. 없으면 end()
+			 * lower_bound를 사용하므로 같은 key 중 가장 먼저 삽입된 요소가 반환된다.
+			 */
+			iterator find(const key_type& k)
+			{
+				iterator it = lower_bound(k);
+				if (it == end() || comp()(k, it->first))
+					return (end());
+				return (it);
+			}
+
+			const_iterator find(const key_type& k) const
+			{
+				const_iterator it = lower_bound(k);
+				if (it == end() || comp()(k, it->first))
+					return (end());
+				return (it);
+			}
+
+			/**
+			 * @brief count
+			 *
+			 * k와 같은 key를 가진 요소의 수를 반환한다.
+			 * lower_bound를 찾은 뒤 같은 key인 동안만 순회하므로 O(logN + count)
+			 */
+			size_type count(const key_type& k) const
+			{
+				return (this->_tree.count(value_type(k, mapped_type())));
+			}
+
+			iterator lower_bound(const key_type& k)
+			{
+				return (iterator(this->_tree.lower_bound(value_type(k, mapped_type()))));
+			}
+
+			const_iterator lower_bound(const key_type& k) const
+			{
+				return (const_iterator(this->_tree.lower_bound(value_type(k, mapped_type()))));
+			}
+
+			iterator upper_bound(const key_type& k)
+			{
+				return (iterator(this->_tree.upper_bound(value_type(k, mapped_type()))));
+			}
+			const_iterator upper_bound(const key_type& k) const
+			{
+				return (const_iterator(this->_tree.upper_bound(value_type(k, mapped_type()))));
+			}
+
+			/**
+			 * @brief equal_range
+			 *
+			 * k와 같은 key를 가진 모든 요소의 범위 [lower_bound, upper_bound)를 반환한다.
+			 * 두 경계 모두 root부터 한 번씩 내려가서 찾으므로 O(logN)
+			 */
+			pair<iterator, iterator> equal_range(const key_type& k)
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+			pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+
+			allocator_type get_allocator() const
+			{
+				return (this->_tree.get_allocator());
+			}
+
+			void showTree()
+			{
+				this->_tree.showMap();
+			}
+	};
+
+	/**
+	 * @brief Relational operators
+	 */
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator==(const multimap<Key, T, Compare, Alloc>& lhs, const multimap<Key, T, Compare, Alloc>& rhs)
+	{
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator!=(const multimap<Key, T, Compare, Alloc>& lhs, const multimap<Key, T, Compare, Alloc>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator<(const multimap<Key, T, Compare, Alloc>& lhs, const multimap<Key, T, Compare, Alloc>& rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator<=(const multimap<Key, T, Compare, Alloc>& lhs, const multimap<Key, T, Compare, Alloc>& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator>(const multimap<Key, T, Compare, Alloc>& lhs, const multimap<Key, T, Compare, Alloc>& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	bool operator>=(const multimap<Key, T, Compare, Alloc>& lhs, const multimap<Key, T, Compare, Alloc>& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	// swap
+	template <class Key, class T, class Compare, class Alloc>
+	void swap(multimap<Key, T, Compare, Alloc>& x, multimap<Key, T, Compare, Alloc>& y)
+	{
+		x.swap(y);
+	}
+
+	// erase_if
+	template <class Key, class T, class Compare, class Alloc, class Predicate>
+	typename multimap<Key, T, Compare, Alloc>::size_type erase_if(multimap<Key, T, Compare, Alloc>& c, Predicate pred)
+	{
+		return (c.erase_if(pred));
+	}
+} // namespace ft
+
+#endif
@@ -0,0 +1,127 @@
+#ifndef PREFIXED_STRING_HPP
+# define PREFIXED_STRING_HPP
+
+#include <string>
+#include <iostream>
+#include "utils.hpp"
+
+namespace ft
+{
+	/**
+	 * @brief prefixed_string
+	 *
+	 * 앞 8 byte를 정수(big endian)로 미리 계산해 두는 std::string wrapper
+	 * ft::map<ft::prefixed_string, V>처럼 key로 사용하면 tree의 노드마다 key의 prefix가 캐시된다.
+	 *
+	 * 두 key의 앞 8 byte가 다르면 정수 비교 한 번으로 순서가 정해지고 문자열 메모리는 읽지 않는다.
+	 * 앞 8 byte가 같으면 9번째 byte부터 비교한다.
+	 * 순서는 std::string의 순서와 같다. (unsigned char 기준 사전순)
+	 *
+	 * 앞 8 byte가 대부분 같은 key(ex. "https://...")에서는 이득이 없고 key마다 8 byte가 늘어나므로 필요한 경우에만 사용한다.
+	 */
+	class prefixed_string
+	{
+		public:
+			typedef unsigned long long	prefix_type;
+
+			static const size_t	PREFIX_SIZE = sizeof(prefix_type);
+
+		private:
+			std::string	_str;
+			prefix_type	_prefix;
+
+			static prefix_type make_prefix(const std::string& str)
+			{
+				prefix_type res = 0;
+				for (size_t i = 0; i < PREFIX_SIZE; ++i)
+				{
+					res <<= 8;
+					if (i < str.size())
+						res |= static_cast<unsigned char>(str[i]);
+				}
+				return (res);
+			}
+
+		public:
+			prefixed_string() : _str(), _prefix(0) {}
+			prefixed_string(const std::string& str) : _str(str), _prefix(make_prefix(str)) {}
+			prefixed_string(const char* str) : _str(str), _prefix(make_prefix(_str)) {}
+			prefixed_string(const prefixed_string& x) : _str(x._str), _prefix(x._prefix) {}
+			~prefixed_string() {}
+
+			prefixed_string& operator=(const prefixed_string& x)
+			{
+				_str = x._str;
+				_prefix = x._prefix;
+				return (*this);
+			}
+
+			const std::string& str() const
+			{
+				return (_str);
+			}
+			prefix_type prefix() const
+			{
+				return (_prefix);
+			}
+			size_t size() const
+			{
+				return (_str.size());
+			}
+
+			//std::string::compare와 같은 부호를 반환한다.
+			int compare(const prefixed_string& x) const
+			{
+				if (_prefix != x._prefix)
+					return ((_prefix < x._prefix) ? -1 : 1);
+				//앞 8 byte가 같고 둘 다 8 byte 이상이면 나머지만 비교한다. 짧은 쪽은 0으로 채워졌으므로 전체를 비교한다.
+				if (_str.size() >= PREFIX_SIZE && x._str.size() >= PREFIX_SIZE)
+					return (_str.compare(PREFIX_SIZE, std::string::npos, x._str, PREFIX_SIZE, std::string::npos));
+				return (_str.compare(x._str));
+			}
+	};
+
+	inline bool operator==(const prefixed_string& lhs, const prefixed_string& rhs)
+	{
+		return (lhs.prefix() == rhs.prefix() && lhs.str() == rhs.str());
+	}
+	inline bool operator!=(const prefixed_string& lhs, const prefixed_string& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+	inline bool operator<(const prefixed_string& lhs, const prefixed_string& rhs)
+	{
+		return (lhs.compare(rhs) < 0);
+	}
+	inline bool operator<=(const prefixed_string& lhs, const prefixed_string& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+	inline bool operator>(const prefixed_string& lhs, const prefixed_string& rhs)
+	{
+		return (rhs < lhs);
+	}
+	inline bool operator>=(const prefixed_string& lhs, const prefixed_string& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	inline std::ostream& operator<<(std::ostream& os, const prefixed_string& str)
+	{
+		return (os << str.str());
+	}
+
+	//ft::less<prefixed_string>도 RBTree에서 compare 한 번으로 비교한다.
+	template <>
+	struct key_three_way< ft::less<prefixed_string> >
+	{
+		static const bool enabled = true;
+
+		static int compare(const ft::less<prefixed_string>&, const prefixed_string& x, const prefixed_string& y)
+		{
+			return (x.compare(y));
+		}
+	};
+} // namespace ft
+
+#endif
@@ -15,7 +15,7 @@ void printMap(RBTreeNode< T >* node, int depth) {
     std::cout << "// SHOW TREE //" << std::endl;
   }
   int tmp_depth = depth;
-  if (node->value == NULL) {
+  if (node->is_nil()) {
     while (tmp_depth--) {
       std::cout << "     ";
     }
@@ -25,15 +25,15 @@ void printMap(RBTreeNode< T >* node, int depth) {
   while (tmp_depth--) {
     std::cout << "     ";
   }
-  std::cout << (node->color ? C_RESET : C_RED)
-            << (node->parent->value == NULL ? "Root" : (node->parent->leftChild == node ? "L" : "R"))
-            << " - key: " << node->value->first << C_RESET << std::endl;
-  if (node->leftChild->value != NULL) {
+  std::cout << (node->color() ? C_RESET : C_RED)
+            << (node->parent()->is_nil() ? "Root" : (node->parent()->child[LEFT] == node ? "L" : "R"))
+            << " - key: " << node->value.first << C_RESET << std::endl;
+  if (!node->child[LEFT]->is_nil()) {
     // std::cout << "left?" << std::endl;
-    printMap(node->leftChild, depth + 1);
+    printMap(node->child[LEFT], depth + 1);
   }
-  if (node->rightChild->value != NULL) {
-    printMap(node->rightChild, depth + 1);
+  if (!node->child[RIGHT]->is_nil()) {
+    printMap(node->child[RIGHT], depth + 1);
   }
     // std::cout << "right?" << std::endl;
   return;
@@ -0,0 +1,430 @@
+#ifndef PRIORITY_QUEUE_HPP
+# define PRIORITY_QUEUE_HPP
+
+#include <stdexcept>
+#include "vector.hpp"
+
+/**
+ * @brief priority_queue
+ *
+ * Container 위에 d-ary heap을 유지하는 container adaptor.
+ * top은 항상 Compare 기준으로 가장 큰 요소이다. (ft::greater를 넘기면 가장 작은 요소)
+ *
+ * map을 priority queue로 사용하면(begin() + erase(begin())) pop마다 노드 할당/해제와 rebalancing 비용이 든다.
+ * heap은 연속된 메모리 한 덩어리 위에서 swap만으로 동작하기 때문에 할당이 거의 없다.
+ *
+ * Arity
+ * 한 노드가 가지는 자식의 수. 기본값은 2 (binary heap)
+ * 4-ary heap은 높이가 절반으로 줄어들고, 한 노드의 자식들이 같은 cache line에 모여있어 pop(sift down)이 빠르다.
+ * 대신 sift down 한 단계에서 비교 횟수는 Arity - 1 번으로 늘어난다.
+ * i번째 노드의 부모 = (i - 1) / Arity, 자식 = Arity * i + 1 ... Arity * i + Arity
+ * Arity는 1 이상이어야 한다. 0이면 컴파일 오류가 난다.
+ *
+ * @tparam T			Type of the elements.
+ * @tparam Container	Type of the internal underlying container object. (random access, push_back, pop_back)
+ * @tparam Compare		A binary predicate that takes two elements as arguments and returns a bool.
+ * @tparam Arity		Number of children per heap node.
+ */
+namespace ft
+{
+	template < typename T, class Container = ft::vector<T>, class Compare = ft::less<typename Container::value_type>, size_t Arity = 2 >
+	class priority_queue
+	{
+		public:
+			typedef typename Container::value_type	value_type;
+			typedef Container	container_type;
+			typedef Compare		value_compare;
+			typedef typename Container::size_type	size_type;
+			typedef typename Container::reference	reference;
+			typedef typename Container::const_reference	const_reference;
+
+		private:
+			//Arity가 0이면 배열 크기가 -1이 되어 컴파일되지 않는다. (부모/자식 index 계산이 0으로 나누게 된다)
+			typedef char	arity_must_be_positive[Arity > 0 ? 1 : -1];
+
+		protected:
+			container_type	c;
+			value_compare	comp;
+
+		public:
+			explicit priority_queue(const value_compare& cmp = value_compare(), const container_type& ctnr = container_type())
+			: c(ctnr), comp(cmp)
+			{
+				make_heap();
+			}
+
+			//Range constructor
+			//ctnr의 요소 뒤에 [first, last)를 붙인 후 한 번에 heapify 한다. -> O(n)
+			template <class InputIterator>
+			priority_queue(InputIterator first, InputIterator last,
+							const value_compare& cmp = value_compare(),
+							const container_type& ctnr = container_type(),
+							typename ft::enable_if< !ft::is_integral< InputIterator >::value, InputIterator >::type* = NULL)
+			: c(ctnr), comp(cmp)
+			{
+				c.insert(c.end(), first, last);
+				make_heap();
+			}
+
+			priority_queue(const priority_queue& other) : c(other.c), comp(other.comp) {}
+			virtual ~priority_queue() {}
+			priority_queue& operator=(const priority_queue& other)
+			{
+				if (this != &other)
+				{
+					this->c = other.c;
+					this->comp = other.comp;
+				}
+				return (*this);
+			}
+
+			bool empty() const
+			{
+				return (this->c.empty());
+			}
+
+			size_type size() const
+			{
+				return (this->c.size());
+			}
+
+			const_reference top() const
+			{
+				return (this->c.front());
+			}
+
+			void push(const value_type& val)
+			{
+				this->c.push_back(val);
+				sift_up(this->c.size() - 1);
+			}
+
+			/**
+			 * @brief push_range
+			 *
+			 * 여러 요소를 한 번에 넣는다.
+			 * 넣는 개수가 기존 크기보다 작으면 하나씩 sift up (k log n),
+			 * 그렇지 않으면 전체를 다시 heapify (n + k)하는 쪽이 싸다.
+			 */
+			template <class InputIterator>
+			void push_range(InputIterator first, InputIterator last,
+							typename ft::enable_if< !ft::is_integral< InputIterator >::value, InputIterator >::type* = NULL)
+			{
+				size_type prev_size = this->c.size();
+				this->c.insert(this->c.end(), first, last);
+				size_type added = this->c.size() - prev_size;
+				if (added >= prev_size)
+					make_heap();
+				else
+				{
+					for (size_type i = prev_size; i < this->c.size(); ++i)
+						sift_up(i);
+				}
+			}
+
+			void pop()
+			{
+				size_type last = this->c.size() - 1;
+				if (last != 0)
+				{
+					value_type tmp = this->c[last];
+					this->c[last] = this->c[0];
+					this->c.pop_back();
+					sift_down(0, tmp);
+				}
+				else
+					this->c.pop_back();
+			}
+
+			//container는 자신의 swap으로 버퍼만 맞바꾼다. (요소를 복사하지 않는다)
+			void swap(priority_queue& x)
+			{
+				this->c.swap(x.c);
+				value_compare tmp_comp = this->comp;
+				this->comp = x.comp;
+				x.comp = tmp_comp;
+			}
+
+		protected:
+			//아래에서부터 마지막 내부 노드((n - 2) / Arity)까지 sift down -> 전체 O(n)
+			void make_heap()
+			{
+				size_type n = this->c.size();
+				if (n < 2)
+					return ;
+				size_type i = (n - 2) / Arity + 1;
+				while (i-- > 0)
+				{
+					value_type tmp = this->c[i];
+					sift_down(i, tmp);
+				}
+			}
+
+			//hole을 위로 올리면서 부모를 한 칸씩 내린다. swap 대신 대입 한 번씩만 한다.
+			void sift_up(size_type hole)
+			{
+				value_type tmp = this->c[hole];
+				while (hole > 0)
+				{
+					size_type parent = (hole - 1) / Arity;
+					if (!comp(this->c[parent], tmp))
+						break;
+					this->c[hole] = this->c[parent];
+					hole = parent;
+				}
+				this->c[hole] = tmp;
+			}
+
+			//hole 위치에 val이 들어갈 자리를 찾을 때까지 가장 큰 자식을 끌어올린다.
+			void sift_down(size_type hole, const value_type& val)
+			{
+				size_type n = this->c.size();
+				while (true)
+				{
+					size_type first_child = Arity * hole + 1;
+					if (first_child >= n)
+						break;
+					size_type last_child = first_child + Arity;
+					if (last_child > n)
+						last_child = n;
+					size_type best = first_child;
+					for (size_type i = first_child + 1; i < last_child; ++i)
+					{
+						if (comp(this->c[best], this->c[i]))
+							best = i;
+					}
+					if (!comp(val, this->c[best]))
+						break;
+					this->c[hole] = this->c[best];
+					hole = best;
+				}
+				this->c[hole] = val;
+			}
+	};
+
+	template <class T, class Container, class Compare, size_t Arity>
+	void swap(priority_queue<T, Container, Compare, Arity>& x, priority_queue<T, Container, Compare, Arity>& y)
+	{
+		x.swap(y);
+	}
+
+	/**
+	 * @brief indexed_priority_queue
+	 *
+	 * 0 ~ capacity - 1 사이의 id로 요소를 구분하는 d-ary heap.
+	 * 각 id가 heap의 어디에 있는지(_pos)를 기억하기 때문에 decrease_key / update / erase를 O(log n)에 처리한다.
+	 * Dijkstra처럼 이미 들어있는 요소의 우선순위를 바꿔야 하는 경우에 사용한다.
+	 *
+	 * _heap : heap 순서로 정렬된 id
+	 * _pos  : id -> _heap에서의 위치 (없으면 npos)
+	 * _keys : id -> key
+	 *
+	 * priority_queue와 마찬가지로 top은 Compare 기준으로 가장 큰 key이다.
+	 * ft::greater를 넘기면 top이 가장 작은 key가 되고, decrease_key는 말 그대로 key를 줄이는 연산이 된다.
+	 *
+	 * @tparam T		Type of the keys.
+	 * @tparam Compare	A binary predicate that takes two keys as arguments and returns a bool.
+	 * @tparam Arity	Number of children per heap node.
+	 */
+	template < typename T, class Compare = ft::less<T>, size_t Arity = 2 >
+	class indexed_priority_queue
+	{
+		public:
+			typedef T			value_type;
+			typedef Compare		value_compare;
+			typedef size_t		size_type;
+
+			static const size_type npos = static_cast<size_type>(-1);
+
+		private:
+			typedef char	arity_must_be_positive[Arity > 0 ? 1 : -1];
+
+		protected:
+			ft::vector<size_type>	_heap;
+			ft::vector<size_type>	_pos;
+			ft::vector<value_type>	_keys;
+			value_compare			_comp;
+
+		public:
+			explicit indexed_priority_queue(size_type capacity = 0, const value_compare& comp = value_compare())
+			: _heap(), _pos(capacity, npos), _keys(capacity), _comp(comp)
+			{
+				_heap.reserve(capacity);
+			}
+
+			indexed_priority_queue(const indexed_priority_queue& other)
+			: _heap(other._heap), _pos(other._pos), _keys(other._keys), _comp(other._comp) {}
+
+			virtual ~indexed_priority_queue() {}
+
+			indexed_priority_queue& operator=(const indexed_priority_queue& other)
+			{
+				if (this != &other)
+				{
+					this->_heap = other._heap;
+					this->_pos = other._pos;
+					this->_keys = other._keys;
+					this->_comp = other._comp;
+				}
+				return (*this);
+			}
+
+			bool empty() const
+			{
+				return (this->_heap.empty());
+			}
+
+			size_type size() const
+			{
+				return (this->_heap.size());
+			}
+
+			//사용할 수 있는 id의 범위. push에서 더 큰 id가 들어오면 자동으로 늘어난다.
+			size_type capacity() const
+			{
+				return (this->_pos.size());
+			}
+
+			bool contains(size_type id) const
+			{
+				return (id < this->_pos.size() && this->_pos[id] != npos);
+			}
+
+			const value_type& key(size_type id) const
+			{
+				if (!contains(id))
+					throw(std::out_of_range("Error: ft::indexed_priority_queue::key"));
+				return (this->_keys[id]);
+			}
+
+			const value_type& top() const
+			{
+				return (this->_keys[this->_heap.front()]);
+			}
+
+			size_type top_id() const
+			{
+				return (this->_heap.front());
+			}
+
+			void push(size_type id, const value_type& val)
+			{
+				if (contains(id))
+					throw(std::invalid_argument("Error: ft::indexed_priority_queue::push"));
+				if (id >= this->_pos.size())
+				{
+					this->_pos.resize(id + 1, npos);
+					this->_keys.resize(id + 1);
+				}
+				this->_keys[id] = val;
+				this->_pos[id] = this->_heap.size();
+				this->_heap.push_back(id);
+				sift_up(this->_heap.size() - 1);
+			}
+
+			void pop()
+			{
+				erase(this->_heap.front());
+			}
+
+			//key를 top 방향으로(우선순위가 높아지도록) 바꾼다. sift up만 필요하다.
+			void decrease_key(size_type id, const value_type& val)
+			{
+				if (!contains(id) || _comp(val, this->_keys[id]))
+					throw(std::invalid_argument("Error: ft::indexed_priority_queue::decrease_key"));
+				this->_keys[id] = val;
+				sift_up(this->_pos[id]);
+			}
+
+			//방향에 상관없이 key를 바꾼다.
+			void update(size_type id, const value_type& val)
+			{
+				if (!contains(id))
+					throw(std::invalid_argument("Error: ft::indexed_priority_queue::update"));
+				bool up = _comp(this->_keys[id], val);
+				this->_keys[id] = val;
+				if (up)
+					sift_up(this->_pos[id]);
+				else
+					sift_down(this->_pos[id]);
+			}
+
+			//id를 heap에서 제거한다. 마지막 요소로 빈 자리를 채운 뒤 위/아래 중 한 방향으로 정리한다.
+			void erase(size_type id)
+			{
+				if (!contains(id))
+					return ;
+				size_type hole = this->_pos[id];
+				size_type last = this->_heap.back();
+				this->_heap.pop_back();
+				this->_pos[id] = npos;
+				if (last == id)
+					return ;
+				this->_heap[hole] = last;
+				this->_pos[last] = hole;
+				if (hole > 0 && _comp(this->_keys[this->_heap[(hole - 1) / Arity]], this->_keys[last]))
+					sift_up(hole);
+				else
+					sift_down(hole);
+			}
+
+			void clear()
+			{
+				for (size_type i = 0; i < this->_heap.size(); ++i)
+					this->_pos[this->_heap[i]] = npos;
+				this->_heap.clear();
+			}
+
+		protected:
+			void place(size_type hole, size_type id)
+			{
+				this->_heap[hole] = id;
+				this->_pos[id] = hole;
+			}
+
+			void sift_up(size_type hole)
+			{
+				size_type id = this->_heap[hole];
+				while (hole > 0)
+				{
+					size_type parent = (hole - 1) / Arity;
+					if (!_comp(this->_keys[this->_heap[parent]], this->_keys[id]))
+						break;
+					place(hole, this->_heap[parent]);
+					hole = parent;
+				}
+				place(hole, id);
+			}
+
+			void sift_down(size_type hole)
+			{
+				size_type id = this->_heap[hole];
+				size_type n = this->_heap.size();
+				while (true)
+				{
+					size_type first_child = Arity * hole + 1;
+					if (first_child >= n)
+						break;
+					size_type last_child = first_child + Arity;
+					if (last_child > n)
+						last_child = n;
+					size_type best = first_child;
+					for (size_type i = first_child + 1; i < last_child; ++i)
+					{
+						if (_comp(this->_keys[this->_heap[best]], this->_keys[this->_heap[i]]))
+							best = i;
+					}
+					if (!_comp(this->_keys[id], this->_keys[this->_heap[best]]))
+						break;
+					place(hole, this->_heap[best]);
+					hole = best;
+				}
+				place(hole, id);
+			}
+	};
+
+	template < typename T, class Compare, size_t Arity >
+	const typename indexed_priority_queue<T, Compare, Arity>::size_type indexed_priority_queue<T, Compare, Arity>::npos;
+} // namespace ft
+
+#endif
@@ -0,0 +1,873 @@
+#ifndef RADIX_MAP_HPP
+# define RADIX_MAP_HPP
+
+#include <memory>
+#include <string>
+#include <cstring>
+#include <stdexcept>
+#include "utils.hpp"
+#include "iterator.hpp"
+
+namespace ft
+{
+	/**
+	 * @brief RadixNode
+	 *
+	 * radix_map의 노드. 노드가 나타내는 key는 root부터 이 노드까지의 prefix를 이어붙인 문자열이다.
+	 * prefix		: 부모에서 이 노드로 오는 간선의 문자열 (압축된 경로). 첫 byte로 형제들과 구분된다. root는 빈 문자열
+	 * value		: 이 노드에서 끝나는 key의 값, 없으면 NULL
+	 * children		: 자식 수에 따라 크기가 바뀐다. (adaptive)
+	 *				  0 -> 4 -> 16 은 첫 byte 순서로 정렬된 배열(bytes, children), 그 이상은 byte로 바로 찾는 256칸 배열
+	 *
+	 * value가 없는 노드(root 제외)는 항상 자식이 2개 이상이다. -> 자식이 하나가 되면 자식과 합친다.
+	 */
+	template <typename T>
+	struct RadixNode
+	{
+		typedef RadixNode*	node_ptr;
+
+		static const unsigned short	DIRECT = 256;
+
+		std::string		prefix;
+		T*				value;
+		node_ptr		parent;
+		unsigned char*	bytes;
+		node_ptr*		children;
+		unsigned short	count;
+		unsigned short	capacity;
+
+		explicit RadixNode(const std::string& p = std::string())
+			: prefix(p), value(NULL), parent(NULL), bytes(NULL), children(NULL), count(0), capacity(0) {}
+
+		unsigned char first_byte() const
+		{
+			return (static_cast<unsigned char>(prefix[0]));
+		}
+
+		//byte c로 시작하는 자식이 들어있는 칸, 없으면 NULL
+		node_ptr* slot(unsigned char c) const
+		{
+			if (capacity == DIRECT)
+				return (children[c] != NULL ? children + c : NULL);
+			for (unsigned short i = 0; i < count && bytes[i] <= c; ++i)
+				if (bytes[i] == c)
+					return (children + i);
+			return (NULL);
+		}
+
+		node_ptr child(unsigned char c) const
+		{
+			node_ptr* s = slot(c);
+			return (s != NULL ? *s : NULL);
+		}
+
+		//첫 byte가 c 이상인 첫 번째 자식 (c는 256까지)
+		node_ptr child_from(unsigned int c) const
+		{
+			if (capacity == DIRECT)
+			{
+				for (; c < DIRECT; ++c)
+					if (children[c] != NULL)
+						return (children[c]);
+				return (NULL);
+			}
+			for (unsigned short i = 0; i < count; ++i)
+				if (bytes[i] >= c)
+					return (children[i]);
+			return (NULL);
+		}
+
+		//첫 byte가 c 미만인 마지막 자식
+		node_ptr child_before(unsigned int c) const
+		{
+			if (capacity == DIRECT)
+			{
+				while (c-- > 0)
+					if (children[c] != NULL)
+						return (children[c]);
+				return (NULL);
+			}
+			for (unsigned short i = count; i > 0; --i)
+				if (bytes[i - 1] < c)
+					return (children[i - 1]);
+			return (NULL);
+		}
+
+		//n의 서브트리에서 가장 앞의 값 노드. key에는 n까지의 경로가 들어있고 찾은 노드까지의 경로가 이어붙여진다.
+		static node_ptr first_in(node_ptr n, std::string& key)
+		{
+			while (n->value == NULL)
+			{
+				n = n->child_from(0);
+				if (n == NULL)
+					return (NULL);
+				key += n->prefix;
+			}
+			return (n);
+		}
+
+		//n의 서브트리에서 가장 뒤의 값 노드 (자식이 없는 노드는 항상 값이 있다.)
+		static node_ptr last_in(node_ptr n, std::string& key)
+		{
+			while (n->count != 0)
+			{
+				n = n->child_before(DIRECT);
+				key += n->prefix;
+			}
+			return (n);
+		}
+	};
+
+	/**
+	 * @brief radix_reference / radix_pointer
+	 *
+	 * radix_map은 key 전체를 저장하지 않으므로 iterator가 key를 가지고 다닌다.
+	 * 그래서 역참조하면 map의 pair& 대신 (key, value)를 가리키는 참조 쌍을 값으로 반환한다.
+	 * it->first, it->second, (*it).second = x 처럼 map과 같은 방식으로 사용할 수 있다.
+	 */
+	template <typename Ref>
+	struct radix_reference
+	{
+		const std::string&	first;
+		Ref					second;
+
+		radix_reference(const std::string& k, Ref v) : first(k), second(v) {}
+	};
+
+	template <typename Ref>
+	class radix_pointer
+	{
+		private:
+			radix_reference<Ref>	_ref;
+		public:
+			explicit radix_pointer(const radix_reference<Ref>& ref) : _ref(ref) {}
+			const radix_reference<Ref>* operator->() const
+			{
+				return (&_ref);
+			}
+	};
+
+	/**
+	 * @brief RadixIterator
+	 *
+	 * key 순서(byte 단위 사전순)로 값이 있는 노드를 순회하는 bidirectional iterator
+	 * 노드의 값은 자식들보다 앞선다. (짧은 key가 먼저) 자식들은 첫 byte 순서로 방문한다.
+	 * 현재 노드까지의 key를 _key에 유지하며, 자식으로 내려가면 prefix를 붙이고 올라가면 잘라낸다.
+	 */
+	template <typename T, typename Ref>
+	class RadixIterator
+	{
+		public:
+			typedef ft::pair<const std::string, T>		value_type;
+			typedef std::ptrdiff_t						difference_type;
+			typedef ft::bidirectional_iterator_tag		iterator_category;
+			typedef ft::radix_reference<Ref>			reference;
+			typedef ft::radix_pointer<Ref>				pointer;
+			typedef ft::RadixNode<T>					node_type;
+
+		private:
+			node_type*	_root;
+			node_type*	_node;
+			std::string	_key;
+
+		public:
+			RadixIterator() : _root(NULL), _node(NULL), _key() {}
+			RadixIterator(node_type* root, node_type* node, const std::string& key) : _root(root), _node(node), _key(key) {}
+			//iterator -> const_iterator
+			template <typename R>
+			RadixIterator(const RadixIterator<T, R>& copy) : _root(copy.root()), _node(copy.base()), _key(copy.key()) {}
+
+			node_type* base() const
+			{
+				return (_node);
+			}
+			node_type* root() const
+			{
+				return (_root);
+			}
+			const std::string& key() const
+			{
+				return (_key);
+			}
+
+			reference operator*() const
+			{
+				return (reference(_key, *_node->value));
+			}
+			pointer operator->() const
+			{
+				return (pointer(operator*()));
+			}
+
+			RadixIterator& operator++()
+			{
+				node_type* n = _node;
+				node_type* c = n->child_from(0);
+				if (c != NULL)
+				{
+					_key += c->prefix;
+					_node = node_type::first_in(c, _key);
+					return (*this);
+				}
+				while (n != _root)
+				{
+					node_type* p = n->parent;
+					node_type* s = p->child_from(n->first_byte() + 1u);
+					_key.erase(_key.size() - n->prefix.size());
+					if (s != NULL)
+					{
+						_key += s->prefix;
+						_node = node_type::first_in(s, _key);
+						return (*this);
+					}
+					n = p;
+				}
+				_node = NULL;
+				_key.clear();
+				return (*this);
+			}
+			RadixIterator operator++(int)
+			{
+				RadixIterator tmp(*this);
+				++(*this);
+				return (tmp);
+			}
+
+			//end()에서 감소하면 마지막 요소로 간다.
+			RadixIterator& operator--()
+			{
+				if (_node == NULL)
+				{
+					_key.clear();
+					_node = node_type::last_in(_root, _key);
+					return (*this);
+				}
+				node_type* n = _node;
+				while (n != _root)
+				{
+					node_type* p = n->parent;
+					node_type* s = p->child_before(n->first_byte());
+					_key.erase(_key.size() - n->prefix.size());
+					if (s != NULL)
+					{
+						_key += s->prefix;
+						_node = node_type::last_in(s, _key);
+						return (*this);
+					}
+					if (p->value != NULL)
+					{
+						_node = p;
+						return (*this);
+					}
+					n = p;
+				}
+				_node = NULL;
+				return (*this);
+			}
+			RadixIterator operator--(int)
+			{
+				RadixIterator tmp(*this);
+				--(*this);
+				return (tmp);
+			}
+
+			template <typename R>
+			bool operator==(const RadixIterator<T, R>& other) const
+			{
+				return (_node == other.base());
+			}
+			template <typename R>
+			bool operator!=(const RadixIterator<T, R>& other) const
+			{
+				return (_node != other.base());
+			}
+	};
+
+	/**
+	 * @brief radix_map class
+	 *
+	 * std::string key 전용 ordered map. (prefix-compressed adaptive radix tree)
+	 * URL, 파일 경로처럼 긴 공통 prefix를 가진 key에서 ft::map<std::string, T>를 대신한다.
+	 *
+	 * ft::map과 비교하면
+	 * - 공통 prefix는 한 번만 저장된다. (노드마다 key 전체를 복사하지 않는다.)
+	 * - 탐색할 때 key의 각 byte를 한 번씩만 확인한다. (map은 노드마다 key를 처음부터 비교한다.) -> O(key 길이)
+	 * - key 순서는 std::string의 비교(byte 단위 사전순)와 같으므로 iteration / lower_bound / upper_bound 결과가 map과 같다.
+	 * - prefix_range로 어떤 prefix로 시작하는 key들의 범위를 바로 얻을 수 있다.
+	 *
+	 * iterator가 key를 들고 다니므로 역참조 결과는 pair&가 아닌 (first, second) 참조 쌍이다. (radix_reference)
+	 * 다른 요소를 삽입/삭제해도 iterator는 유효하다.
+	 *
+	 * @tparam T		Type of the mapped value.(mapped_type)
+	 * @tparam Alloc	Type of the allocator object used to define the storage allocation model.(allocator_type)
+	 */
+	template < class T, class Alloc = std::allocator<T> >
+	class radix_map
+	{
+		public:
+			/**
+			 * @brief Member types
+			 */
+			typedef std::string									key_type;
+			typedef T											mapped_type;
+			typedef ft::pair<const std::string, T>				value_type;
+			typedef Alloc										allocator_type;
+			typedef ft::RadixIterator<T, T&>					iterator;
+			typedef ft::RadixIterator<T, const T&>				const_iterator;
+			typedef typename allocator_type::difference_type	difference_type;
+			typedef typename allocator_type::size_type			size_type;
+			typedef ft::RadixNode<T>							node_type;
+			typedef typename Alloc::template rebind<node_type>::other		node_allocator_type;
+			typedef typename Alloc::template rebind<node_type*>::other		ptr_allocator_type;
+			typedef typename Alloc::template rebind<unsigned char>::other	byte_allocator_type;
+
+		private:
+			allocator_type		_alloc;
+			node_allocator_type	_node_alloc;
+			ptr_allocator_type	_ptr_alloc;
+			byte_allocator_type	_byte_alloc;
+			node_type*			_root;
+			size_type			_size;
+
+		public:
+			/**
+			 * @brief Member functions
+			 */
+			explicit radix_map(const allocator_type& alloc = allocator_type())
+				: _alloc(alloc), _node_alloc(alloc), _ptr_alloc(alloc), _byte_alloc(alloc), _root(NULL), _size(0)
+			{
+				_root = make_node(std::string());
+			}
+
+			template <class InputIterator>
+			radix_map(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+				: _alloc(alloc), _node_alloc(alloc), _ptr_alloc(alloc), _byte_alloc(alloc), _root(NULL), _size(0)
+			{
+				_root = make_node(std::string());
+				insert(first, last);
+			}
+
+			radix_map(const radix_map& x)
+				: _alloc(x._alloc), _node_alloc(x._node_alloc), _ptr_alloc(x._ptr_alloc), _byte_alloc(x._byte_alloc), _root(NULL), _size(0)
+			{
+				_root = make_node(std::string());
+				*this = x;
+			}
+
+			~radix_map()
+			{
+				destroy_subtree(_root);
+			}
+
+			//tree 모양을 그대로 복제한다.
+			radix_map& operator=(const radix_map& x)
+			{
+				if (this != &x)
+				{
+					clear();
+					if (x._root->value != NULL)
+						_root->value = make_value(*x._root->value);
+					for (node_type* c = x._root->child_from(0); c != NULL; c = x._root->child_from(c->first_byte() + 1u))
+						add_child(_root, clone(c));
+					_size = x._size;
+				}
+				return (*this);
+			}
+
+			//Iterators
+			iterator begin()
+			{
+				std::string key;
+				return (iterator(_root, node_type::first_in(_root, key), key));
+			}
+			const_iterator begin() const
+			{
+				std::string key;
+				return (const_iterator(_root, node_type::first_in(_root, key), key));
+			}
+			iterator end()
+			{
+				return (iterator(_root, NULL, std::string()));
+			}
+			const_iterator end() const
+			{
+				return (const_iterator(_root, NULL, std::string()));
+			}
+
+			//Capacity
+			bool empty() const
+			{
+				return (_size == 0);
+			}
+			size_type size() const
+			{
+				return (_size);
+			}
+			size_type max_size() const
+			{
+				return (_node_alloc.max_size());
+			}
+
+			//Element access
+			mapped_type& operator[](const key_type& k)
+			{
+				return (*insert_node(k, mapped_type()).first->value);
+			}
+
+			/**
+			 * @brief Modifiers
+			 *
+			 * insert
+			 * key의 byte를 따라 내려가다가
+			 * - 해당 byte로 시작하는 자식이 없으면 남은 key 전체를 prefix로 하는 leaf를 붙인다.
+			 * - 자식의 prefix 중간에서 key와 달라지면 그 위치에서 자식을 둘로 나눈다. (split)
+			 * 이미 같은 key가 있으면 map과 같이 삽입하지 않고 기존 요소를 반환한다.
+			 */
+			ft::pair<iterator, bool> insert(const value_type& val)
+			{
+				ft::pair<node_type*, bool> res = insert_node(val.first, val.second);
+				return (ft::make_pair(iterator(_root, res.first, val.first), res.second));
+			}
+
+			//hint는 사용하지 않는다. (key 길이만큼만 내려가므로 hint로 줄일 비교가 없다.)
+			iterator insert(iterator position, const value_type& val)
+			{
+				(void)position;
+				return (insert(val).first);
+			}
+
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last,
+			typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL)
+			{
+				for (; first != last; ++first)
+					insert_node((*first).first, (*first).second);
+			}
+
+			/**
+			 * @brief erase
+			 *
+			 * 값을 지운 뒤, 값도 자식도 없는 노드는 부모에서 떼어내고
+			 * 값이 없고 자식이 하나만 남은 노드는 자식과 합친다. (자식 노드가 남으므로 다른 iterator는 유효하다.)
+			 */
+			void erase(iterator position)
+			{
+				erase_node(position.base());
+			}
+
+			size_type erase(const key_type& k)
+			{
+				node_type* node = find_node(k);
+				if (node == NULL)
+					return (0);
+				erase_node(node);
+				return (1);
+			}
+
+			void erase(iterator first, iterator last)
+			{
+				while (first != last)
+					erase(first++);
+			}
+
+			void swap(radix_map& x)
+			{
+				swap_value(_alloc, x._alloc);
+				swap_value(_node_alloc, x._node_alloc);
+				swap_value(_ptr_alloc, x._ptr_alloc);
+				swap_value(_byte_alloc, x._byte_alloc);
+				swap_value(_root, x._root);
+				swap_value(_size, x._size);
+			}
+
+			void clear()
+			{
+				for (node_type* c = _root->child_from(0); c != NULL; c = _root->child_from(0))
+				{
+					remove_child(_root, c);
+					destroy_subtree(c);
+				}
+				if (_root->value != NULL)
+					destroy_value(_root);
+				_size = 0;
+			}
+
+			//Operations
+			//key의 byte를 prefix 단위로 한 번씩만 비교한다.
+			iterator find(const key_type& k)
+			{
+				node_type* node = find_node(k);
+				return (node != NULL ? iterator(_root, node, k) : end());
+			}
+			const_iterator find(const key_type& k) const
+			{
+				node_type* node = find_node(k);
+				return (node != NULL ? const_iterator(_root, node, k) : end());
+			}
+
+			size_type count(const key_type& k) const
+			{
+				return (find_node(k) != NULL ? 1 : 0);
+			}
+
+			//k 이상인 첫 번째 key
+			iterator lower_bound(const key_type& k)
+			{
+				std::string key;
+				node_type* node = lower_node(_root, k, 0, key);
+				return (iterator(_root, node, node != NULL ? key : std::string()));
+			}
+			const_iterator lower_bound(const key_type& k) const
+			{
+				std::string key;
+				node_type* node = lower_node(_root, k, 0, key);
+				return (const_iterator(_root, node, node != NULL ? key : std::string()));
+			}
+
+			//k보다 큰 첫 번째 key
+			iterator upper_bound(const key_type& k)
+			{
+				iterator it = lower_bound(k);
+				if (it != end() && it.key() == k)
+					++it;
+				return (it);
+			}
+			const_iterator upper_bound(const key_type& k) const
+			{
+				const_iterator it = lower_bound(k);
+				if (it != end() && it.key() == k)
+					++it;
+				return (it);
+			}
+
+			ft::pair<iterator, iterator> equal_range(const key_type& k)
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+			ft::pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+			{
+				return (ft::make_pair(lower_bound(k), upper_bound(k)));
+			}
+
+			/**
+			 * @brief prefix_range
+			 *
+			 * prefix로 시작하는 모든 key의 범위 [first, last)를 반환한다.
+			 * last는 prefix 다음 문자열("/api/" -> "/api0")의 lower_bound이다.
+			 */
+			ft::pair<iterator, iterator> prefix_range(const key_type& prefix)
+			{
+				std::string next(prefix);
+				while (!next.empty() && static_cast<unsigned char>(next[next.size() - 1]) == 0xFF)
+					next.erase(next.size() - 1);
+				if (next.empty())
+					return (ft::make_pair(lower_bound(prefix), end()));
+				++next[next.size() - 1];
+				return (ft::make_pair(lower_bound(prefix), lower_bound(next)));
+			}
+			ft::pair<const_iterator, const_iterator> prefix_range(const key_type& prefix) const
+			{
+				ft::pair<iterator, iterator> r = const_cast<radix_map*>(this)->prefix_range(prefix);
+				return (ft::make_pair(const_iterator(r.first), const_iterator(r.second)));
+			}
+
+			allocator_type get_allocator() const
+			{
+				return (_alloc);
+			}
+
+		private:
+			node_type* make_node(const std::string& prefix)
+			{
+				node_type* res = _node_alloc.allocate(1);
+				_node_alloc.construct(res, node_type(prefix));
+				return (res);
+			}
+
+			T* make_value(const T& val)
+			{
+				T* res = _alloc.allocate(1);
+				_alloc.construct(res, val);
+				return (res);
+			}
+
+			void destroy_value(node_type* node)
+			{
+				_alloc.destroy(node->value);
+				_alloc.deallocate(node->value, 1);
+				node->value = NULL;
+			}
+
+			void free_children(node_type* node)
+			{
+				if (node->capacity == 0)
+					return ;
+				_ptr_alloc.deallocate(node->children, node->capacity);
+				if (node->bytes != NULL)
+					_byte_alloc.deallocate(node->bytes, node->capacity);
+				node->children = NULL;
+				node->bytes = NULL;
+				node->capacity = 0;
+			}
+
+			void destroy_node(node_type* node)
+			{
+				if (node->value != NULL)
+					destroy_value(node);
+				free_children(node);
+				_node_alloc.destroy(node);
+				_node_alloc.deallocate(node, 1);
+			}
+
+			void destroy_subtree(node_type* node)
+			{
+				node_type* c = node->child_from(0);
+				while (c != NULL)
+				{
+					node_type* next = node->child_from(c->first_byte() + 1u);
+					destroy_subtree(c);
+					c = next;
+				}
+				destroy_node(node);
+			}
+
+			node_type* clone(const node_type* src)
+			{
+				node_type* res = make_node(src->prefix);
+				if (src->value != NULL)
+					res->value = make_value(*src->value);
+				for (node_type* c = src->child_from(0); c != NULL; c = src->child_from(c->first_byte() + 1u))
+					add_child(res, clone(c));
+				return (res);
+			}
+
+			//자식 배열의 크기를 바꾼다. (정렬 배열 <-> 256칸 배열)
+			void resize_children(node_type* node, unsigned short capacity)
+			{
+				node_type** children = _ptr_alloc.allocate(capacity);
+				unsigned char* bytes = NULL;
+				unsigned short n = 0;
+				if (capacity == node_type::DIRECT)
+					std::memset(children, 0, sizeof(node_type*) * capacity);
+				else
+					bytes = _byte_alloc.allocate(capacity);
+				for (node_type* c = node->child_from(0); c != NULL; c = node->child_from(c->first_byte() + 1u))
+				{
+					if (bytes == NULL)
+						children[c->first_byte()] = c;
+					else
+					{
+						bytes[n] = c->first_byte();
+						children[n] = c;
+					}
+					++n;
+				}
+				free_children(node);
+				node->children = children;
+				node->bytes = bytes;
+				node->capacity = capacity;
+			}
+
+			void add_child(node_type* node, node_type* child)
+			{
+				unsigned char c = child->first_byte();
+				child->parent = node;
+				if (node->count == node->capacity)
+					resize_children(node, node->capacity == 0 ? 4 : (node->capacity == 4 ? 16 : node_type::DIRECT));
+				if (node->capacity == node_type::DIRECT)
+					node->children[c] = child;
+				else
+				{
+					unsigned short i = node->count;
+					for (; i > 0 && node->bytes[i - 1] > c; --i)
+					{
+						node->bytes[i] = node->bytes[i - 1];
+						node->children[i] = node->children[i - 1];
+					}
+					node->bytes[i] = c;
+					node->children[i] = child;
+				}
+				++node->count;
+			}
+
+			void remove_child(node_type* node, node_type* child)
+			{
+				node_type** s = node->slot(child->first_byte());
+				if (node->capacity == node_type::DIRECT)
+					*s = NULL;
+				else
+				{
+					unsigned short i = static_cast<unsigned short>(s - node->children);
+					for (; i + 1 < node->count; ++i)
+					{
+						node->bytes[i] = node->bytes[i + 1];
+						node->children[i] = node->children[i + 1];
+					}
+				}
+				--node->count;
+				if (node->count == 0)
+					free_children(node);
+				else if (node->capacity == node_type::DIRECT && node->count <= 12)
+					resize_children(node, 16);
+			}
+
+			node_type* find_node(const key_type& k) const
+			{
+				node_type* node = _root;
+				size_t pos = 0;
+				while (pos < k.size())
+				{
+					node = node->child(static_cast<unsigned char>(k[pos]));
+					if (node == NULL)
+						return (NULL);
+					const std::string& p = node->prefix;
+					if (k.size() - pos < p.size() || std::memcmp(k.data() + pos + 1, p.data() + 1, p.size() - 1) != 0)
+						return (NULL);
+					pos += p.size();
+				}
+				return (node->value != NULL ? node : NULL);
+			}
+
+			ft::pair<node_type*, bool> insert_node(const key_type& k, const mapped_type& val)
+			{
+				node_type* node = _root;
+				size_t pos = 0;
+				while (pos < k.size())
+				{
+					node_type* child = node->child(static_cast<unsigned char>(k[pos]));
+					if (child == NULL)
+					{
+						child = make_node(k.substr(pos));
+						add_child(node, child);
+						node = child;
+						break;
+					}
+					const std::string& p = child->prefix;
+					size_t lim = (p.size() < k.size() - pos) ? p.size() : k.size() - pos;
+					size_t i = 1;
+					while (i < lim && p[i] == k[pos + i])
+						++i;
+					if (i < p.size())
+					{	//child의 prefix를 i에서 나눈다. -> node - mid(prefix[0, i)) - child(prefix[i, ))
+						node_type* mid = make_node(p.substr(0, i));
+						*node->slot(child->first_byte()) = mid;
+						mid->parent = node;
+						child->prefix.erase(0, i);
+						add_child(mid, child);
+						child = mid;
+					}
+					pos += i;
+					node = child;
+				}
+				if (node->value != NULL)
+					return (ft::make_pair(node, false));
+				node->value = make_value(val);
+				++_size;
+				return (ft::make_pair(node, true));
+			}
+
+			void erase_node(node_type* node)
+			{
+				destroy_value(node);
+				--_size;
+				while (node != _root && node->value == NULL && node->count == 0)
+				{
+					node_type* parent = node->parent;
+					remove_child(parent, node);
+					destroy_node(node);
+					node = parent;
+				}
+				if (node != _root && node->value == NULL && node->count == 1)
+				{	//자식 하나만 남은 노드는 자식 쪽으로 합친다.
+					node_type* child = node->child_from(0);
+					child->prefix.insert(0, node->prefix);
+					*node->parent->slot(node->first_byte()) = child;
+					child->parent = node->parent;
+					destroy_node(node);
+				}
+			}
+
+			/**
+			 * @brief lower_node
+			 *
+			 * node까지의 경로가 k[0, pos)와 같을 때, node의 서브트리에서 k 이상인 첫 번째 값 노드를 찾는다.
+			 * 서브트리에 없으면 NULL을 반환하고 호출한 쪽이 다음 형제에서 찾는다.
+			 * key에는 찾은 노드까지의 경로가 들어간다.
+			 */
+			static node_type* lower_node(node_type* node, const key_type& k, size_t pos, std::string& key)
+			{
+				if (pos == k.size())
+					return (node_type::first_in(node, key));
+				//node의 값은 k의 prefix이므로 k보다 작다.
+				unsigned char c = static_cast<unsigned char>(k[pos]);
+				node_type* child = node->child(c);
+				if (child != NULL)
+				{
+					const std::string& p = child->prefix;
+					size_t lim = (p.size() < k.size() - pos) ? p.size() : k.size() - pos;
+					size_t i = 1;
+					while (i < lim && p[i] == k[pos + i])
+						++i;
+					key += p;
+					if (i < lim)
+					{
+						if (static_cast<unsigned char>(p[i]) > static_cast<unsigned char>(k[pos + i]))
+							return (node_type::first_in(child, key));
+					}
+					else if (lim < p.size())
+						return (node_type::first_in(child, key));	//k가 prefix 중간에서 끝났다. -> child의 모든 key가 k보다 크다.
+					else
+					{
+						node_type* res = lower_node(child, k, pos + p.size(), key);
+						if (res != NULL)
+							return (res);
+					}
+					key.erase(key.size() - p.size());
+				}
+				node_type* next = node->child_from(c + 1u);
+				if (next == NULL)
+					return (NULL);
+				key += next->prefix;
+				return (node_type::first_in(next, key));
+			}
+
+			template <typename U>
+			static void swap_value(U& a, U& b)
+			{
+				U tmp(a);
+				a = b;
+				b = tmp;
+			}
+	};
+
+	/**
+	 * @brief Relational operators
+	 */
+	template <class T, class Alloc>
+	bool operator==(const radix_map<T, Alloc>& lhs, const radix_map<T, Alloc>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		typename radix_map<T, Alloc>::const_iterator r = rhs.begin();
+		for (typename radix_map<T, Alloc>::const_iterator l = lhs.begin(); l != lhs.end(); ++l, ++r)
+			if (l->first != r->first || !(l->second == r->second))
+				return (false);
+		return (true);
+	}
+
+	template <class T, class Alloc>
+	bool operator!=(const radix_map<T, Alloc>& lhs, const radix_map<T, Alloc>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	// swap
+	template <class T, class Alloc>
+	void swap(radix_map<T, Alloc>& x, radix_map<T, Alloc>& y)
+	{
+		x.swap(y);
+	}
+} // namespace ft
+
+#endif
@@ -0,0 +1,501 @@
+#ifndef SEGMENTED_STACK_HPP
+# define SEGMENTED_STACK_HPP
+
+#include <memory>
+#include <stdexcept>
+#include "stack.hpp"
+
+/**
+ * @brief segmented_storage
+ *
+ * 고정 크기 chunk를 이중 연결 리스트로 이어붙인 sequence container. (뒤쪽에서만 넣고 뺀다)
+ * stack의 Container로 사용하기 위해 만들었다.
+ *
+ * vector를 stack의 Container로 쓰면 capacity가 가득 찰 때마다 reserve가 새 배열을 할당하고 모든 요소를 복사한다.
+ * -> 요소가 많을수록 한 번의 push가 오래 걸리고(latency spike), 그때마다 top()에 대한 참조/포인터가 무효화된다.
+ * segmented_storage는 chunk가 가득 차면 새 chunk 하나만 이어붙이기 때문에
+ * - 기존 요소는 절대 이동하지 않는다. -> pop 하기 전까지 요소의 주소가 유지된다.
+ * - push는 최악의 경우에도 chunk 하나 할당 + construct 한 번 -> O(1)
+ *
+ * chunk 경계에서 push/pop을 반복할 때 할당/해제가 반복되지 않도록(thrash) 비워진 chunk 하나는 spare로 남겨둔다.
+ * spare는 항상 _back->next 에 연결되어 있고, shrink_to_fit으로 반환할 수 있다.
+ *
+ * 불변 조건
+ * - _back은 마지막 요소가 들어있는 chunk이다. 비어있는 _back은 _first일 때만 허용된다.
+ * - _end는 _back 안에서 마지막 요소의 다음 위치이다.
+ *
+ * @tparam T			Type of the elements.
+ * @tparam Alloc		Type of the allocator object used to define the storage allocation model.
+ * @tparam ChunkSize	Number of elements per chunk. 0이면 chunk 하나가 약 4KB가 되도록 정한다.
+ */
+namespace ft
+{
+	template <typename T, typename Alloc, size_t ChunkSize>
+	class segmented_storage;
+
+	template <typename T>
+	struct SegmentedChunk
+	{
+		SegmentedChunk*	prev;
+		SegmentedChunk*	next;
+		T*				data;
+	};
+
+	/**
+	 * @brief SegmentedIterator
+	 *
+	 * chunk 포인터와 chunk 안의 위치를 함께 가지는 bidirectional iterator
+	 * chunk의 끝에 도달하면 다음 chunk가 있을 때만 다음 chunk의 처음으로 넘어간다.
+	 * -> segmented_storage::end()도 같은 규칙으로 만들기 때문에, 마지막 chunk가 가득 차 있어도 end()와 비교할 수 있다.
+	 */
+	template <typename T, typename Pointer, typename Reference, size_t ChunkSize>
+	class SegmentedIterator : public ft::iterator<ft::bidirectional_iterator_tag, T, ptrdiff_t, Pointer, Reference>
+	{
+		public:
+			typedef T			value_type;
+			typedef Pointer		pointer;
+			typedef Reference	reference;
+			typedef ptrdiff_t	difference_type;
+			typedef ft::bidirectional_iterator_tag	iterator_category;
+			typedef SegmentedChunk<T>	chunk_type;
+
+		protected:
+			chunk_type*	_chunk;
+			T*			_ptr;
+
+		public:
+			SegmentedIterator(chunk_type* chunk = NULL, T* ptr = NULL) : _chunk(chunk), _ptr(ptr)
+			{
+				normalize();
+			}
+
+			SegmentedIterator(const SegmentedIterator<T, T*, T&, ChunkSize>& copy) : _chunk(copy.chunk()), _ptr(copy.base()) {}
+
+			SegmentedIterator& operator=(const SegmentedIterator& copy)
+			{
+				if (this != &copy)
+				{
+					this->_chunk = copy.chunk();
+					this->_ptr = copy.base();
+				}
+				return (*this);
+			}
+
+			chunk_type* chunk() const
+			{
+				return (this->_chunk);
+			}
+
+			T* base() const
+			{
+				return (this->_ptr);
+			}
+
+			reference operator*() const
+			{
+				return (*this->_ptr);
+			}
+
+			pointer operator->() const
+			{
+				return (this->_ptr);
+			}
+
+			SegmentedIterator& operator++()
+			{
+				++this->_ptr;
+				normalize();
+				return (*this);
+			}
+
+			SegmentedIterator operator++(int)
+			{
+				SegmentedIterator tmp = *this;
+				++(*this);
+				return (tmp);
+			}
+
+			SegmentedIterator& operator--()
+			{
+				if (this->_ptr == this->_chunk->data)
+				{
+					this->_chunk = this->_chunk->prev;
+					this->_ptr = this->_chunk->data + ChunkSize;
+				}
+				--this->_ptr;
+				return (*this);
+			}
+
+			SegmentedIterator operator--(int)
+			{
+				SegmentedIterator tmp = *this;
+				--(*this);
+				return (tmp);
+			}
+
+			template <typename P, typename R>
+			bool operator==(const SegmentedIterator<T, P, R, ChunkSize>& iter) const
+			{
+				return (this->_ptr == iter.base());
+			}
+
+			template <typename P, typename R>
+			bool operator!=(const SegmentedIterator<T, P, R, ChunkSize>& iter) const
+			{
+				return (this->_ptr != iter.base());
+			}
+
+		private:
+			void normalize()
+			{
+				if (this->_chunk != NULL && this->_ptr == this->_chunk->data + ChunkSize && this->_chunk->next != NULL)
+				{
+					this->_chunk = this->_chunk->next;
+					this->_ptr = this->_chunk->data;
+				}
+			}
+	};
+
+	template < typename T, typename Alloc = std::allocator<T>, size_t ChunkSize = 0 >
+	class segmented_storage
+	{
+		public:
+			static const size_t chunk_size = ChunkSize != 0 ? ChunkSize : (sizeof(T) < 256 ? 4096 / sizeof(T) : 16);
+
+			typedef T			value_type;
+			typedef Alloc		allocator_type;
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+			typedef typename allocator_type::size_type			size_type;
+			typedef typename allocator_type::difference_type	difference_type;
+			typedef ft::SegmentedIterator<T, T*, T&, chunk_size>				iterator;
+			typedef ft::SegmentedIterator<T, const T*, const T&, chunk_size>	const_iterator;
+			typedef ft::reverse_iterator<iterator>				reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+			typedef SegmentedChunk<T>							chunk_type;
+			typedef typename Alloc::template rebind<chunk_type>::other	chunk_allocator_type;
+
+		private:
+			allocator_type			_alloc;
+			chunk_allocator_type	_chunk_alloc;
+			chunk_type*				_first;
+			chunk_type*				_back;
+			pointer					_end;
+			size_type				_size;
+
+		public:
+			explicit segmented_storage(const allocator_type& alloc = allocator_type())
+			: _alloc(alloc), _chunk_alloc(chunk_allocator_type(alloc)), _first(NULL), _back(NULL), _end(NULL), _size(0) {}
+
+			segmented_storage(const segmented_storage& x)
+			: _alloc(x._alloc), _chunk_alloc(chunk_allocator_type(x._alloc)), _first(NULL), _back(NULL), _end(NULL), _size(0)
+			{
+				for (const_iterator it = x.begin(); it != x.end(); ++it)
+					push_back(*it);
+			}
+
+			~segmented_storage()
+			{
+				clear();
+				release_chunks(this->_first);
+			}
+
+			segmented_storage& operator=(const segmented_storage& x)
+			{
+				if (this != &x)
+				{
+					clear();
+					for (const_iterator it = x.begin(); it != x.end(); ++it)
+						push_back(*it);
+				}
+				return (*this);
+			}
+
+			//Iterators
+			iterator begin()
+			{
+				return (iterator(this->_first, this->_first ? this->_first->data : NULL));
+			}
+
+			const_iterator begin() const
+			{
+				return (const_iterator(this->_first, this->_first ? this->_first->data : NULL));
+			}
+
+			iterator end()
+			{
+				return (iterator(this->_back, this->_end));
+			}
+
+			const_iterator end() const
+			{
+				return (const_iterator(this->_back, this->_end));
+			}
+
+			reverse_iterator rbegin()
+			{
+				return (reverse_iterator(end()));
+			}
+
+			const_reverse_iterator rbegin() const
+			{
+				return (const_reverse_iterator(end()));
+			}
+
+			reverse_iterator rend()
+			{
+				return (reverse_iterator(begin()));
+			}
+
+			const_reverse_iterator rend() const
+			{
+				return (const_reverse_iterator(begin()));
+			}
+
+			//Capacity
+			bool empty() const
+			{
+				return (this->_size == 0);
+			}
+
+			size_type size() const
+			{
+				return (this->_size);
+			}
+
+			size_type max_size() const
+			{
+				return (this->_alloc.max_size());
+			}
+
+			//할당되어 있는 chunk(spare 포함)에 들어갈 수 있는 요소의 수
+			size_type capacity() const
+			{
+				size_type n = 0;
+				for (chunk_type* c = this->_first; c != NULL; c = c->next)
+					n += chunk_size;
+				return (n);
+			}
+
+			//spare chunk를 반환한다.
+			void shrink_to_fit()
+			{
+				if (this->_back != NULL)
+				{
+					release_chunks(this->_back->next);
+					this->_back->next = NULL;
+				}
+				if (this->_size == 0)
+				{
+					release_chunks(this->_first);
+					this->_first = NULL;
+					this->_back = NULL;
+					this->_end = NULL;
+				}
+			}
+
+			//Element access
+			reference front()
+			{
+				return (*this->_first->data);
+			}
+
+			const_reference front() const
+			{
+				return (*this->_first->data);
+			}
+
+			reference back()
+			{
+				return (*(this->_end - 1));
+			}
+
+			const_reference back() const
+			{
+				return (*(this->_end - 1));
+			}
+
+			//Modifiers
+			//construct가 예외를 던져도 불변 조건이 깨지지 않도록 다음 chunk에 먼저 생성한 후 _back/_end를 옮긴다.
+			//(새로 만든 chunk는 spare로 남는다.)
+			void push_back(const value_type& val)
+			{
+				if (this->_first == NULL)
+				{
+					this->_first = make_chunk(NULL);
+					this->_back = this->_first;
+					this->_end = this->_first->data;
+				}
+				if (this->_end == this->_back->data + chunk_size)
+				{
+					if (this->_back->next == NULL)
+						this->_back->next = make_chunk(this->_back);
+					chunk_type* next = this->_back->next;
+					this->_alloc.construct(next->data, val);
+					this->_back = next;
+					this->_end = next->data + 1;
+				}
+				else
+				{
+					this->_alloc.construct(this->_end, val);
+					++this->_end;
+				}
+				++this->_size;
+			}
+
+			void pop_back()
+			{
+				this->_alloc.destroy(--this->_end);
+				--this->_size;
+				if (this->_end == this->_back->data && this->_back->prev != NULL)
+				{
+					//비워진 _back을 spare로 남기고, 그 전에 있던 spare는 반환한다.
+					release_chunks(this->_back->next);
+					this->_back->next = NULL;
+					this->_back = this->_back->prev;
+					this->_end = this->_back->data + chunk_size;
+				}
+			}
+
+			//요소만 제거하고 chunk는 남겨둔다.
+			void clear()
+			{
+				while (this->_size != 0)
+					pop_back();
+			}
+
+			void swap(segmented_storage& x)
+			{
+				swap_value(this->_alloc, x._alloc);
+				swap_value(this->_chunk_alloc, x._chunk_alloc);
+				swap_value(this->_first, x._first);
+				swap_value(this->_back, x._back);
+				swap_value(this->_end, x._end);
+				swap_value(this->_size, x._size);
+			}
+
+			allocator_type get_allocator() const
+			{
+				return (this->_alloc);
+			}
+
+		private:
+			chunk_type* make_chunk(chunk_type* prev)
+			{
+				chunk_type* res = this->_chunk_alloc.allocate(1);
+				res->prev = prev;
+				res->next = NULL;
+				try
+				{
+					res->data = this->_alloc.allocate(chunk_size);
+				}
+				catch (...)
+				{
+					this->_chunk_alloc.deallocate(res, 1);
+					throw;
+				}
+				return (res);
+			}
+
+			//chunk부터 뒤로 연결된 chunk를 모두 반환한다. (요소는 이미 destroy 되어 있어야 한다)
+			void release_chunks(chunk_type* chunk)
+			{
+				while (chunk != NULL)
+				{
+					chunk_type* next = chunk->next;
+					this->_alloc.deallocate(chunk->data, chunk_size);
+					this->_chunk_alloc.deallocate(chunk, 1);
+					chunk = next;
+				}
+			}
+
+			template <typename _T>
+			void swap_value(_T& a, _T& b)
+			{
+				_T tmp(a);
+				a = b;
+				b = tmp;
+			}
+	};
+
+	template < typename T, typename Alloc, size_t ChunkSize >
+	const size_t segmented_storage<T, Alloc, ChunkSize>::chunk_size;
+
+	/**
+	 * @brief segmented_storage non-member function
+	 */
+	template <typename T, typename Alloc, size_t ChunkSize>
+	bool operator==(const segmented_storage<T, Alloc, ChunkSize>& lhs, const segmented_storage<T, Alloc, ChunkSize>& rhs)
+	{
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <typename T, typename Alloc, size_t ChunkSize>
+	bool operator!=(const segmented_storage<T, Alloc, ChunkSize>& lhs, const segmented_storage<T, Alloc, ChunkSize>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <typename T, typename Alloc, size_t ChunkSize>
+	bool operator<(const segmented_storage<T, Alloc, ChunkSize>& lhs, const segmented_storage<T, Alloc, ChunkSize>& rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <typename T, typename Alloc, size_t ChunkSize>
+	bool operator<=(const segmented_storage<T, Alloc, ChunkSize>& lhs, const segmented_storage<T, Alloc, ChunkSize>& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <typename T, typename Alloc, size_t ChunkSize>
+	bool operator>(const segmented_storage<T, Alloc, ChunkSize>& lhs, const segmented_storage<T, Alloc, ChunkSize>& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template <typename T, typename Alloc, size_t ChunkSize>
+	bool operator>=(const segmented_storage<T, Alloc, ChunkSize>& lhs, const segmented_storage<T, Alloc, ChunkSize>& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	template <typename T, typename Alloc, size_t ChunkSize>
+	void swap(segmented_storage<T, Alloc, ChunkSize>& x, segmented_storage<T, Alloc, ChunkSize>& y)
+	{
+		x.swap(y);
+	}
+
+	/**
+	 * @brief segmented_stack
+	 *
+	 * segmented_storage를 Container로 사용하는 stack.
+	 * push가 기존 요소를 옮기지 않으므로 top()에 대한 참조는 해당 요소를 pop 하기 전까지 유효하다.
+	 */
+	template < typename T, typename Alloc = std::allocator<T>, size_t ChunkSize = 0 >
+	class segmented_stack : public ft::stack< T, ft::segmented_storage<T, Alloc, ChunkSize> >
+	{
+		public:
+			typedef ft::stack< T, ft::segmented_storage<T, Alloc, ChunkSize> >	stack_type;
+			typedef typename stack_type::container_type	container_type;
+
+			explicit segmented_stack(const container_type& ctnr = container_type()) : stack_type(ctnr) {}
+			segmented_stack(const segmented_stack& other) : stack_type(other) {}
+			virtual ~segmented_stack() {}
+			segmented_stack& operator=(const segmented_stack& other)
+			{
+				stack_type::operator=(other);
+				return (*this);
+			}
+
+			//spare chunk를 반환한다.
+			void shrink_to_fit()
+			{
+				this->c.shrink_to_fit();
+			}
+	};
+} // namespace ft
+
+#endif
@@ -1,5 +1,5 @@
-#ifndef MAP_HPP
-# define MAP_HPP
+#ifndef SET_HPP
+# define SET_HPP
 
 #include "RBTree.hpp"
 
@@ -50,27 +50,31 @@ namespace ft
 			typedef typename allocator_type::const_pointer		const_pointer;
 			typedef typename ft::RBTreeIterator<value_type, value_type*, value_type&>	iterator;
 			typedef typename ft::RBTreeIterator<value_type, const value_type*, const value_type&>	const_iterator;
-			typedef ft::reverse_iterator<iterator>				reverse_iterator;
-			typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+			typedef ft::RBTreeReverseIterator<value_type, value_type*, value_type&>	reverse_iterator;
+			typedef ft::RBTreeReverseIterator<value_type, const value_type*, const value_type&>	const_reverse_iterator;
 			typedef typename allocator_type::difference_type	difference_type;
 			typedef typename allocator_type::size_type			size_type;
-			typedef ft::RBTree<value_type, value_compare>		rb_tree;
+			typedef ft::RBTree<value_type, value_compare, allocator_type>	rb_tree;
 			typedef ft::RBTreeNode<value_type>					node_type;
 
 		/**
 		 * @brief Member variables
 		 */
 		private:
-			allocator_type	_alloc;
 			rb_tree			_tree;
-			key_compare		_comp;
+
+			//비교 함수 객체는 tree가 하나만 가진다.
+			const key_compare& comp() const
+			{
+				return (this->_tree.get_compare());
+			}
 
 		public:
 			/**
 			 * @brief Member functions
 			 */
 			//Empty constructor
-			explicit set (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _alloc(alloc), _tree(), _comp(comp) {}
+			explicit set (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _tree(comp, alloc) {}
 
 			//Range constructor
 			//[first,last) 범위와 동일한 수의 요소로 컨테이너를 구성하고 각 요소는 해당 범위의 해당 요소로 구성한다
@@ -78,17 +82,14 @@ namespace ft
 			set (InputIterator first, InputIterator last,
 					const key_compare& comp = key_compare(),
 					const allocator_type& alloc = allocator_type(),
-					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) : _alloc(alloc), _tree(), _comp(comp)
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) : _tree(comp, alloc)
 			{
 				insert(first, last);
 			}
 
 			//Copy constructor
 			//x에 있는 각 요소의 복사본을 사용하여 컨테이너를 구성한다
-			set (const set& x) : _alloc(x._alloc), _tree(), _comp(x._comp)
-			{
-				*this = x;
-			}
+			set (const set& x) : _tree(x._tree) {}
 
 			//Destructor
 			~set() {}
@@ -97,7 +98,7 @@ namespace ft
 			set& operator=(const set& x)
 			{
 				if (this != &x)
-					this->_tree.copy(x._tree);
+					this->_tree = x._tree;
 				return *this;
 			}
 
@@ -122,20 +123,20 @@ namespace ft
 
 			reverse_iterator rbegin()
 			{
-				return reverse_iterator(this->_tree.get_end());
+				return reverse_iterator(this->_tree.get_last());
 			}
 			const_reverse_iterator rbegin() const
 			{
-				return const_reverse_iterator(this->_tree.get_end());
+				return const_reverse_iterator(this->_tree.get_last());
 			}
 
 			reverse_iterator rend()
 			{
-				return reverse_iterator(this->_tree.get_begin());
+				return reverse_iterator(this->_tree.get_end());
 			}
 			const_reverse_iterator rend() const
 			{
-				return const_reverse_iterator(this->_tree.get_begin());
+				return const_reverse_iterator(this->_tree.get_end());
 			}
 
 			//Capacity
@@ -152,6 +153,22 @@ namespace ft
 				return (this->_tree.max_size());
 			}
 
+			//노드를 미리 할당한다. (map::reserve 참고)
+			void reserve(size_type n)
+			{
+				this->_tree.reserve(n);
+			}
+
+			size_type node_capacity() const
+			{
+				return (this->_tree.node_capacity());
+			}
+
+			void shrink_to_fit()
+			{
+				this->_tree.shrink_to_fit();
+			}
+
 			/**
 			 * @brief Element access
 			 *
@@ -167,7 +184,7 @@ namespace ft
 			 */
 			// mapped_type& operator[](const key_type& k)
 			// {
-			// 	return (*(_tree.insert(ft::make_pair(k, mapped_type())).first)).value->second;
+			// 	return (*(_tree.insert(ft::make_pair(k, mapped_type())).first)).value.second;
 			// }
 
 			/**
@@ -260,6 +277,18 @@ namespace ft
 					erase(first++);
 			}
 
+			/**
+			 * @brief erase_if
+			 *
+			 * pred(value)가 true인 요소를 모두 지우고 지운 수를 반환한다. 동일한 이름의 non-member function이 이 함수를 부른다.
+			 * erase를 반복하는 것과 달리 한 번의 순회로 끝나고, 대부분을 지울 때는 tree를 다시 조립한다. (RBTree::erase_if 참고)
+			 */
+			template <class Predicate>
+			size_type erase_if(Predicate pred)
+			{
+				return (this->_tree.erase_if(pred));
+			}
+
 			/**
 			 * @brief swap
 			 *
@@ -281,6 +310,12 @@ namespace ft
 				this->_tree.clear();
 			}
 
+			//모든 노드를 하나의 연속된 메모리로 key 순서대로 옮긴다. 모든 iterator가 무효화된다. (map::compact 참고)
+			void compact()
+			{
+				this->_tree.compact();
+			}
+
 			//Observers
 			/**
 			 * @brief key_comp == value_comp
@@ -295,12 +330,12 @@ namespace ft
 			 */
 			key_compare key_comp() const
 			{
-				return (key_compare());
+				return (comp());
 			}
 
 			value_compare value_comp() const
 			{
-				return (value_compare());
+				return (this->_tree.get_compare());
 			}
 
 			//Operations
@@ -326,6 +361,45 @@ namespace ft
 				return (const_iterator(this->_tree.find(value_type(k))));
 			}
 
+			/**
+			 * @brief find_batch
+			 *
+			 * keys[0..n)를 각각 find한 결과를 out[0..n)에 쓴다. (없으면 end)
+			 * 여러 key의 탐색을 번갈아 진행하면서 다음 노드를 prefetch 한다. (map::find_batch 참고)
+			 */
+			void find_batch(const key_type* keys, size_type n, iterator* out)
+			{
+				this->_tree.find_batch(keys, n, out, comp());
+			}
+
+			void find_batch(const key_type* keys, size_type n, const_iterator* out) const
+			{
+				this->_tree.find_batch(keys, n, out, comp());
+			}
+
+			/**
+			 * @brief find_sorted_batch / insert_sorted_batch
+			 *
+			 * 오름차순으로 정렬된 입력을 이전 결과 위치에서부터 찾는다. (finger search, RBTree::finger_lower_bound 참고)
+			 * m개의 정렬된 key가 O(m log n) 대신 O(m log(n/m))이 된다. 순서가 거꾸로 된 곳에서는 root부터 다시 찾으므로 느려질 뿐 결과는 find/insert와 같다.
+			 * insert_sorted_batch는 insert(first, last)처럼 이미 있는 key는 건너뛴다.
+			 */
+			void find_sorted_batch(const key_type* keys, size_type n, iterator* out)
+			{
+				this->_tree.find_sorted_batch(keys, n, out, comp());
+			}
+
+			void find_sorted_batch(const key_type* keys, size_type n, const_iterator* out) const
+			{
+				this->_tree.find_sorted_batch(keys, n, out, comp());
+			}
+
+			template <class InputIterator>
+			void insert_sorted_batch(InputIterator first, InputIterator last)
+			{
+				this->_tree.insert_sorted(first, last);
+			}
+
 			/**
 			 * @brief count
 			 *
@@ -340,7 +414,7 @@ namespace ft
 			 */
 			size_type count(const key_type& k) const
 			{
-				if (this->_tree.find(value_type(k))->value != NULL)
+				if (!this->_tree.find(value_type(k))->is_nil())
 					return (1);
 				else
 					return (0);
@@ -435,7 +509,7 @@ namespace ft
 			 */
 			allocator_type get_allocator() const
 			{
-				return (this->_alloc);
+				return (this->_tree.get_allocator());
 			}
 
 			void showTree()
@@ -491,6 +565,13 @@ namespace ft
 	{
 		x.swap(y);
 	}
+
+	// erase_if
+	template <class Key, class Compare, class Alloc, class Predicate>
+	typename set<Key, Compare, Alloc>::size_type erase_if(set<Key, Compare, Alloc>& c, Predicate pred)
+	{
+		return (c.erase_if(pred));
+	}
 } // namespace ft
 
 #endif
@@ -0,0 +1,803 @@
+#ifndef SOA_VECTOR_HPP
+# define SOA_VECTOR_HPP
+
+#include <stdexcept>
+#include "vector.hpp"
+
+/**
+ * @brief soa_vector
+ *
+ * 레코드의 필드마다 따로 연속된 배열(column)에 저장하는 sequence container. (structure of arrays)
+ *
+ * vector<Trade>는 레코드를 통째로 이어서 저장한다(array of structures). 필드 두 개만 읽는 scan도 레코드 전체를 cache로 가져오므로
+ * 96 byte 레코드에서 16 byte만 필요하면 memory bandwidth의 5/6을 버린다.
+ * soa_vector<long, double, double>은 필드마다 ft::vector를 하나씩 가지고, i번째 레코드는 모든 column의 i번째 원소이다.
+ * - column은 column<K>()로 soa_span(포인터 + 크기)을 얻어 연속된 배열 그대로 scan할 수 있다. (vectorize 되는 단순 루프에 그대로 넘길 수 있다.)
+ * - 레코드 단위로 접근할 때는 operator[], iterator가 돌려주는 soa_row proxy를 사용한다.
+ *   row.get<K>()는 K번째 column 원소의 참조이고, value_type(soa_value)으로 변환하거나 value_type을 대입할 수 있다.
+ *
+ * column은 최대 8개이다. 사용하지 않는 자리는 soa_none이고, soa_none 뒤에는 다시 column 타입이 올 수 없다.
+ * 모든 column은 항상 같은 크기와 같은 capacity를 가진다.
+ * - 원소를 추가하기 전에 soa_vector가 모든 column을 같은 capacity로 reserve 한다. (vector처럼 두 배씩)
+ *   그래서 각 column의 push_back/insert는 재할당하지 않는다.
+ * - reserve는 모든 column을 새 버퍼에 복사한 후에 한꺼번에 바꾼다. 복사가 예외를 던지면 어떤 column도 바뀌지 않는다.
+ * - push_back / insert 중 뒤쪽 column의 복사가 예외를 던지면 앞쪽 column에 넣은 원소를 다시 빼서 크기를 맞춘다.
+ *   끝에 추가하는 경우(push_back, 끝 위치의 insert, 크기를 늘리는 resize)는 예외를 던진 column도 원래 크기로 자른다.
+ *   중간에 insert 하다 예외가 나면 예외를 던진 column은 ft::vector::insert와 같이 기본 보장만 한다. (크기가 어긋날 수 있다)
+ *   원소 복사가 예외를 던지지 않는 column 타입(산술형, POD)에서는 항상 크기가 맞는다.
+ *
+ * @tparam T0 ~ T7	column 타입. 사용하지 않는 column은 soa_none
+ */
+namespace ft
+{
+	struct soa_none {};
+
+	/**
+	 * @brief soa_value
+	 *
+	 * soa_vector의 value_type. 레코드 하나의 값을 head(첫 column)와 tail(나머지 column)로 재귀적으로 가진다.
+	 * soa_value(v0, v1, ...)처럼 column 순서대로 값을 넘겨 만든다. 생략한 값은 기본값이다.
+	 */
+	template <typename T0, typename T1 = soa_none, typename T2 = soa_none, typename T3 = soa_none,
+		typename T4 = soa_none, typename T5 = soa_none, typename T6 = soa_none, typename T7 = soa_none>
+	struct soa_value
+	{
+		typedef T0	head_type;
+		typedef soa_value<T1, T2, T3, T4, T5, T6, T7, soa_none>	tail_type;
+
+		head_type	head;
+		tail_type	tail;
+
+		soa_value() : head(), tail() {}
+		soa_value(const T0& v0, const T1& v1 = T1(), const T2& v2 = T2(), const T3& v3 = T3(),
+			const T4& v4 = T4(), const T5& v5 = T5(), const T6& v6 = T6(), const T7& v7 = T7())
+		: head(v0), tail(v1, v2, v3, v4, v5, v6, v7) {}
+	};
+
+	template <>
+	struct soa_value<soa_none, soa_none, soa_none, soa_none, soa_none, soa_none, soa_none, soa_none>
+	{
+		soa_value(const soa_none& = soa_none(), const soa_none& = soa_none(), const soa_none& = soa_none(), const soa_none& = soa_none(),
+			const soa_none& = soa_none(), const soa_none& = soa_none(), const soa_none& = soa_none(), const soa_none& = soa_none()) {}
+	};
+
+	/**
+	 * @brief soa_element / soa_get
+	 *
+	 * head/tail로 이어진 구조(soa_value, soa_columns)에서 K번째 head의 타입과 참조를 얻는다.
+	 */
+	template <size_t K, typename Chain>
+	struct soa_element
+	{
+		typedef typename soa_element<K - 1, typename Chain::tail_type>::type	type;
+	};
+
+	template <typename Chain>
+	struct soa_element<0, Chain>
+	{
+		typedef typename Chain::head_type	type;
+	};
+
+	template <size_t K>
+	struct soa_get
+	{
+		template <typename Chain>
+		static typename soa_element<K, Chain>::type& get(Chain& c)
+		{
+			return (soa_get<K - 1>::get(c.tail));
+		}
+
+		template <typename Chain>
+		static const typename soa_element<K, Chain>::type& get(const Chain& c)
+		{
+			return (soa_get<K - 1>::get(c.tail));
+		}
+	};
+
+	template <>
+	struct soa_get<0>
+	{
+		template <typename Chain>
+		static typename Chain::head_type& get(Chain& c)
+		{
+			return (c.head);
+		}
+
+		template <typename Chain>
+		static const typename Chain::head_type& get(const Chain& c)
+		{
+			return (c.head);
+		}
+	};
+
+	/**
+	 * @brief soa_columns
+	 *
+	 * column마다 ft::vector를 하나씩 head/tail로 이어서 가진다.
+	 * 모든 연산은 같은 일을 head column에 하고 tail에 넘긴다. soa_none만 남은 마지막 soa_columns는 아무것도 하지 않는다.
+	 */
+	template <typename T0, typename T1 = soa_none, typename T2 = soa_none, typename T3 = soa_none,
+		typename T4 = soa_none, typename T5 = soa_none, typename T6 = soa_none, typename T7 = soa_none>
+	struct soa_columns
+	{
+		typedef ft::vector<T0>	head_type;
+		typedef soa_columns<T1, T2, T3, T4, T5, T6, T7, soa_none>	tail_type;
+		typedef soa_value<T0, T1, T2, T3, T4, T5, T6, T7>	value_type;
+		typedef size_t	size_type;
+
+		head_type	head;
+		tail_type	tail;
+
+		//head를 임시 column에 복사하고 tail이 모두 성공한 후에 바꾼다. (tail도 같은 방식이므로 실패하면 아무 column도 바뀌지 않는다.)
+		void reserve(size_type n)
+		{
+			head_type tmp;
+			tmp.reserve(n);
+			tmp.insert(tmp.end(), this->head.begin(), this->head.end());
+			this->tail.reserve(n);
+			this->head.swap(tmp);
+		}
+
+		void push_back(const value_type& val)
+		{
+			this->head.push_back(val.head);
+			try
+			{
+				this->tail.push_back(val.tail);
+			}
+			catch (...)
+			{
+				this->head.pop_back();
+				throw ;
+			}
+		}
+
+		void pop_back()
+		{
+			this->head.pop_back();
+			this->tail.pop_back();
+		}
+
+		void insert(size_type index, size_type n, const value_type& val)
+		{
+			this->head.insert(this->head.begin() + index, n, val.head);
+			try
+			{
+				this->tail.insert(index, n, val.tail);
+			}
+			catch (...)
+			{
+				this->head.erase(this->head.begin() + index, this->head.begin() + index + n);
+				throw ;
+			}
+		}
+
+		//n보다 긴 column을 n개로 자른다. 끝에 추가하다 실패한 column의 크기를 되돌릴 때 쓴다.
+		void truncate(size_type n)
+		{
+			if (this->head.size() > n)
+				this->head.erase(this->head.begin() + n, this->head.end());
+			this->tail.truncate(n);
+		}
+
+		void erase(size_type first, size_type last)
+		{
+			this->head.erase(this->head.begin() + first, this->head.begin() + last);
+			this->tail.erase(first, last);
+		}
+
+		void resize(size_type n, const value_type& val)
+		{
+			this->head.resize(n, val.head);
+			this->tail.resize(n, val.tail);
+		}
+
+		void clear()
+		{
+			this->head.clear();
+			this->tail.clear();
+		}
+
+		void swap(soa_columns& x)
+		{
+			this->head.swap(x.head);
+			this->tail.swap(x.tail);
+		}
+
+		//index번째 레코드를 val로 읽어온다.
+		void load(size_type index, value_type& val) const
+		{
+			val.head = this->head[index];
+			this->tail.load(index, val.tail);
+		}
+
+		//index번째 레코드에 val을 쓴다.
+		void store(size_type index, const value_type& val)
+		{
+			this->head[index] = val.head;
+			this->tail.store(index, val.tail);
+		}
+
+		bool equal(const soa_columns& x) const
+		{
+			return (this->head == x.head && this->tail.equal(x.tail));
+		}
+	};
+
+	template <>
+	struct soa_columns<soa_none, soa_none, soa_none, soa_none, soa_none, soa_none, soa_none, soa_none>
+	{
+		typedef soa_value<soa_none>	value_type;
+		typedef size_t	size_type;
+
+		void reserve(size_type) {}
+		void push_back(const value_type&) {}
+		void pop_back() {}
+		void insert(size_type, size_type, const value_type&) {}
+		void truncate(size_type) {}
+		void erase(size_type, size_type) {}
+		void resize(size_type, const value_type&) {}
+		void clear() {}
+		void swap(soa_columns&) {}
+		void load(size_type, value_type&) const {}
+		void store(size_type, const value_type&) {}
+		bool equal(const soa_columns&) const { return (true); }
+	};
+
+	/**
+	 * @brief soa_span
+	 *
+	 * column 하나의 연속된 원소를 가리키는 포인터와 크기. 원소를 소유하지 않는다.
+	 * soa_vector의 크기가 바뀌면(재할당) 무효화된다.
+	 */
+	template <typename T>
+	class soa_span
+	{
+		public:
+			typedef T							element_type;
+			typedef T*							pointer;
+			typedef T&							reference;
+			typedef ft::VectorIterator<T>		iterator;
+			typedef size_t						size_type;
+
+		private:
+			pointer		_data;
+			size_type	_size;
+
+		public:
+			soa_span(pointer data = NULL, size_type size = 0) : _data(data), _size(size) {}
+
+			pointer data() const
+			{
+				return (this->_data);
+			}
+
+			size_type size() const
+			{
+				return (this->_size);
+			}
+
+			bool empty() const
+			{
+				return (this->_size == 0);
+			}
+
+			reference operator[](size_type n) const
+			{
+				return (this->_data[n]);
+			}
+
+			iterator begin() const
+			{
+				return (iterator(this->_data));
+			}
+
+			iterator end() const
+			{
+				return (iterator(this->_data + this->_size));
+			}
+	};
+
+	/**
+	 * @brief soa_row
+	 *
+	 * soa_vector의 레코드 하나를 가리키는 proxy. (reference 타입)
+	 * Columns가 const이면 get<K>()가 const 참조를 돌려주고 값을 대입할 수 없다.
+	 */
+	template <size_t K, typename Columns>
+	struct soa_row_reference
+	{
+		typedef typename soa_element<K, Columns>::type::reference	type;
+	};
+
+	template <size_t K, typename Columns>
+	struct soa_row_reference<K, const Columns>
+	{
+		typedef typename soa_element<K, Columns>::type::const_reference	type;
+	};
+
+	template <typename Columns>
+	class soa_row
+	{
+		public:
+			typedef typename ft::remove_const<Columns>::type::value_type	value_type;
+			typedef size_t	size_type;
+
+		private:
+			Columns*	_columns;
+			size_type	_index;
+
+		public:
+			soa_row(Columns* columns, size_type index) : _columns(columns), _index(index) {}
+
+			//K번째 column의 원소
+			template <size_t K>
+			typename soa_row_reference<K, Columns>::type get() const
+			{
+				return (soa_get<K>::get(*this->_columns)[this->_index]);
+			}
+
+			size_type index() const
+			{
+				return (this->_index);
+			}
+
+			//레코드의 값을 복사해서 돌려준다.
+			operator value_type() const
+			{
+				value_type val;
+				this->_columns->load(this->_index, val);
+				return (val);
+			}
+
+			soa_row& operator=(const value_type& val)
+			{
+				this->_columns->store(this->_index, val);
+				return (*this);
+			}
+
+			//proxy끼리 대입하면 가리키는 레코드가 아닌 값을 복사한다.
+			soa_row& operator=(const soa_row& x)
+			{
+				return (*this = static_cast<value_type>(x));
+			}
+	};
+
+	/**
+	 * @brief soa_iterator
+	 *
+	 * soa_columns 포인터와 레코드 index를 가지는 random access iterator. 역참조하면 soa_row를 돌려준다.
+	 * pointer는 가리킬 레코드 객체가 없으므로 void이다.
+	 */
+	template <typename Columns>
+	class soa_iterator
+	{
+		public:
+			typedef typename ft::remove_const<Columns>::type::value_type	value_type;
+			typedef ptrdiff_t						difference_type;
+			typedef void							pointer;
+			typedef soa_row<Columns>				reference;
+			typedef ft::random_access_iterator_tag	iterator_category;
+
+		private:
+			Columns*	_columns;
+			size_t		_index;
+
+		public:
+			soa_iterator(Columns* columns = NULL, size_t index = 0) : _columns(columns), _index(index) {}
+
+			operator soa_iterator<const Columns>() const
+			{
+				return (soa_iterator<const Columns>(this->_columns, this->_index));
+			}
+
+			size_t index() const
+			{
+				return (this->_index);
+			}
+
+			reference operator*() const
+			{
+				return (reference(this->_columns, this->_index));
+			}
+
+			reference operator[](difference_type n) const
+			{
+				return (reference(this->_columns, this->_index + n));
+			}
+
+			soa_iterator& operator++()
+			{
+				++this->_index;
+				return (*this);
+			}
+
+			soa_iterator operator++(int)
+			{
+				soa_iterator tmp = *this;
+				++this->_index;
+				return (tmp);
+			}
+
+			soa_iterator& operator--()
+			{
+				--this->_index;
+				return (*this);
+			}
+
+			soa_iterator operator--(int)
+			{
+				soa_iterator tmp = *this;
+				--this->_index;
+				return (tmp);
+			}
+
+			soa_iterator& operator+=(difference_type n)
+			{
+				this->_index += n;
+				return (*this);
+			}
+
+			soa_iterator& operator-=(difference_type n)
+			{
+				this->_index -= n;
+				return (*this);
+			}
+
+			soa_iterator operator+(difference_type n) const
+			{
+				return (soa_iterator(this->_columns, this->_index + n));
+			}
+
+			soa_iterator operator-(difference_type n) const
+			{
+				return (soa_iterator(this->_columns, this->_index - n));
+			}
+	};
+
+	//같은 soa_vector의 iterator끼리만 비교한다. (const/non-const는 섞어서 비교할 수 있다.)
+	template <typename C1, typename C2>
+	bool operator==(const soa_iterator<C1>& lhs, const soa_iterator<C2>& rhs)
+	{
+		return (lhs.index() == rhs.index());
+	}
+
+	template <typename C1, typename C2>
+	bool operator!=(const soa_iterator<C1>& lhs, const soa_iterator<C2>& rhs)
+	{
+		return (lhs.index() != rhs.index());
+	}
+
+	template <typename C1, typename C2>
+	bool operator<(const soa_iterator<C1>& lhs, const soa_iterator<C2>& rhs)
+	{
+		return (lhs.index() < rhs.index());
+	}
+
+	template <typename C1, typename C2>
+	bool operator>(const soa_iterator<C1>& lhs, const soa_iterator<C2>& rhs)
+	{
+		return (lhs.index() > rhs.index());
+	}
+
+	template <typename C1, typename C2>
+	bool operator<=(const soa_iterator<C1>& lhs, const soa_iterator<C2>& rhs)
+	{
+		return (lhs.index() <= rhs.index());
+	}
+
+	template <typename C1, typename C2>
+	bool operator>=(const soa_iterator<C1>& lhs, const soa_iterator<C2>& rhs)
+	{
+		return (lhs.index() >= rhs.index());
+	}
+
+	template <typename C1, typename C2>
+	ptrdiff_t operator-(const soa_iterator<C1>& lhs, const soa_iterator<C2>& rhs)
+	{
+		return (static_cast<ptrdiff_t>(lhs.index()) - static_cast<ptrdiff_t>(rhs.index()));
+	}
+
+	template <typename Columns>
+	soa_iterator<Columns> operator+(ptrdiff_t n, const soa_iterator<Columns>& it)
+	{
+		return (it + n);
+	}
+
+	template <typename T0, typename T1 = soa_none, typename T2 = soa_none, typename T3 = soa_none,
+		typename T4 = soa_none, typename T5 = soa_none, typename T6 = soa_none, typename T7 = soa_none>
+	class soa_vector
+	{
+		public:
+			/**
+			 * @brief soa_vector member types
+			 *
+			 * value_type : 레코드 하나의 값 (soa_value)
+			 * reference : 레코드 하나를 가리키는 proxy (soa_row)
+			 * column_type<K>::type : K번째 column의 원소 타입
+			 */
+			typedef soa_columns<T0, T1, T2, T3, T4, T5, T6, T7>		columns_type;
+			typedef soa_value<T0, T1, T2, T3, T4, T5, T6, T7>		value_type;
+			typedef soa_row<columns_type>							reference;
+			typedef soa_row<const columns_type>						const_reference;
+			typedef soa_iterator<columns_type>						iterator;
+			typedef soa_iterator<const columns_type>				const_iterator;
+			typedef ft::reverse_iterator<iterator>					reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+			typedef size_t											size_type;
+			typedef ptrdiff_t										difference_type;
+
+			template <size_t K>
+			struct column_type
+			{
+				typedef typename soa_element<K, value_type>::type	type;
+			};
+
+		private:
+			columns_type	_columns;
+
+		public:
+		soa_vector() : _columns() {}
+
+		explicit soa_vector(size_type n, const value_type& val = value_type()) : _columns()
+		{
+			this->insert(this->end(), n, val);
+		}
+
+		soa_vector(const soa_vector& x) : _columns(x._columns) {}
+
+		~soa_vector() {}
+
+		soa_vector& operator=(const soa_vector& x)
+		{
+			if (this != &x)
+				this->_columns = x._columns;
+			return (*this);
+		}
+
+		/**
+		 * @brief Iterator
+		 */
+		iterator begin()
+		{
+			return (iterator(&this->_columns, 0));
+		}
+
+		const_iterator begin() const
+		{
+			return (const_iterator(&this->_columns, 0));
+		}
+
+		iterator end()
+		{
+			return (iterator(&this->_columns, this->size()));
+		}
+
+		const_iterator end() const
+		{
+			return (const_iterator(&this->_columns, this->size()));
+		}
+
+		reverse_iterator rbegin()
+		{
+			return (reverse_iterator(this->end()));
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return (const_reverse_iterator(this->end()));
+		}
+
+		reverse_iterator rend()
+		{
+			return (reverse_iterator(this->begin()));
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return (const_reverse_iterator(this->begin()));
+		}
+
+		/**
+		 * @brief capacity
+		 * 모든 column의 크기와 capacity가 같으므로 첫 번째 column의 값을 돌려준다.
+		 */
+		size_type size() const
+		{
+			return (this->_columns.head.size());
+		}
+
+		size_type max_size() const
+		{
+			return (this->_columns.head.max_size());
+		}
+
+		size_type capacity() const
+		{
+			return (this->_columns.head.capacity());
+		}
+
+		bool empty() const
+		{
+			return (this->size() == 0);
+		}
+
+		void reserve(size_type n)
+		{
+			if (n > this->capacity())
+				this->_columns.reserve(n);
+		}
+
+		void resize(size_type n, const value_type& val = value_type())
+		{
+			size_type prev_size = this->size();
+			this->grow(n > prev_size ? n - prev_size : 0);
+			try
+			{
+				this->_columns.resize(n, val);
+			}
+			catch (...)
+			{
+				this->_columns.truncate(prev_size);
+				throw ;
+			}
+		}
+
+		/**
+		 * @brief element access
+		 */
+		reference operator[](size_type n)
+		{
+			return (reference(&this->_columns, n));
+		}
+
+		const_reference operator[](size_type n) const
+		{
+			return (const_reference(&this->_columns, n));
+		}
+
+		reference at(size_type n)
+		{
+			if (n >= this->size())
+				throw(std::out_of_range("Error: ft::soa_vector::at"));
+			return ((*this)[n]);
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= this->size())
+				throw(std::out_of_range("Error: ft::soa_vector::at"));
+			return ((*this)[n]);
+		}
+
+		reference front()
+		{
+			return ((*this)[0]);
+		}
+
+		const_reference front() const
+		{
+			return ((*this)[0]);
+		}
+
+		reference back()
+		{
+			return ((*this)[this->size() - 1]);
+		}
+
+		const_reference back() const
+		{
+			return ((*this)[this->size() - 1]);
+		}
+
+		//K번째 column 전체. 연속된 배열이므로 data()를 그대로 scan 루프에 넘길 수 있다.
+		template <size_t K>
+		soa_span<typename column_type<K>::type> column()
+		{
+			typename soa_element<K, columns_type>::type& col = soa_get<K>::get(this->_columns);
+			return (soa_span<typename column_type<K>::type>(col.empty() ? NULL : &col[0], col.size()));
+		}
+
+		template <size_t K>
+		soa_span<const typename column_type<K>::type> column() const
+		{
+			const typename soa_element<K, columns_type>::type& col = soa_get<K>::get(this->_columns);
+			return (soa_span<const typename column_type<K>::type>(col.empty() ? NULL : &col[0], col.size()));
+		}
+
+		/**
+		 * @brief modifiers
+		 */
+		void push_back(const value_type& val)
+		{
+			this->grow(1);
+			this->_columns.push_back(val);
+		}
+
+		void pop_back()
+		{
+			this->_columns.pop_back();
+		}
+
+		iterator insert(iterator position, const value_type& val)
+		{
+			size_type index = position.index();
+			this->insert(position, 1, val);
+			return (iterator(&this->_columns, index));
+		}
+
+		void insert(iterator position, size_type n, const value_type& val)
+		{
+			size_type index = position.index();
+			size_type prev_size = this->size();
+			this->grow(n);
+			try
+			{
+				this->_columns.insert(index, n, val);
+			}
+			catch (...)
+			{
+				if (index == prev_size)
+					this->_columns.truncate(prev_size);
+				throw ;
+			}
+		}
+
+		iterator erase(iterator position)
+		{
+			return (this->erase(position, position + 1));
+		}
+
+		iterator erase(iterator first, iterator last)
+		{
+			this->_columns.erase(first.index(), last.index());
+			return (iterator(&this->_columns, first.index()));
+		}
+
+		void swap(soa_vector& x)
+		{
+			this->_columns.swap(x._columns);
+		}
+
+		void clear()
+		{
+			this->_columns.clear();
+		}
+
+		bool equal(const soa_vector& x) const
+		{
+			return (this->_columns.equal(x._columns));
+		}
+
+		private:
+		//n개를 더 넣을 수 있도록 모든 column을 같은 capacity로 늘린다. (vector처럼 두 배씩)
+		void grow(size_type n)
+		{
+			size_type need = this->size() + n;
+			if (need <= this->capacity())
+				return ;
+			size_type twice = this->capacity() * 2;
+			this->_columns.reserve(twice > need ? twice : need);
+		}
+	};
+
+	template <typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7>
+	bool operator==(const soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>& lhs, const soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>& rhs)
+	{
+		return (lhs.equal(rhs));
+	}
+
+	template <typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7>
+	bool operator!=(const soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>& lhs, const soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7>
+	void swap(soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>& x, soa_vector<T0, T1, T2, T3, T4, T5, T6, T7>& y)
+	{
+		x.swap(y);
+	}
+}
+
+#endif
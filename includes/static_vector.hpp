@@ -0,0 +1,559 @@
+#ifndef STATIC_VECTOR_HPP
+# define STATIC_VECTOR_HPP
+
+#include <memory>
+#include <stdexcept>
+#include <cstring>
+#include "VectorIterator.hpp"
+#include "utils.hpp"
+
+/**
+ * @brief static_vector
+ *
+ * 최대 N개의 원소를 객체 안의 배열에 저장하는 vector. heap을 전혀 사용하지 않는다.
+ * hot path의 임시 buffer나 heap을 쓸 수 없는 real-time thread에서 vector 인터페이스를 그대로 쓰기 위해 만들었다.
+ *
+ * - 저장 공간은 객체 안의 raw 배열이다. 원소는 vector처럼 필요할 때만 생성하고 제거할 때 소멸시킨다.
+ * - capacity는 항상 N이다. N을 넘겨서 넣으려고 하면 아무것도 바꾸지 않고 length_error를 던진다.
+ * - iterator는 vector와 같은 VectorIterator이다. 원소의 주소는 삽입/삭제한 위치 뒤의 원소만 바뀐다. (재할당이 없다)
+ * - T가 trivially copyable이면 static_vector도 trivially copyable이다.
+ *   복사는 배열 전체를 byte 단위로 복사하고, 삽입/삭제는 memmove로 원소를 옮긴다.
+ *   (ft::vector<static_vector<int, 8> >도 memcpy 경로를 사용한다.)
+ * - back/push_back/pop_back과 비교 연산자가 있으므로 ft::stack의 Container로 사용할 수 있다.
+ *
+ * @tparam T	Type of the elements.
+ * @tparam N	최대 원소 수 (capacity)
+ */
+namespace ft
+{
+	/**
+	 * @brief static_storage
+	 *
+	 * 원소 N개를 담을 수 있는 T의 정렬을 가진 raw 배열. 원소를 생성하지 않는다.
+	 * C++98에는 alignas가 없으므로 GNU 계열 compiler에서는 aligned attribute를 사용하고,
+	 * 그 외에는 정렬이 큰 기본 타입들과 union으로 묶는다. (T보다 크게 정렬될 수 있다.)
+	 */
+	template <typename T, size_t N>
+	struct static_storage
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		unsigned char	bytes[N ? sizeof(T) * N : 1] __attribute__((aligned(__alignof__(T))));
+#else
+		union
+		{
+			unsigned char	bytes[N ? sizeof(T) * N : 1];
+			long double		align_ld;
+			double			align_d;
+			long			align_l;
+			void*			align_p;
+		};
+#endif
+	};
+
+	/**
+	 * @brief static_vector_base
+	 *
+	 * 원소 수와 저장 공간을 가진다. 복사 생성자, 대입 연산자, 소멸자를 여기서 정한다.
+	 * T가 trivially copyable이면 컴파일러가 만든 것을 그대로 사용해 static_vector도 trivially copyable이 되게 한다.
+	 * 그렇지 않으면 살아있는 원소만 생성/대입/소멸시킨다.
+	 */
+	template <typename T, size_t N, bool = ft::is_trivially_copyable<T>::value>
+	class static_vector_base
+	{
+		protected:
+			size_t					_size;
+			static_storage<T, N>	_storage;
+
+			static_vector_base() : _size(0) {}
+
+			T* data_ptr()
+			{
+				return (reinterpret_cast<T*>(this->_storage.bytes));
+			}
+
+			const T* data_ptr() const
+			{
+				return (reinterpret_cast<const T*>(this->_storage.bytes));
+			}
+	};
+
+	template <typename T, size_t N>
+	class static_vector_base<T, N, false>
+	{
+		protected:
+			size_t					_size;
+			static_storage<T, N>	_storage;
+
+			static_vector_base() : _size(0) {}
+
+			static_vector_base(const static_vector_base& x) : _size(0)
+			{
+				std::allocator<T> alloc;
+				for (; this->_size < x._size; ++this->_size)
+					alloc.construct(this->data_ptr() + this->_size, x.data_ptr()[this->_size]);
+			}
+
+			~static_vector_base()
+			{
+				this->destroy_from(0);
+			}
+
+			static_vector_base& operator=(const static_vector_base& x)
+			{
+				if (this != &x)
+				{
+					std::allocator<T> alloc;
+					size_t common = (this->_size < x._size) ? this->_size : x._size;
+					for (size_t i = 0; i < common; ++i)
+						this->data_ptr()[i] = x.data_ptr()[i];
+					for (; this->_size < x._size; ++this->_size)
+						alloc.construct(this->data_ptr() + this->_size, x.data_ptr()[this->_size]);
+					this->destroy_from(x._size);
+				}
+				return (*this);
+			}
+
+			T* data_ptr()
+			{
+				return (reinterpret_cast<T*>(this->_storage.bytes));
+			}
+
+			const T* data_ptr() const
+			{
+				return (reinterpret_cast<const T*>(this->_storage.bytes));
+			}
+
+			//[n, size) 원소를 소멸시킨다.
+			void destroy_from(size_t n)
+			{
+				std::allocator<T> alloc;
+				while (this->_size > n)
+					alloc.destroy(this->data_ptr() + --this->_size);
+			}
+	};
+
+	template < typename T, size_t N >
+	class static_vector : public static_vector_base<T, N>
+	{
+		public:
+			/**
+			 * @brief static_vector member types
+			 * vector와 같다. allocator는 없다.
+			 */
+			typedef T value_type;
+			typedef T& reference;
+			typedef const T& const_reference;
+			typedef T* pointer;
+			typedef const T* const_pointer;
+			typedef ft::VectorIterator<T>					iterator;
+			typedef ft::VectorIterator<const T>				const_iterator;
+			typedef ft::reverse_iterator<iterator>			reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+			typedef size_t									size_type;
+			typedef ptrdiff_t								difference_type;
+
+		public:
+		/**
+		 * @brief static_vector member function
+		 *
+		 * 생성자는 vector와 같다. n 또는 range의 크기가 N보다 크면 length_error를 던진다.
+		 * 복사 생성자, 대입 연산자, 소멸자는 static_vector_base의 것을 사용한다.
+		 */
+		static_vector() {}
+
+		explicit static_vector(size_type n, const value_type &val = value_type())
+		{
+			this->insert(this->end(), n, val);
+		}
+
+		template <typename InputIterator>
+		static_vector(InputIterator first, InputIterator last,
+				typename ft::enable_if< !ft::is_integral< InputIterator >::value, InputIterator >::type* = NULL)
+		{
+			this->insert(this->end(), first, last);
+		}
+
+		/**
+		 * @brief Iterator
+		 */
+		iterator begin()
+		{
+			return (iterator(this->data_ptr()));
+		}
+
+		const_iterator begin() const
+		{
+			return (const_iterator(this->data_ptr()));
+		}
+
+		iterator end()
+		{
+			return (iterator(this->data_ptr() + this->_size));
+		}
+
+		const_iterator end() const
+		{
+			return (const_iterator(this->data_ptr() + this->_size));
+		}
+
+		reverse_iterator rbegin()
+		{
+			return (reverse_iterator(this->end()));
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return (const_reverse_iterator(this->end()));
+		}
+
+		reverse_iterator rend()
+		{
+			return (reverse_iterator(this->begin()));
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return (const_reverse_iterator(this->begin()));
+		}
+
+		/**
+		 * @brief capacity
+		 * max_size와 capacity는 항상 N이다.
+		 */
+		size_type size() const
+		{
+			return (this->_size);
+		}
+
+		size_type max_size() const
+		{
+			return (N);
+		}
+
+		size_type capacity() const
+		{
+			return (N);
+		}
+
+		bool empty() const
+		{
+			return (this->_size == 0);
+		}
+
+		bool full() const
+		{
+			return (this->_size == N);
+		}
+
+		void resize(size_type n, value_type val = value_type())
+		{
+			if (n < this->_size)
+				this->erase(this->begin() + n, this->end());
+			else if (n > this->_size)
+				this->insert(this->end(), n - this->_size, val);
+		}
+
+		//capacity는 늘릴 수 없으므로 n이 N 이하인지만 확인한다.
+		void reserve(size_type n)
+		{
+			if (n > N)
+				throw(std::length_error("Error: ft::static_vector::reserve"));
+		}
+
+		/**
+		 * @brief element access
+		 */
+		reference operator[](size_type n)
+		{
+			return (this->data_ptr()[n]);
+		}
+
+		const_reference operator[](size_type n) const
+		{
+			return (this->data_ptr()[n]);
+		}
+
+		reference at(size_type n)
+		{
+			if (n >= this->_size)
+				throw(std::out_of_range("Error: ft::static_vector::at"));
+			return ((*this)[n]);
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= this->_size)
+				throw(std::out_of_range("Error: ft::static_vector::at"));
+			return ((*this)[n]);
+		}
+
+		reference front()
+		{
+			return (this->data_ptr()[0]);
+		}
+
+		const_reference front() const
+		{
+			return (this->data_ptr()[0]);
+		}
+
+		reference back()
+		{
+			return (this->data_ptr()[this->_size - 1]);
+		}
+
+		const_reference back() const
+		{
+			return (this->data_ptr()[this->_size - 1]);
+		}
+
+		/**
+		 * @brief modifiers
+		 *
+		 * insert/push_back은 넣을 원소 수가 남은 공간보다 많으면 아무것도 바꾸지 않고 length_error를 던진다.
+		 * assign(range)은 기존 원소를 지운 후 넣으므로, 넘치면 빈 상태로 length_error를 던진다.
+		 */
+		template <typename InputIterator>
+		void assign(InputIterator first, InputIterator last,
+			typename ft::enable_if< !ft::is_integral< InputIterator >::value, InputIterator >::type* = NULL)
+		{
+			this->clear();
+			this->insert(this->end(), first, last);
+		}
+
+		void assign(size_type n, const value_type &val)
+		{
+			if (n > N)
+				throw(std::length_error("Error: ft::static_vector::assign"));
+			value_type copy = val;
+			this->clear();
+			this->insert(this->end(), n, copy);
+		}
+
+		void push_back(const value_type &val)
+		{
+			if (this->_size == N)
+				throw(std::length_error("Error: ft::static_vector::push_back"));
+			this->alloc().construct(this->data_ptr() + this->_size, val);
+			++this->_size;
+		}
+
+		void pop_back()
+		{
+			this->alloc().destroy(this->data_ptr() + --this->_size);
+		}
+
+		iterator insert(iterator position, const value_type &val)
+		{
+			size_type index = position - this->begin();
+			this->insert(position, 1, val);
+			return (this->begin() + index);
+		}
+
+		void insert(iterator position, size_type n, const value_type &val)
+		{
+			check_room(n);
+			value_type copy = val;
+			this->make_room(position - this->begin(), n, &copy, 0);
+		}
+
+		template <typename InputIterator>
+		void insert(iterator position, InputIterator first, InputIterator last,
+			typename ft::enable_if< !ft::is_integral< InputIterator >::value, InputIterator >::type* = NULL)
+		{
+			this->range_insert(position - this->begin(), first, last, typename ft::iterator_category_of<InputIterator>::type());
+		}
+
+		iterator erase(iterator position)
+		{
+			return (this->erase(position, position + 1));
+		}
+
+		//뒤의 원소를 앞으로 옮긴 후 남은 끝의 원소를 소멸시킨다.
+		iterator erase(iterator first, iterator last)
+		{
+			pointer dst = this->data_ptr() + (first - this->begin());
+			pointer src = this->data_ptr() + (last - this->begin());
+			pointer end = this->data_ptr() + this->_size;
+			if (ft::is_trivially_copyable<T>::value)
+			{
+				std::memmove(static_cast<void*>(dst), src, (end - src) * sizeof(value_type));
+				this->_size -= src - dst;
+				return (first);
+			}
+			for (; src != end; ++src, ++dst)
+				*dst = *src;
+			while (this->data_ptr() + this->_size != dst)
+				this->pop_back();
+			return (first);
+		}
+
+		//두 객체의 원소를 하나씩 바꾼다. (저장 공간이 객체 안에 있으므로 O(size))
+		void swap(static_vector &x)
+		{
+			static_vector tmp(*this);
+			*this = x;
+			x = tmp;
+		}
+
+		void clear()
+		{
+			while (this->_size)
+				this->pop_back();
+		}
+
+		private:
+		static std::allocator<T> alloc()
+		{
+			return (std::allocator<T>());
+		}
+
+		void check_room(size_type n) const
+		{
+			if (n > N - this->_size)
+				throw(std::length_error("Error: ft::static_vector::insert"));
+		}
+
+		/**
+		 * index 위치에 n개의 원소를 넣는다.
+		 * src가 step 만큼씩 움직이며 값을 읽는다. (fill은 step 0으로 같은 값을 반복한다.)
+		 * trivially copyable이면 뒤의 원소를 memmove로 옮기고, 아니면 vector처럼 끝을 넘어가는 자리는 생성하고 원소가 있는 자리는 대입한다.
+		 */
+		void make_room(size_type index, size_type n, const value_type* src, size_type step)
+		{
+			pointer pos = this->data_ptr() + index;
+			pointer old_end = this->data_ptr() + this->_size;
+			size_type tail = old_end - pos;
+			if (ft::is_trivially_copyable<T>::value)
+			{
+				std::memmove(static_cast<void*>(pos + n), pos, tail * sizeof(value_type));
+				for (size_type i = 0; i < n; ++i, src += step)
+					std::memcpy(static_cast<void*>(pos + i), src, sizeof(value_type));
+				this->_size += n;
+				return ;
+			}
+			if (tail > n)
+			{
+				for (pointer p = old_end - n; p != old_end; ++p)
+				{
+					this->alloc().construct(this->data_ptr() + this->_size, *p);
+					++this->_size;
+				}
+				for (pointer p = old_end - n, dst = old_end; p != pos;)
+					*--dst = *--p;
+				for (size_type i = 0; i < n; ++i, src += step)
+					pos[i] = *src;
+			}
+			else
+			{
+				const value_type* mid = src + tail * step;
+				for (size_type i = tail; i < n; ++i, mid += step)
+				{
+					this->alloc().construct(this->data_ptr() + this->_size, *mid);
+					++this->_size;
+				}
+				for (pointer p = pos; p != old_end; ++p)
+				{
+					this->alloc().construct(this->data_ptr() + this->_size, *p);
+					++this->_size;
+				}
+				for (size_type i = 0; i < tail; ++i, src += step)
+					pos[i] = *src;
+			}
+		}
+
+		//개수를 미리 알 수 없으므로 끝에 하나씩 넣은 후 삽입 위치로 옮긴다. 넘치면 넣은 원소를 되돌린다.
+		template <typename InputIterator>
+		void range_insert(size_type index, InputIterator first, InputIterator last, ft::input_iterator_tag)
+		{
+			size_type old_size = this->_size;
+			try
+			{
+				for (; first != last; ++first)
+					this->push_back(*first);
+			}
+			catch (...)
+			{
+				while (this->_size != old_size)
+					this->pop_back();
+				throw ;
+			}
+			rotate(this->data_ptr() + index, this->data_ptr() + old_size, this->data_ptr() + this->_size);
+		}
+
+		//개수를 먼저 확인해서 넘치면 아무것도 넣지 않는다.
+		template <typename ForwardIterator>
+		void range_insert(size_type index, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+		{
+			check_room(ft::distance(first, last));
+			this->range_insert(index, first, last, ft::input_iterator_tag());
+		}
+
+		//[first, last)를 [middle, last)가 앞에 오도록 회전한다. (구간 뒤집기 세 번)
+		static void rotate(pointer first, pointer middle, pointer last)
+		{
+			reverse(first, middle);
+			reverse(middle, last);
+			reverse(first, last);
+		}
+
+		static void reverse(pointer first, pointer last)
+		{
+			while (first != last && first != --last)
+			{
+				value_type tmp = *first;
+				*first++ = *last;
+				*last = tmp;
+			}
+		}
+	};
+
+	/**
+	 * @brief static_vector non-member function
+	 */
+	template <typename T, size_t N>
+	bool operator==(const static_vector<T, N> &lhs, const static_vector<T, N> &rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <typename T, size_t N>
+	bool operator!=(const static_vector<T, N> &lhs, const static_vector<T, N> &rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	template <typename T, size_t N>
+	bool operator<(const static_vector<T, N> &lhs, const static_vector<T, N> &rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <typename T, size_t N>
+	bool operator<=(const static_vector<T, N> &lhs, const static_vector<T, N> &rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	template <typename T, size_t N>
+	bool operator>(const static_vector<T, N> &lhs, const static_vector<T, N> &rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	template <typename T, size_t N>
+	bool operator>=(const static_vector<T, N> &lhs, const static_vector<T, N> &rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	template <typename T, size_t N>
+	void swap(static_vector<T, N> &x, static_vector<T, N> &y)
+	{
+		x.swap(y);
+	}
+}
+
+#endif
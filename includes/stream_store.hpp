@@ -0,0 +1,262 @@
+#ifndef STREAM_STORE_HPP
+# define STREAM_STORE_HPP
+
+#include <cstring>
+#include <cstddef>
+
+/**
+ * @brief streaming (non-temporal) store
+ *
+ * 아주 큰 범위를 복사/채울 때 cache를 거치지 않고 메모리에 바로 쓴다.
+ * 보통의 store는 쓸 cache line을 먼저 읽어 cache에 올린 후 쓴다. 수 GB를 채우면 cache 전체가 방금 쓴(곧 다시 읽지 않을) 데이터로 바뀌어
+ * 같은 core나 cache를 공유하는 다른 core의 작업이 다시 메모리에서 읽어야 한다. 읽어 올리는 대역폭도 같이 낭비된다.
+ * SSE2의 _mm_stream_si128은 cache line을 읽지 않고 write-combining buffer에 모아 한 번에 쓴다.
+ *
+ * - FT_STREAM_THRESHOLD		: 이 byte 수 이상일 때만 streaming store를 쓴다. (기본 16MB, 보통 LLC보다 크다)
+ *							  작은 범위는 곧 다시 읽을 가능성이 높으므로 cache에 남기는 memcpy가 낫다.
+ * - FT_STREAM_THREADS			: 나눠서 쓸 최대 thread 수. 기본 1(나누지 않음). 2 이상이면 pthread를 사용하므로 -pthread로 빌드해야 한다.
+ * - FT_STREAM_THREAD_THRESHOLD	: 이 byte 수 이상일 때만 thread로 나눈다. (기본 256MB)
+ * 세 값은 ft::stream_settings()로 실행 중에 바꿀 수 있다. (threads는 FT_STREAM_THREADS보다 크게 해도 그 값까지만 쓴다.)
+ * SSE2가 없으면 streaming store 없이 memcpy/대입으로 처리한다.
+ *
+ * streaming store는 다른 store와 순서가 보장되지 않으므로 끝에 _mm_sfence로 모두 메모리에 반영한다.
+ */
+#ifndef FT_STREAM_THRESHOLD
+# define FT_STREAM_THRESHOLD (16UL << 20)
+#endif
+#ifndef FT_STREAM_THREADS
+# define FT_STREAM_THREADS 1
+#endif
+#ifndef FT_STREAM_THREAD_THRESHOLD
+# define FT_STREAM_THREAD_THRESHOLD (256UL << 20)
+#endif
+
+#if defined(__SSE2__)
+# include <emmintrin.h>
+# define FT_STREAM_STORE 1
+#else
+# define FT_STREAM_STORE 0
+#endif
+
+#if FT_STREAM_THREADS > 1
+# include <pthread.h>
+#endif
+
+namespace ft
+{
+	struct stream_config
+	{
+		size_t		threshold;
+		size_t		thread_threshold;
+		unsigned	threads;
+	};
+
+	inline stream_config& stream_settings()
+	{
+		static stream_config config = { FT_STREAM_THRESHOLD, FT_STREAM_THREAD_THRESHOLD, FT_STREAM_THREADS };
+		return (config);
+	}
+
+	namespace stream_detail
+	{
+		//fill에서 반복할 byte pattern의 최대 길이. (sizeof(T)와 16의 최소공배수)
+		enum { MAX_PERIOD = 256 };
+
+		/**
+		 * @brief stream_job
+		 *
+		 * dst부터 bytes byte를 streaming store로 쓴다. dst는 16 byte 정렬, bytes는 16의 배수이다.
+		 * - period == 0	: src에서 같은 길이를 복사한다. (src는 정렬되지 않아도 된다.)
+		 * - period > 0		: src의 period byte(16 byte 정렬, 16의 배수)를 반복해서 쓴다.
+		 */
+		struct stream_job
+		{
+			char*		dst;
+			const char*	src;
+			size_t		bytes;
+			size_t		period;
+		};
+
+#if FT_STREAM_STORE
+		inline void run(const stream_job& job)
+		{
+			__m128i* dst = reinterpret_cast<__m128i*>(job.dst);
+			size_t n = job.bytes / 16;
+			if (job.period == 0)
+			{
+				const __m128i* src = reinterpret_cast<const __m128i*>(job.src);
+				for (; n >= 4; n -= 4, dst += 4, src += 4)
+				{
+					__m128i a = _mm_loadu_si128(src);
+					__m128i b = _mm_loadu_si128(src + 1);
+					__m128i c = _mm_loadu_si128(src + 2);
+					__m128i d = _mm_loadu_si128(src + 3);
+					_mm_stream_si128(dst, a);
+					_mm_stream_si128(dst + 1, b);
+					_mm_stream_si128(dst + 2, c);
+					_mm_stream_si128(dst + 3, d);
+				}
+				for (; n > 0; --n)
+					_mm_stream_si128(dst++, _mm_loadu_si128(src++));
+			}
+			else if (job.period == 16)
+			{
+				__m128i val = _mm_load_si128(reinterpret_cast<const __m128i*>(job.src));
+				for (; n >= 4; n -= 4, dst += 4)
+				{
+					_mm_stream_si128(dst, val);
+					_mm_stream_si128(dst + 1, val);
+					_mm_stream_si128(dst + 2, val);
+					_mm_stream_si128(dst + 3, val);
+				}
+				for (; n > 0; --n)
+					_mm_stream_si128(dst++, val);
+			}
+			else
+			{
+				const __m128i* pattern = reinterpret_cast<const __m128i*>(job.src);
+				size_t chunks = job.period / 16;
+				for (size_t i = 0; n > 0; --n)
+				{
+					_mm_stream_si128(dst++, _mm_load_si128(pattern + i));
+					if (++i == chunks)
+						i = 0;
+				}
+			}
+			_mm_sfence();
+		}
+
+# if FT_STREAM_THREADS > 1
+		inline void* run_thread(void* arg)
+		{
+			run(*static_cast<stream_job*>(arg));
+			return (NULL);
+		}
+# endif
+
+		//thread 수를 정하고 job을 나눈다. 나눈 조각은 unit의 배수이므로 fill의 pattern은 조각마다 처음부터 시작한다.
+		inline void dispatch(const stream_job& job)
+		{
+# if FT_STREAM_THREADS > 1
+			const stream_config& config = stream_settings();
+			size_t threads = config.threads < FT_STREAM_THREADS ? config.threads : FT_STREAM_THREADS;
+			if (threads > 1 && job.bytes >= config.thread_threshold)
+			{
+				size_t unit = (job.period ? job.period : 16) * 4;
+				size_t chunk = job.bytes / threads / unit * unit;
+				stream_job jobs[FT_STREAM_THREADS];
+				pthread_t tids[FT_STREAM_THREADS];
+				bool started[FT_STREAM_THREADS];
+				for (size_t i = 0; i < threads; ++i)
+				{
+					jobs[i] = job;
+					jobs[i].dst = job.dst + i * chunk;
+					if (job.period == 0)
+						jobs[i].src = job.src + i * chunk;
+					jobs[i].bytes = (i + 1 == threads) ? job.bytes - i * chunk : chunk;
+				}
+				//첫 조각은 호출한 thread가 직접 쓴다. thread를 만들지 못하면 그 조각도 직접 쓴다.
+				for (size_t i = 1; i < threads; ++i)
+					started[i] = (pthread_create(&tids[i], NULL, run_thread, &jobs[i]) == 0);
+				run(jobs[0]);
+				for (size_t i = 1; i < threads; ++i)
+				{
+					if (started[i])
+						pthread_join(tids[i], NULL);
+					else
+						run(jobs[i]);
+				}
+				return ;
+			}
+# endif
+			run(job);
+		}
+#endif
+
+		//16 byte 정렬까지 남은 byte 수
+		inline size_t misalignment(const void* p)
+		{
+			return ((16 - reinterpret_cast<size_t>(p) % 16) % 16);
+		}
+
+		inline size_t gcd(size_t a, size_t b)
+		{
+			while (b)
+			{
+				size_t t = a % b;
+				a = b;
+				b = t;
+			}
+			return (a);
+		}
+	}
+
+	/**
+	 * @brief bulk_copy
+	 *
+	 * 겹치지 않는 범위의 bytes byte를 복사한다. stream_settings().threshold 이상이면 streaming store를 사용한다.
+	 * dst가 16 byte 정렬될 때까지의 앞부분과 16 byte가 안 되는 뒷부분은 memcpy로 쓴다.
+	 * 앞부분을 빼고 16 byte도 남지 않으면 (threshold를 아주 작게 둔 경우) memcpy 한 번으로 복사한다.
+	 */
+	inline void bulk_copy(void* dst, const void* src, size_t bytes)
+	{
+#if FT_STREAM_STORE
+		if (bytes >= stream_settings().threshold && bytes >= stream_detail::misalignment(dst) + 16)
+		{
+			char* d = static_cast<char*>(dst);
+			const char* s = static_cast<const char*>(src);
+			size_t head = stream_detail::misalignment(d);
+			std::memcpy(d, s, head);
+			stream_detail::stream_job job = { d + head, s + head, (bytes - head) / 16 * 16, 0 };
+			stream_detail::dispatch(job);
+			size_t done = head + job.bytes;
+			std::memcpy(d + done, s + done, bytes - done);
+			return ;
+		}
+#endif
+		std::memcpy(dst, src, bytes);
+	}
+
+	/**
+	 * @brief bulk_fill
+	 *
+	 * 초기화되지 않은 dst에 trivially copyable인 val을 n개 쓴다. n * sizeof(T)가 stream_settings().threshold 이상이면 streaming store를 사용한다.
+	 * val을 16 byte 단위로 쓰기 위해 sizeof(T)와 16의 최소공배수 길이의 pattern을 만든다.
+	 * pattern이 MAX_PERIOD보다 길거나, 원소 경계에서 16 byte 정렬된 주소를 만들 수 없으면 대입으로 채운다.
+	 * 앞부분은 n개를 넘지 않고, 정렬된 뒤에 16 byte가 안 남으면 job은 비어 있고 나머지는 pattern에서 memcpy 한다.
+	 */
+	template <typename T>
+	void bulk_fill(T* dst, const T& val, size_t n)
+	{
+#if FT_STREAM_STORE
+		const size_t size = sizeof(T);
+		const size_t period = size / stream_detail::gcd(size, 16) * 16;
+		if (n * size >= stream_settings().threshold && period <= stream_detail::MAX_PERIOD)
+		{
+			size_t head = 0;
+			while (head < 16 && head < n && stream_detail::misalignment(dst + head) != 0)
+				++head;
+			if (stream_detail::misalignment(dst + head) == 0)
+			{
+				for (size_t i = 0; i < head; ++i)
+					dst[i] = val;
+				char buffer[stream_detail::MAX_PERIOD + 16];
+				char* pattern = buffer + stream_detail::misalignment(buffer);
+				for (size_t off = 0; off < period; off += size)
+					std::memcpy(pattern + off, &val, size);
+				char* d = reinterpret_cast<char*>(dst + head);
+				size_t bytes = (n - head) * size;
+				stream_detail::stream_job job = { d, pattern, bytes / 16 * 16, period };
+				stream_detail::dispatch(job);
+				//job.bytes는 16의 배수이고 period도 16의 배수이므로 남은 부분은 pattern 안에서 끝난다.
+				std::memcpy(d + job.bytes, pattern + job.bytes % period, bytes - job.bytes);
+				return ;
+			}
+		}
+#endif
+		for (size_t i = 0; i < n; ++i)
+			dst[i] = val;
+	}
+} // namespace ft
+
+#endif
@@ -1,17 +1,34 @@
 #ifndef UTILS_HPP
 # define UTILS_HPP
 
+#include <string>
 #include "iterator.hpp"
 
 /**
  * utils implement
+ * distance/advance/next/prev
  * enable_if
  * is_integral
+ * is_empty/ebo_holder/compressed_pair
+ * is_same/remove_const/is_trivially_copyable/is_trivially_relocatable/is_nothrow_copyable/contiguous_iterator
  * equal/lexicographical compare
  * std::pair
  * std::make_pair
+ * three_way_traits
  */
 
+/**
+ * @brief FT_PREFETCH
+ *
+ * addr가 가리키는 cache line을 미리 읽어오도록 요청한다. 지원하지 않는 컴파일러에서는 아무 일도 하지 않는다.
+ * tree 탐색처럼 다음에 읽을 주소가 비교 결과에 따라 정해지는 경우, 후보들을 미리 요청해 두면 메모리 대기 시간이 겹쳐진다.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+# define FT_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+# define FT_PREFETCH(addr) ((void)0)
+#endif
+
 namespace ft
 {
 	/**
@@ -22,20 +39,87 @@ namespace ft
 	 * @brief distance
 	 * User-defined function for finding the distance between two iterators.
 	 * implementation via tag dispatch, available in C++98 with constexpr removed
+	 * random access iterator는 last - first로 O(1), 나머지는 first부터 last까지 하나씩 센다.
 	 * @tparam InputIterator		iterator type
 	 * @param first		initial position of the iterator
 	 * @param last		final position of the iterator
 	 * @return iterator_traits<InputIterator>::difference_type	distance between two iterators
 	 */
 	template <typename InputIterator>
-	typename ft::iterator_traits<InputIterator>::difference_type distance(InputIterator first, InputIterator last)
+	typename ft::iterator_traits<InputIterator>::difference_type distance(InputIterator first, InputIterator last, ft::input_iterator_tag)
 	{
 		typename ft::iterator_traits<InputIterator>::difference_type n = 0;
-		while (first++ != last)
-			n++;
+		for (; first != last; ++first)
+			++n;
 		return (n);
 	}
 
+	template <typename RandomAccessIterator>
+	typename ft::iterator_traits<RandomAccessIterator>::difference_type distance(RandomAccessIterator first, RandomAccessIterator last, ft::random_access_iterator_tag)
+	{
+		return (last - first);
+	}
+
+	template <typename InputIterator>
+	typename ft::iterator_traits<InputIterator>::difference_type distance(InputIterator first, InputIterator last)
+	{
+		return (ft::distance(first, last, typename ft::iterator_category_of<InputIterator>::type()));
+	}
+
+	/**
+	 * @brief advance
+	 * it를 n만큼 이동한다. random access iterator는 it += n 한 번, bidirectional iterator는 음수 n이면 뒤로 이동한다.
+	 * input/forward iterator에 음수 n을 주면 아무 일도 하지 않는다. (std에서는 undefined behavior)
+	 * @param it	이동할 iterator
+	 * @param n		이동할 거리
+	 */
+	template <typename InputIterator, typename Distance>
+	void advance(InputIterator& it, Distance n, ft::input_iterator_tag)
+	{
+		for (; n > 0; --n)
+			++it;
+	}
+
+	template <typename BidirectionalIterator, typename Distance>
+	void advance(BidirectionalIterator& it, Distance n, ft::bidirectional_iterator_tag)
+	{
+		for (; n > 0; --n)
+			++it;
+		for (; n < 0; ++n)
+			--it;
+	}
+
+	template <typename RandomAccessIterator, typename Distance>
+	void advance(RandomAccessIterator& it, Distance n, ft::random_access_iterator_tag)
+	{
+		it += n;
+	}
+
+	template <typename InputIterator, typename Distance>
+	void advance(InputIterator& it, Distance n)
+	{
+		ft::advance(it, n, typename ft::iterator_category_of<InputIterator>::type());
+	}
+
+	/**
+	 * @brief next / prev
+	 * it에서 n만큼 앞/뒤로 이동한 iterator를 돌려준다. (C++11 std::next, std::prev)
+	 * prev는 bidirectional iterator 이상만 사용할 수 있다.
+	 */
+	template <typename InputIterator>
+	InputIterator next(InputIterator it, typename ft::iterator_traits<InputIterator>::difference_type n = 1)
+	{
+		ft::advance(it, n);
+		return (it);
+	}
+
+	template <typename BidirectionalIterator>
+	BidirectionalIterator prev(BidirectionalIterator it, typename ft::iterator_traits<BidirectionalIterator>::difference_type n = 1)
+	{
+		ft::advance(it, -n);
+		return (it);
+	}
+
 	/**
 	 * enable_if
 	 *
@@ -130,6 +214,181 @@ namespace ft
 	template <typename T>
 	struct is_integral : public is_integral_type<T> {};
 
+	/**
+	 * @brief is_empty
+	 *
+	 * T가 멤버 변수가 없는 class인지 식별한다. (ft::less, std::allocator 같은 policy 객체)
+	 * 컴파일러 builtin(__is_empty)을 사용할 수 없으면 항상 false로 두어 compressed_pair가 일반 멤버로 저장하게 한다.
+	 * 함수 포인터 같은 class가 아닌 타입은 상속할 수 없으므로 false이다.
+	 */
+	template <typename T>
+	struct is_empty
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		static const bool value = __is_empty(T);
+#else
+		static const bool value = false;
+#endif
+	};
+
+	template <typename T, typename U>
+	struct is_same
+	{
+		static const bool value = false;
+	};
+
+	template <typename T>
+	struct is_same<T, T>
+	{
+		static const bool value = true;
+	};
+
+	template <typename T>
+	struct remove_const
+	{
+		typedef T type;
+	};
+
+	template <typename T>
+	struct remove_const<const T>
+	{
+		typedef T type;
+	};
+
+	/**
+	 * @brief is_trivially_copyable
+	 *
+	 * 복사 생성/대입/소멸이 모두 trivial이라 memcpy로 복사해도 되는 타입인지 식별한다. (int, double, 포인터, POD struct)
+	 * 컴파일러 builtin을 사용할 수 없으면 integral type과 포인터만 true로 둔다.
+	 */
+	template <typename T>
+	struct is_trivially_copyable
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		static const bool value = __has_trivial_copy(T) && __has_trivial_assign(T) && __has_trivial_destructor(T);
+#else
+		static const bool value = ft::is_integral<T>::value;
+#endif
+	};
+
+#if !defined(__GNUC__) && !defined(__clang__)
+	template <typename T>
+	struct is_trivially_copyable<T*>
+	{
+		static const bool value = true;
+	};
+#endif
+
+	/**
+	 * @brief is_trivially_relocatable
+	 *
+	 * 객체를 memcpy로 다른 주소에 옮긴 후 원래 자리는 소멸시키지 않고 버려도 되는 타입인지 식별한다.
+	 * trivially copyable이면 항상 가능하다. 자기 주소를 저장하지 않고 heap만 가리키는 handle 같은 타입은 특수화해서 true로 둘 수 있다.
+	 * (libstdc++의 std::string은 짧은 문자열을 내부 buffer에 두고 그 주소를 가지므로 해당하지 않는다.)
+	 * vector가 요소를 지운 자리를 채울 때 대입 대신 memmove/memcpy로 옮긴다.
+	 */
+	template <typename T>
+	struct is_trivially_relocatable
+	{
+		static const bool value = ft::is_trivially_copyable<T>::value;
+	};
+
+	/**
+	 * @brief is_nothrow_copyable
+	 *
+	 * 복사 생성과 복사 대입이 예외를 던지지 않는 타입인지 식별한다. (trivially copyable이거나 throw()로 선언한 경우)
+	 * 컴파일러 builtin을 사용할 수 없으면 trivially copyable인 타입만 true로 둔다. 예외를 던지지 않는 타입은 특수화해서 true로 둘 수 있다.
+	 * mpmc_queue처럼 slot을 선점한 후에는 되돌릴 수 없는 곳에서 요소 타입을 제한할 때 사용한다.
+	 */
+	template <typename T>
+	struct is_nothrow_copyable
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		static const bool value = __has_nothrow_copy(T) && __has_nothrow_assign(T);
+#else
+		static const bool value = ft::is_trivially_copyable<T>::value;
+#endif
+	};
+
+	/**
+	 * @brief contiguous_iterator
+	 *
+	 * 원소가 연속된 메모리에 있는 iterator인지 식별하고, 가리키는 주소를 꺼내는 방법을 알려준다.
+	 * 포인터와 VectorIterator(VectorIterator.hpp에서 특수화)가 해당한다.
+	 * vector의 assign/insert가 trivially copyable 원소를 memcpy 한 번으로 복사할 때 사용한다.
+	 */
+	template <typename Iterator>
+	struct contiguous_iterator
+	{
+		static const bool value = false;
+		typedef void value_type;
+	};
+
+	template <typename T>
+	struct contiguous_iterator<T*>
+	{
+		static const bool value = true;
+		typedef T value_type;
+		static T* address(T* it) { return (it); }
+	};
+
+	/**
+	 * @brief ebo_holder
+	 *
+	 * T 하나를 저장한다. T가 빈 class이면 멤버가 아닌 base class로 두어 크기를 차지하지 않게 한다. (empty base optimization)
+	 * 빈 class도 멤버로 두면 1 byte에 정렬까지 더해져 포인터 하나 크기가 늘어난다.
+	 * 상태가 있는 객체(ex. 정렬 방향을 멤버로 가지는 비교 함수 객체)나 함수 포인터는 그대로 멤버로 저장된다.
+	 * map::value_compare처럼 비교 함수 객체를 감싸는 class가 상속하면, 감싼 class도 빈 class가 된다.
+	 *
+	 * @tparam T	빈 class일 수 있는 policy 타입 (비교 함수 객체, allocator)
+	 */
+	template <typename T, bool = ft::is_empty<T>::value>
+	class ebo_holder : private T
+	{
+		public:
+			ebo_holder() : T() {}
+			ebo_holder(const T& x) : T(x) {}
+
+			T& get() { return (*this); }
+			const T& get() const { return (*this); }
+	};
+
+	template <typename T>
+	class ebo_holder<T, false>
+	{
+		private:
+			T	_value;
+
+		public:
+			ebo_holder() : _value() {}
+			ebo_holder(const T& x) : _value(x) {}
+
+			T& get() { return (this->_value); }
+			const T& get() const { return (this->_value); }
+	};
+
+	/**
+	 * @brief compressed_pair
+	 *
+	 * first를 ebo_holder로 저장하는 pair. first가 빈 class이면 second 하나의 크기가 된다.
+	 * RBTree가 비교 함수 객체와 allocator를 size와 같은 자리에 저장할 때 사용한다.
+	 */
+	template <typename T1, typename T2>
+	class compressed_pair : private ft::ebo_holder<T1>
+	{
+		private:
+			T2	_second;
+
+		public:
+			compressed_pair() : ft::ebo_holder<T1>(), _second() {}
+			compressed_pair(const T1& a, const T2& b) : ft::ebo_holder<T1>(a), _second(b) {}
+
+			T1& first() { return (this->get()); }
+			const T1& first() const { return (this->get()); }
+			T2& second() { return (this->_second); }
+			const T2& second() const { return (this->_second); }
+	};
+
 	//equality
 	template <class InputIterator1, class InputIterator2>
 	bool equal (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
@@ -343,6 +602,86 @@ namespace ft
 			return (x < y);
 		}
 	};
+
+	/**
+	 * @brief greater
+	 * Function object class for greater-than inequality comparison.
+	 * 첫 번째 인수가 두 번째 인수보다 큰지(operator>에 의해 반환됨)를 반환하는 binary function
+	 * priority_queue에 넘기면 가장 작은 값이 top이 되는 min-heap으로 동작한다.
+	 *
+	 * @tparam T	Type of the arguments to compare by the functional call.
+	 */
+	template <class T>
+	struct greater : binary_function<T, T, bool>
+	{
+		bool operator()(const T& x, const T& y) const
+		{
+			return (x > y);
+		}
+	};
+
+	/**
+	 * @brief three_way_traits
+	 *
+	 * 비교 함수 객체로 두 값을 한 번에 비교(<0, 0, >0)하는 방법을 알려주는 traits
+	 * tree 탐색에서 노드마다 comp(a, b), comp(b, a)를 두 번 부르는 대신 compare 한 번으로 방향과 일치 여부를 같이 얻는다.
+	 * - enabled	: compare가 실제로 한 번의 비교로 끝나는지 여부
+	 * - compare	: enabled가 false이면 comp를 두 번 호출하는 방식으로 동작한다.
+	 *
+	 * std::string처럼 compare 멤버함수가 있는 key는 operator<가 내부에서 compare를 부르므로
+	 * less로 두 번 비교하면 긴 공통 prefix를 두 번 훑게 된다.
+	 * 직접 만든 비교 함수 객체는 key_three_way를 특수화하거나 (prefixed_string.hpp 참고)
+	 * "static const bool three_way"와 "int compare(a, b) const" 멤버를 정의하면 사용된다. (map::value_compare 참고)
+	 */
+	template <class Compare>
+	struct key_three_way
+	{
+		static const bool enabled = false;
+
+		template <class T>
+		static int compare(const Compare& comp, const T& x, const T& y)
+		{
+			if (comp(x, y))
+				return (-1);
+			return (comp(y, x) ? 1 : 0);
+		}
+	};
+
+	template <class Char, class Traits, class Alloc>
+	struct key_three_way< ft::less< std::basic_string<Char, Traits, Alloc> > >
+	{
+		static const bool enabled = true;
+
+		static int compare(const ft::less< std::basic_string<Char, Traits, Alloc> >&, const std::basic_string<Char, Traits, Alloc>& x, const std::basic_string<Char, Traits, Alloc>& y)
+		{
+			return (x.compare(y));
+		}
+	};
+
+	//Compare에 "static const bool three_way" 멤버가 있는지 확인한다.
+	template <class Compare>
+	struct has_three_way_member
+	{
+		template <bool B> struct probe {};
+		template <class U> static char test(probe<U::three_way>*);
+		template <class U> static long test(...);
+		static const bool value = (sizeof(test<Compare>(0)) == sizeof(char));
+	};
+
+	template <class Compare, bool Member = has_three_way_member<Compare>::value>
+	struct three_way_traits : public key_three_way<Compare> {};
+
+	template <class Compare>
+	struct three_way_traits<Compare, true>
+	{
+		static const bool enabled = Compare::three_way;
+
+		template <class T>
+		static int compare(const Compare& comp, const T& x, const T& y)
+		{
+			return (comp.compare(x, y));
+		}
+	};
 }
 
 #endif
@@ -4,8 +4,10 @@
 // #include <vector>
 #include <memory>
 #include <stdexcept>
+#include <cstring>
 #include "VectorIterator.hpp"
 #include "utils.hpp"
+#include "stream_store.hpp"
 
 /**
  * @brief vector
@@ -115,6 +117,30 @@
  */
 namespace ft
 {
+	/**
+	 * @brief vector_range_tag
+	 *
+	 * vector의 range 생성자/assign/insert가 사용할 구현을 고른다.
+	 * 원본이 연속된 메모리(포인터, VectorIterator)이고 원소가 vector와 같은 trivially copyable 타입이면 memcpy_tag,
+	 * 아니면 iterator category를 그대로 사용한다.
+	 */
+	struct memcpy_tag {};
+
+	template <typename Iterator, typename T,
+		bool = ft::contiguous_iterator<Iterator>::value
+			&& ft::is_same<typename ft::remove_const<typename ft::contiguous_iterator<Iterator>::value_type>::type, T>::value
+			&& ft::is_trivially_copyable<T>::value>
+	struct vector_range_tag
+	{
+		typedef typename ft::iterator_category_of<Iterator>::type type;
+	};
+
+	template <typename Iterator, typename T>
+	struct vector_range_tag<Iterator, T, true>
+	{
+		typedef ft::memcpy_tag type;
+	};
+
 	template < typename T, typename Allocator = std::allocator<T> >
 	class vector
 	{
@@ -179,8 +205,7 @@ namespace ft
 			this->_start = this->_alloc.allocate(n);
 			this->_end = this->_start;
 			this->_end_of_capacity = this->_start + n;
-			while (n--)
-				this->_alloc.construct(this->_end++, val); //각 요소는 val의 복사본
+			this->fill_end(n, val); //각 요소는 val의 복사본
 		}
 
 		//range constructor
@@ -190,15 +215,7 @@ namespace ft
 				typename ft::enable_if< !ft::is_integral< InputIterator >::value, InputIterator >::type* = NULL)
 		: _alloc(alloc), _start(NULL), _end(NULL), _end_of_capacity(NULL)
 		{
-			//type
-			difference_type n = ft::distance(first, last);
-			// while (first++ != last)
-			//   n++;
-			this->_start = this->_alloc.allocate(n);
-			this->_end = this->_start;
-			this->_end_of_capacity = this->_start + n;
-			while (n--)
-				this->_alloc.construct(this->_end++, *first++);
+			this->range_init(first, last, typename ft::vector_range_tag<InputIterator, T>::type());
 		}
 
 		//copy constructor
@@ -208,10 +225,17 @@ namespace ft
 			difference_type n = x._end - x._start;
 			this->_start = this->_alloc.allocate(n);
 			this->_end = this->_start;
+			this->_end_of_capacity = this->_start + n;
+			if (ft::is_trivially_copyable<value_type>::value)
+			{
+				if (n)
+					ft::bulk_copy(this->_start, x._start, n * sizeof(value_type));
+				this->_end = this->_end_of_capacity;
+				return ;
+			}
 			pointer tmp = x._start;
 			while (n--)
 				_alloc.construct(_end++, *tmp++);
-			this->_end_of_capacity = this->_end;
 		}
 
 		//destructor
@@ -329,20 +353,27 @@ namespace ft
 				throw(std::length_error("Error: ft::vector::reserve"));
 			else if (n > this->capacity())
 			{
-				pointer prev_start = this->_start;
-				pointer prev_end = this->_end;
-				pointer prev_end_of_capacity = this->_end_of_capacity;
-
-				this->_start = this->_alloc.allocate(n);
-				this->_end = this->_start;
-				this->_end_of_capacity = this->_start + n;
-				pointer tmp = prev_start;
-				while (tmp != prev_end)
+				//새 메모리에 모두 복사한 후에 원래 원소를 지운다. 복사가 예외를 던지면 새 메모리만 정리하고 vector는 그대로 둔다.
+				pointer new_start = this->_alloc.allocate(n);
+				pointer new_end = new_start;
+				try
 				{
-					this->_alloc.construct(this->_end++, *tmp);
-					this->_alloc.destroy(tmp++);
+					for (pointer tmp = this->_start; tmp != this->_end; ++tmp, ++new_end)
+						this->_alloc.construct(new_end, *tmp);
 				}
-				this->_alloc.deallocate(prev_start, prev_end_of_capacity - prev_start);
+				catch (...)
+				{
+					while (new_end != new_start)
+						this->_alloc.destroy(--new_end);
+					this->_alloc.deallocate(new_start, n);
+					throw ;
+				}
+				for (pointer tmp = this->_start; tmp != this->_end; ++tmp)
+					this->_alloc.destroy(tmp);
+				this->_alloc.deallocate(this->_start, this->_end_of_capacity - this->_start);
+				this->_start = new_start;
+				this->_end = new_end;
+				this->_end_of_capacity = new_start + n;
 			}
 		}
 
@@ -423,25 +454,7 @@ namespace ft
 					typename ft::enable_if< !ft::is_integral< InputIterator >::value, InputIterator >::type * = NULL)
 		{
 			this->clear();
-			size_type n = ft::distance(first, last);
-			if (n <= this->capacity())
-			{
-				while (n--)
-					this->_alloc.construct(this->_end++, *first++);
-			}
-			else
-			{
-				pointer prev_start = this->_start;
-				pointer prev_end_of_capacity = this->_end_of_capacity;
-
-				this->_start = this->_alloc.allocate(n);
-				this->_end = this->_start;
-				this->_end_of_capacity = this->_start + n;
-				const_pointer tmp = &(*first);
-				while(tmp != &(*last))
-					this->_alloc.construct(this->_end++, *tmp++);
-				this->_alloc.deallocate(prev_start, prev_end_of_capacity - prev_start);
-			}
+			this->range_assign(first, last, typename ft::vector_range_tag<InputIterator, T>::type());
 		}
 
 		//assign range
@@ -449,10 +462,7 @@ namespace ft
 		{
 			this->clear();
 			if (n <= this->capacity())
-			{
-				while (n--)
-					this->_alloc.construct(this->_end++, val);
-			}
+				this->fill_end(n, val);
 			else
 			{
 				pointer prev_start = this->_start;
@@ -461,8 +471,7 @@ namespace ft
 				this->_start = this->_alloc.allocate(n);
 				this->_end = this->_start;
 				this->_end_of_capacity = this->_start + n;
-				while (n--)
-					this->_alloc.construct(this->_end++, val);
+				this->fill_end(n, val);
 				this->_alloc.deallocate(prev_start, prev_end_of_capacity - prev_start);
 			}
 		}
@@ -479,7 +488,9 @@ namespace ft
 				else
 					this->reserve(this->capacity() * 2);
 			}
-			this->_alloc.construct(this->_end++, val);
+			//construct가 예외를 던지면 _end를 늘리지 않는다.
+			this->_alloc.construct(this->_end, val);
+			++this->_end;
 		}
 
 		// 벡터의 맨 뒤 요소를 하나 제거한다.
@@ -496,7 +507,7 @@ namespace ft
 		//1.single element insert
 		iterator insert(iterator position, const value_type &val)
 		{
-			size_type n = &(*position) - this->_start;
+			size_type n = position - this->begin();
 			this->insert(position, 1, val);
 			return (this->begin() + n);
 		}
@@ -504,38 +515,53 @@ namespace ft
 		//2.fill element insert
 		void insert(iterator position, size_type n, const value_type &val)
 		{
+			pointer pos = this->_start + (position - this->begin());
 			if (this->size() + n <= this->capacity())
 			{
-				pointer val_tmp = this->_end;
-				size_type range = this->_end - &(*position);
-				this->_end += n;
-				pointer tmp = this->_end;
-				while (range--)
-					this->_alloc.construct(--tmp, *(--val_tmp));
-				while (n--)
-					this->_alloc.construct(--tmp, val);
+				//val이 vector 안의 원소일 수 있으므로 옮기기 전에 복사해둔다.
+				//끝을 넘어가는 자리는 생성하고, 이미 원소가 있는 자리는 대입한다.
+				value_type copy = val;
+				pointer old_end = this->_end;
+				size_type tail = old_end - pos;
+				//_end는 construct가 끝난 후에 늘려 예외가 나도 생성된 원소까지만 vector에 남긴다.
+				if (tail > n)
+				{
+					for (pointer src = old_end - n; src != old_end; ++src, ++this->_end)
+						this->_alloc.construct(this->_end, *src);
+					for (pointer src = old_end - n, dst = old_end; src != pos;)
+						*--dst = *--src;
+					for (; n > 0; --n)
+						*pos++ = copy;
+				}
+				else
+				{
+					for (size_type i = tail; i < n; ++i, ++this->_end)
+						this->_alloc.construct(this->_end, copy);
+					for (pointer src = pos; src != old_end; ++src, ++this->_end)
+						this->_alloc.construct(this->_end, *src);
+					for (; pos != old_end; ++pos)
+						*pos = copy;
+				}
 			}
 			else
 			{
-				pointer tmp = this->_start;
+				//val이 기존 원소일 수 있으므로 새 배열을 모두 채운 후에 기존 원소를 destroy한다.
+				pointer prev_start = this->_start;
+				pointer prev_end = this->_end;
+				size_type prev_capacity = this->capacity();
 				size_type _size = n + this->size();
-				size_type front_tmp = &(*position) - this->_start;
-				size_type back_tmp = _end - &(*position);
 				this->_start = _alloc.allocate(_size);
 				this->_end = _start;
 				this->_end_of_capacity = this->_start + _size;
-				while (front_tmp--)
-				{
+				for (pointer tmp = prev_start; tmp != pos; ++tmp)
 					_alloc.construct(this->_end++, *tmp);
-					_alloc.destroy(tmp++);
-				}
 				while (n--)
 					_alloc.construct(this->_end++, val);
-				while (back_tmp--)
-				{
+				for (pointer tmp = pos; tmp != prev_end; ++tmp)
 					_alloc.construct(this->_end++, *tmp);
-					_alloc.destroy(tmp++);
-				}
+				for (pointer tmp = prev_start; tmp != prev_end; ++tmp)
+					_alloc.destroy(tmp);
+				this->_alloc.deallocate(prev_start, prev_capacity);
 			}
 		}
 
@@ -544,78 +570,119 @@ namespace ft
 		void insert(iterator position, InputIterator first, InputIterator last,
 			typename ft::enable_if< !ft::is_integral< InputIterator >::value >::type* = NULL)
 		{
-			size_type n = ft::distance(first, last);
-			if (this->size() + n <= this->capacity())
-			{
-				pointer val_tmp = this->_end;
-				size_type range = this->_end - &(*position);
-				this->_end += n;
-				pointer tmp = this->_end;
-				while (range--)
-					this->_alloc.construct(--tmp, *(--val_tmp));
-				while (n--)
-					this->_alloc.construct(--tmp, *(--last));
-			}
-			else
-			{
-				pointer tmp = this->_start;
-				size_type _size = n + this->size();
-				size_type front_tmp = &(*position) - this->_start;
-				size_type back_tmp = this->_end - &(*position);
-				this->_start = this->_alloc.allocate(_size);
-				this->_end = this->_start;
-				this->_end_of_capacity = this->_start + _size;
-				while (front_tmp--)
-				{
-					_alloc.construct(this->_end++, *tmp);
-					_alloc.destroy(tmp++);
-				}
-				while (n--)
-					_alloc.construct(this->_end++, *first++);
-				while (back_tmp--)
-				{
-					_alloc.construct(this->_end++, *tmp);
-					_alloc.destroy(tmp++);
-				}
-			}
+			this->range_insert(position, first, last, typename ft::vector_range_tag<InputIterator, T>::type());
 		}
 
 		//단일 요소(위치) 제거
 		iterator erase(iterator position)
 		{
-			this->_alloc.destroy(&(*position));
-			size_type n = this->_end - &(*position) - 1;
-			pointer tmp = &(*position);
+			return (this->erase(position, position + 1));
+		}
 
-			while (n--)
+		//범위[first, last) 제거
+		//뒤의 요소를 앞으로 대입해서 당기고 끝에 남는 요소만 destroy한다. (요소마다 construct/destroy하지 않는다.)
+		//trivially relocatable이면 지울 요소를 destroy한 후 memmove 한 번으로 당긴다.
+		iterator erase(iterator first, iterator last)
+		{
+			pointer dst = this->_start + (first - this->begin());
+			pointer src = this->_start + (last - this->begin());
+			if (dst == src)
+				return (first);
+			if (ft::is_trivially_relocatable<value_type>::value)
 			{
-				this->_alloc.construct(tmp, *(tmp + 1));
-				this->_alloc.destroy(tmp++);
+				for (pointer p = dst; p != src; ++p)
+					this->_alloc.destroy(p);
+				size_type n = this->_end - src;
+				std::memmove(static_cast<void*>(dst), src, n * sizeof(value_type));
+				this->_end = dst + n;
+				return (first);
 			}
-			--this->_end;
+			while (src != this->_end)
+				*dst++ = *src++;
+			while (this->_end != dst)
+				this->_alloc.destroy(--this->_end);
+			return (first);
+		}
+
+		/**
+		 * @brief unordered_erase
+		 *
+		 * position의 요소를 지우고 그 자리를 마지막 요소로 채운다. 뒤의 요소를 당기지 않으므로 O(1)이지만 순서가 바뀐다.
+		 * position을 반환한다. (마지막 요소를 지웠다면 end())
+		 */
+		iterator unordered_erase(iterator position)
+		{
+			pointer hole = this->_start + (position - this->begin());
+			pointer back = this->_end - 1;
+			if (hole != back)
+			{
+				if (ft::is_trivially_relocatable<value_type>::value)
+				{
+					this->_alloc.destroy(hole);
+					std::memcpy(static_cast<void*>(hole), back, sizeof(value_type));
+					--this->_end;
+					return (position);
+				}
+				*hole = *back;
+			}
+			this->_alloc.destroy(--this->_end);
 			return (position);
 		}
 
-		//범위[first, last) 제거
-		iterator erase(iterator first, iterator last)
+		/**
+		 * @brief erase_indices
+		 *
+		 * [first, last)의 index에 있는 요소를 모두 지우고 지운 수를 반환한다. 남는 요소의 순서는 그대로이다.
+		 * index마다 erase를 부르면 매번 뒤를 모두 당기므로 O(n * k)이다. 지울 index 사이의 구간을 한 번씩만 당겨서 O(n + k)로 끝낸다.
+		 * index는 오름차순이고 중복이 없어야 한다. 먼저 모두 확인하므로 범위를 벗어나거나(out_of_range) 정렬되지 않았으면(invalid_argument) 아무것도 지우지 않는다.
+		 */
+		template <typename ForwardIterator>
+		size_type erase_indices(ForwardIterator first, ForwardIterator last)
 		{
-			pointer tmp = &(*first);
-			while (tmp != &(*last))
-				_alloc.destroy(tmp++);
-			size_type n = this->_end - &(*last);
-			size_type range = ft::distance(first, last);
-			tmp = &(*first);
-			while (n--)
+			size_type count = 0;
+			size_type prev = 0;
+			for (ForwardIterator it = first; it != last; ++it, ++count)
 			{
-				_alloc.construct(tmp, *last++);
-				_alloc.destroy(tmp++);
+				size_type index = static_cast<size_type>(*it);
+				if (index >= this->size())
+					throw(std::out_of_range("Error: ft::vector::erase_indices"));
+				if (count > 0 && index <= prev)
+					throw(std::invalid_argument("Error: ft::vector::erase_indices"));
+				prev = index;
 			}
-			this->_end -= range;
-			return (first);
+			if (count == 0)
+				return (0);
+			const bool relocate = ft::is_trivially_relocatable<value_type>::value;
+			pointer dst = this->_start + static_cast<size_type>(*first);
+			pointer src = dst;
+			while (first != last)
+			{
+				//src는 지울 요소이다. 다음으로 지울 요소 전까지를 dst로 당긴다.
+				if (relocate)
+					this->_alloc.destroy(src);
+				++src;
+				pointer next = (++first == last) ? this->_end : this->_start + static_cast<size_type>(*first);
+				if (relocate)
+				{
+					std::memmove(static_cast<void*>(dst), src, (next - src) * sizeof(value_type));
+					dst += next - src;
+					src = next;
+				}
+				else
+				{
+					while (src != next)
+						*dst++ = *src++;
+				}
+			}
+			if (relocate)
+				this->_end = dst;
+			while (this->_end != dst)
+				this->_alloc.destroy(--this->_end);
+			return (count);
 		}
 
 		void swap(vector &x) {
-			if (*this == x)
+			if (this == &x)
 				return ;
 
 			allocator_type tmp_alloc = x._alloc;
@@ -646,6 +713,198 @@ namespace ft
 		{
 			return (this->_alloc);
 		}
+
+		/**
+		 * @brief range helpers
+		 * range constructor, assign, insert가 iterator category에 따라 고르는 구현
+		 * forward iterator 이상 : ft::distance로 크기를 먼저 구해 한 번만 할당한다. (random access면 distance가 O(1))
+		 * input iterator : 범위를 두 번 읽을 수 없으므로(istream_iterator 등) 한 번 읽으면서 push_back처럼 늘린다.
+		 * memcpy_tag : 연속된 메모리의 trivially copyable 원소는 원소마다 construct하지 않고 memcpy/memmove 한 번으로 옮긴다.
+		 *              (allocator의 construct를 거치지 않는다. 겹치지 않는 복사는 bulk_copy가 크기에 따라 streaming store를 고른다.)
+		 */
+		private:
+		//_end부터 val의 복사본 n개를 만든다. (capacity는 이미 충분하다)
+		//trivially copyable이면 construct 대신 bulk_fill로 채운다. 아주 큰 범위는 cache를 거치지 않는 streaming store를 사용한다. (stream_store.hpp)
+		void fill_end(size_type n, const value_type &val)
+		{
+			if (ft::is_trivially_copyable<value_type>::value)
+			{
+				ft::bulk_fill(this->_end, val, n);
+				this->_end += n;
+				return ;
+			}
+			while (n--)
+				this->_alloc.construct(this->_end++, val);
+		}
+
+		template <typename InputIterator>
+		void range_init(InputIterator first, InputIterator last, ft::input_iterator_tag)
+		{
+			for (; first != last; ++first)
+				this->push_back(*first);
+		}
+
+		template <typename ForwardIterator>
+		void range_init(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+		{
+			size_type n = ft::distance(first, last);
+			this->_start = this->_alloc.allocate(n);
+			this->_end = this->_start;
+			this->_end_of_capacity = this->_start + n;
+			for (; first != last; ++first)
+				this->_alloc.construct(this->_end++, *first);
+		}
+
+		template <typename ContiguousIterator>
+		void range_init(ContiguousIterator first, ContiguousIterator last, ft::memcpy_tag)
+		{
+			size_type n = last - first;
+			this->_start = this->_alloc.allocate(n);
+			this->_end = this->_start + n;
+			this->_end_of_capacity = this->_end;
+			if (n)
+				ft::bulk_copy(this->_start, ft::contiguous_iterator<ContiguousIterator>::address(first), n * sizeof(value_type));
+		}
+
+		template <typename InputIterator>
+		void range_assign(InputIterator first, InputIterator last, ft::input_iterator_tag)
+		{
+			for (; first != last; ++first)
+				this->push_back(*first);
+		}
+
+		template <typename ForwardIterator>
+		void range_assign(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+		{
+			size_type n = ft::distance(first, last);
+			if (n > this->capacity())
+			{
+				this->_alloc.deallocate(this->_start, this->_end_of_capacity - this->_start);
+				this->_start = this->_alloc.allocate(n);
+				this->_end = this->_start;
+				this->_end_of_capacity = this->_start + n;
+			}
+			for (; first != last; ++first)
+				this->_alloc.construct(this->_end++, *first);
+		}
+
+		//새 메모리에 먼저 복사한 후 예전 메모리를 돌려주므로 자기 자신의 범위를 assign해도 된다.
+		template <typename ContiguousIterator>
+		void range_assign(ContiguousIterator first, ContiguousIterator last, ft::memcpy_tag)
+		{
+			size_type n = last - first;
+			const value_type* src = ft::contiguous_iterator<ContiguousIterator>::address(first);
+			if (n > this->capacity())
+			{
+				pointer prev_start = this->_start;
+				size_type prev_capacity = this->capacity();
+				this->_start = this->_alloc.allocate(n);
+				this->_end_of_capacity = this->_start + n;
+				ft::bulk_copy(this->_start, src, n * sizeof(value_type));
+				this->_alloc.deallocate(prev_start, prev_capacity);
+			}
+			else if (n)
+				std::memmove(this->_start, src, n * sizeof(value_type));
+			this->_end = this->_start + n;
+		}
+
+		//input iterator는 임시 vector에 한 번 읽어 둔 후 그 범위를 삽입한다.
+		template <typename InputIterator>
+		void range_insert(iterator position, InputIterator first, InputIterator last, ft::input_iterator_tag)
+		{
+			vector tmp(first, last, this->_alloc);
+			this->range_insert(position, tmp._start, tmp._end, typename ft::vector_range_tag<pointer, T>::type());
+		}
+
+		template <typename ForwardIterator>
+		void range_insert(iterator position, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+		{
+			size_type n = ft::distance(first, last);
+			pointer pos = this->_start + (position - this->begin());
+			if (this->size() + n <= this->capacity())
+			{
+				//끝을 넘어가는 자리는 생성하고, 이미 원소가 있는 자리는 대입한다.
+				pointer old_end = this->_end;
+				size_type tail = old_end - pos;
+				if (tail > n)
+				{
+					for (pointer src = old_end - n; src != old_end; ++src, ++this->_end)
+						this->_alloc.construct(this->_end, *src);
+					for (pointer src = old_end - n, dst = old_end; src != pos;)
+						*--dst = *--src;
+					for (; n > 0; --n)
+						*pos++ = *first++;
+				}
+				else
+				{
+					ForwardIterator mid = first;
+					ft::advance(mid, tail);
+					for (ForwardIterator it = mid; it != last; ++it, ++this->_end)
+						this->_alloc.construct(this->_end, *it);
+					for (pointer src = pos; src != old_end; ++src, ++this->_end)
+						this->_alloc.construct(this->_end, *src);
+					for (; first != mid; ++first)
+						*pos++ = *first;
+				}
+			}
+			else
+			{
+				pointer tmp = this->_start;
+				pointer prev_start = this->_start;
+				size_type prev_capacity = this->capacity();
+				size_type _size = n + this->size();
+				size_type front_tmp = pos - this->_start;
+				size_type back_tmp = this->_end - pos;
+				this->_start = this->_alloc.allocate(_size);
+				this->_end = this->_start;
+				this->_end_of_capacity = this->_start + _size;
+				while (front_tmp--)
+				{
+					_alloc.construct(this->_end++, *tmp);
+					_alloc.destroy(tmp++);
+				}
+				while (n--)
+					_alloc.construct(this->_end++, *first++);
+				while (back_tmp--)
+				{
+					_alloc.construct(this->_end++, *tmp);
+					_alloc.destroy(tmp++);
+				}
+				this->_alloc.deallocate(prev_start, prev_capacity);
+			}
+		}
+
+		template <typename ContiguousIterator>
+		void range_insert(iterator position, ContiguousIterator first, ContiguousIterator last, ft::memcpy_tag)
+		{
+			size_type n = last - first;
+			if (n == 0)
+				return ;
+			const value_type* src = ft::contiguous_iterator<ContiguousIterator>::address(first);
+			pointer pos = this->_start + (position - this->begin());
+			size_type front = pos - this->_start;
+			size_type back = this->_end - pos;
+			if (this->size() + n <= this->capacity())
+			{
+				std::memmove(pos + n, pos, back * sizeof(value_type));
+				std::memcpy(pos, src, n * sizeof(value_type));
+				this->_end += n;
+				return ;
+			}
+			pointer prev_start = this->_start;
+			size_type prev_capacity = this->capacity();
+			size_type _size = n + this->size();
+			this->_start = this->_alloc.allocate(_size);
+			this->_end = this->_start + _size;
+			this->_end_of_capacity = this->_end;
+			//새 메모리로의 복사는 겹치지 않으므로 bulk_copy를 쓴다. 비어 있던 vector는 prev_start가 NULL이므로 앞뒤가 0이면 복사하지 않는다.
+			if (front)
+				ft::bulk_copy(this->_start, prev_start, front * sizeof(value_type));
+			ft::bulk_copy(this->_start + front, src, n * sizeof(value_type));
+			if (back)
+				ft::bulk_copy(this->_start + front + n, prev_start + front, back * sizeof(value_type));
+			this->_alloc.deallocate(prev_start, prev_capacity);
+		}
 	};
 
 	/**
@@ -703,6 +962,39 @@ namespace ft
 	{
 		x.swap(y);
 	}
+
+	/**
+	 * @brief erase_if
+	 *
+	 * pred가 true인 요소를 모두 지우고 지운 수를 반환한다.
+	 * erase를 반복하면 지울 때마다 뒤의 요소를 모두 당기므로 O(n^2)이다.
+	 * 남길 요소를 처음 지울 요소의 자리부터 차례로 대입해 한 번에 당기고, 끝에 남은 요소만 erase한다. O(n)
+	 * vector<bool>도 같은 방법으로 bit를 당긴다.
+	 */
+	template <typename T, typename Alloc, typename Predicate>
+	typename vector<T, Alloc>::size_type erase_if(vector<T, Alloc>& c, Predicate pred)
+	{
+		typedef typename vector<T, Alloc>::iterator	iterator;
+		iterator last = c.end();
+		iterator dst = c.begin();
+		while (dst != last && !pred(*dst))
+			++dst;
+		if (dst == last)
+			return (0);
+		for (iterator src = dst; ++src != last; )
+		{
+			if (!pred(*src))
+			{
+				*dst = *src;
+				++dst;
+			}
+		}
+		typename vector<T, Alloc>::size_type n = last - dst;
+		c.erase(dst, last);
+		return (n);
+	}
 }
 
+#include "vector_bool.hpp"
+
 #endif
@@ -0,0 +1,899 @@
+#ifndef VECTOR_BOOL_HPP
+# define VECTOR_BOOL_HPP
+
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+#include "iterator.hpp"
+#include "utils.hpp"
+
+/**
+ * @brief vector<bool>
+ *
+ * bool을 원소 하나당 1 bit로 저장하는 vector의 특수화. (vector.hpp의 끝에서 include한다.)
+ * 일반 vector<bool>은 원소 하나에 1 byte를 사용하므로 flag가 많으면 필요한 메모리의 8배를 사용한다.
+ *
+ * bit는 unsigned long(word) 배열에 index 순서대로 저장된다. i번째 bit는 word[i / word_bits]의 (i % word_bits)번째 bit이다.
+ * - bit 하나는 주소를 가질 수 없으므로 reference는 word 포인터와 mask를 가지는 proxy(bit_reference)이고, const_reference는 bool이다.
+ * - iterator는 word 포인터와 word 안의 offset을 가지는 random access iterator이다. ft::reverse_iterator로 감쌀 수 있다.
+ * - size() 이후의 bit는 항상 0으로 유지한다. 그래서 count, find, 비교는 마지막 word를 따로 mask하지 않고 word 단위로 처리할 수 있다.
+ *
+ * 표준 vector 인터페이스 외에 word 단위로 처리하는 연산을 제공한다.
+ * count		: 1인 bit의 수 (word마다 popcount)
+ * find_first	: 첫 번째 1인 bit의 index, 없으면 npos (0이 아닌 word를 찾은 후 count trailing zeros)
+ * find_next	: pos 다음에 오는 첫 번째 1인 bit의 index, 없으면 npos
+ * rank		: [0, pos)에서 1인 bit의 수
+ * &=, |=, ^=	: 같은 크기의 vector<bool>과 word 단위 bit 연산. 크기가 다르면 invalid_argument를 던진다.
+ */
+namespace ft
+{
+	typedef unsigned long	bit_word;
+
+	const size_t	bit_word_bits = sizeof(bit_word) * CHAR_BIT;
+
+	//1인 bit의 수
+	//popcnt 명령을 쓸 수 있으면 builtin을 사용한다. 그렇지 않으면 builtin은 libgcc의 table 함수를 호출하므로 SWAR로 직접 센다.
+	inline size_t bit_popcount(bit_word w)
+	{
+#if defined(__POPCNT__) && (defined(__GNUC__) || defined(__clang__))
+		return (__builtin_popcountl(w));
+#else
+		const bit_word m1 = ~bit_word(0) / 3;
+		const bit_word m2 = ~bit_word(0) / 5;
+		const bit_word m4 = ~bit_word(0) / 17;
+		const bit_word h01 = ~bit_word(0) / 255;
+		w -= (w >> 1) & m1;
+		w = (w & m2) + ((w >> 2) & m2);
+		w = (w + (w >> 4)) & m4;
+		return ((w * h01) >> (bit_word_bits - CHAR_BIT));
+#endif
+	}
+
+	//가장 낮은 1인 bit의 위치. w는 0이 아니어야 한다.
+	inline size_t bit_ctz(bit_word w)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		return (__builtin_ctzl(w));
+#else
+		size_t n = 0;
+		for (; !(w & 1); w >>= 1)
+			++n;
+		return (n);
+#endif
+	}
+
+	/**
+	 * @brief bit_reference
+	 *
+	 * vector<bool>의 원소 하나를 가리키는 proxy.
+	 * bool로 변환하면 bit를 읽고, bool을 대입하면 word의 해당 bit만 바꾼다.
+	 */
+	class bit_reference
+	{
+		private:
+			bit_word*	_word;
+			bit_word	_mask;
+
+		public:
+			bit_reference(bit_word* word, bit_word mask) : _word(word), _mask(mask) {}
+
+			operator bool() const
+			{
+				return ((*this->_word & this->_mask) != 0);
+			}
+
+			bit_reference& operator=(bool x)
+			{
+				if (x)
+					*this->_word |= this->_mask;
+				else
+					*this->_word &= ~this->_mask;
+				return (*this);
+			}
+
+			//proxy끼리 대입하면 가리키는 bit가 아닌 값을 복사한다.
+			bit_reference& operator=(const bit_reference& x)
+			{
+				return (*this = static_cast<bool>(x));
+			}
+
+			bool operator~() const
+			{
+				return (!static_cast<bool>(*this));
+			}
+
+			void flip()
+			{
+				*this->_word ^= this->_mask;
+			}
+	};
+
+	/**
+	 * @brief bit_iterator_base
+	 *
+	 * bit_iterator와 bit_const_iterator가 공유하는 위치(word 포인터, word 안의 offset)와 이동, 비교 연산
+	 */
+	struct bit_iterator_base
+	{
+		bit_word*		_p;
+		unsigned int	_offset;
+
+		bit_iterator_base(bit_word* p, unsigned int offset) : _p(p), _offset(offset) {}
+
+		void bump_up()
+		{
+			if (this->_offset++ == bit_word_bits - 1)
+			{
+				this->_offset = 0;
+				++this->_p;
+			}
+		}
+
+		void bump_down()
+		{
+			if (this->_offset-- == 0)
+			{
+				this->_offset = bit_word_bits - 1;
+				--this->_p;
+			}
+		}
+
+		void incr(ptrdiff_t i)
+		{
+			const ptrdiff_t bits = static_cast<ptrdiff_t>(bit_word_bits);
+			ptrdiff_t n = i + this->_offset;
+			this->_p += n / bits;
+			n %= bits;
+			if (n < 0)
+			{
+				n += bits;
+				--this->_p;
+			}
+			this->_offset = static_cast<unsigned int>(n);
+		}
+	};
+
+	inline bool operator==(const bit_iterator_base& lhs, const bit_iterator_base& rhs)
+	{
+		return (lhs._p == rhs._p && lhs._offset == rhs._offset);
+	}
+
+	inline bool operator!=(const bit_iterator_base& lhs, const bit_iterator_base& rhs)
+	{
+		return (!(lhs == rhs));
+	}
+
+	inline bool operator<(const bit_iterator_base& lhs, const bit_iterator_base& rhs)
+	{
+		return (lhs._p < rhs._p || (lhs._p == rhs._p && lhs._offset < rhs._offset));
+	}
+
+	inline bool operator>(const bit_iterator_base& lhs, const bit_iterator_base& rhs)
+	{
+		return (rhs < lhs);
+	}
+
+	inline bool operator<=(const bit_iterator_base& lhs, const bit_iterator_base& rhs)
+	{
+		return (!(rhs < lhs));
+	}
+
+	inline bool operator>=(const bit_iterator_base& lhs, const bit_iterator_base& rhs)
+	{
+		return (!(lhs < rhs));
+	}
+
+	inline ptrdiff_t operator-(const bit_iterator_base& lhs, const bit_iterator_base& rhs)
+	{
+		return (static_cast<ptrdiff_t>(bit_word_bits) * (lhs._p - rhs._p)
+			+ static_cast<ptrdiff_t>(lhs._offset) - static_cast<ptrdiff_t>(rhs._offset));
+	}
+
+	/**
+	 * @brief bit_iterator
+	 *
+	 * vector<bool>::iterator. 역참조하면 bit_reference를 돌려준다.
+	 * pointer는 가리킬 수 있는 bool이 없으므로 void이다. (operator->는 없다.)
+	 */
+	class bit_iterator : public bit_iterator_base
+	{
+		public:
+			typedef bool							value_type;
+			typedef ptrdiff_t						difference_type;
+			typedef void							pointer;
+			typedef bit_reference					reference;
+			typedef ft::random_access_iterator_tag	iterator_category;
+
+			bit_iterator() : bit_iterator_base(NULL, 0) {}
+			bit_iterator(bit_word* p, unsigned int offset) : bit_iterator_base(p, offset) {}
+
+			reference operator*() const
+			{
+				return (reference(this->_p, bit_word(1) << this->_offset));
+			}
+
+			reference operator[](difference_type n) const
+			{
+				return (*(*this + n));
+			}
+
+			bit_iterator& operator++()
+			{
+				this->bump_up();
+				return (*this);
+			}
+
+			bit_iterator operator++(int)
+			{
+				bit_iterator tmp = *this;
+				this->bump_up();
+				return (tmp);
+			}
+
+			bit_iterator& operator--()
+			{
+				this->bump_down();
+				return (*this);
+			}
+
+			bit_iterator operator--(int)
+			{
+				bit_iterator tmp = *this;
+				this->bump_down();
+				return (tmp);
+			}
+
+			bit_iterator& operator+=(difference_type n)
+			{
+				this->incr(n);
+				return (*this);
+			}
+
+			bit_iterator& operator-=(difference_type n)
+			{
+				this->incr(-n);
+				return (*this);
+			}
+
+			bit_iterator operator+(difference_type n) const
+			{
+				bit_iterator tmp = *this;
+				return (tmp += n);
+			}
+
+			bit_iterator operator-(difference_type n) const
+			{
+				bit_iterator tmp = *this;
+				return (tmp -= n);
+			}
+	};
+
+	inline bit_iterator operator+(ptrdiff_t n, const bit_iterator& it)
+	{
+		return (it + n);
+	}
+
+	/**
+	 * @brief bit_const_iterator
+	 *
+	 * vector<bool>::const_iterator. 역참조하면 bool 값을 돌려준다.
+	 * bit_iterator에서 암시적으로 변환된다.
+	 */
+	class bit_const_iterator : public bit_iterator_base
+	{
+		public:
+			typedef bool							value_type;
+			typedef ptrdiff_t						difference_type;
+			typedef void							pointer;
+			typedef bool							reference;
+			typedef ft::random_access_iterator_tag	iterator_category;
+
+			bit_const_iterator() : bit_iterator_base(NULL, 0) {}
+			bit_const_iterator(bit_word* p, unsigned int offset) : bit_iterator_base(p, offset) {}
+			bit_const_iterator(const bit_iterator& x) : bit_iterator_base(x._p, x._offset) {}
+
+			reference operator*() const
+			{
+				return ((*this->_p & (bit_word(1) << this->_offset)) != 0);
+			}
+
+			reference operator[](difference_type n) const
+			{
+				return (*(*this + n));
+			}
+
+			bit_const_iterator& operator++()
+			{
+				this->bump_up();
+				return (*this);
+			}
+
+			bit_const_iterator operator++(int)
+			{
+				bit_const_iterator tmp = *this;
+				this->bump_up();
+				return (tmp);
+			}
+
+			bit_const_iterator& operator--()
+			{
+				this->bump_down();
+				return (*this);
+			}
+
+			bit_const_iterator operator--(int)
+			{
+				bit_const_iterator tmp = *this;
+				this->bump_down();
+				return (tmp);
+			}
+
+			bit_const_iterator& operator+=(difference_type n)
+			{
+				this->incr(n);
+				return (*this);
+			}
+
+			bit_const_iterator& operator-=(difference_type n)
+			{
+				this->incr(-n);
+				return (*this);
+			}
+
+			bit_const_iterator operator+(difference_type n) const
+			{
+				bit_const_iterator tmp = *this;
+				return (tmp += n);
+			}
+
+			bit_const_iterator operator-(difference_type n) const
+			{
+				bit_const_iterator tmp = *this;
+				return (tmp -= n);
+			}
+	};
+
+	inline bit_const_iterator operator+(ptrdiff_t n, const bit_const_iterator& it)
+	{
+		return (it + n);
+	}
+
+	template < typename Allocator >
+	class vector<bool, Allocator>
+	{
+		public:
+			typedef bool										value_type;
+			typedef Allocator									allocator_type;
+			typedef ft::bit_reference							reference;
+			typedef bool										const_reference;
+			typedef ft::bit_reference*							pointer;
+			typedef const bool*									const_pointer;
+			typedef ft::bit_iterator							iterator;
+			typedef ft::bit_const_iterator						const_iterator;
+			typedef ft::reverse_iterator<iterator>				reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+			typedef typename allocator_type::size_type			size_type;
+			typedef typename allocator_type::difference_type	difference_type;
+
+			//find_first, find_next가 1인 bit를 찾지 못하면 돌려주는 값
+			static const size_type	npos = static_cast<size_type>(-1);
+
+		/**
+		 * @brief value
+		 *
+		 * start : word 배열
+		 * size : bit의 수
+		 * words : 할당된 word의 수 (capacity는 words * bit_word_bits)
+		 * 할당된 word 중 size() 이후의 bit는 항상 0이다.
+		 */
+		private:
+			typedef typename allocator_type::template rebind<bit_word>::other	word_allocator_type;
+
+			word_allocator_type	_alloc;
+			bit_word*			_start;
+			size_type			_size;
+			size_type			_words;
+
+		public:
+		/**
+		 * @brief vector<bool> member function
+		 *
+		 * 생성자는 일반 vector와 같다. 할당한 word는 모두 0으로 채운 후 bit를 설정한다.
+		 */
+		//default constructor
+		explicit vector(const allocator_type &alloc = allocator_type())
+		: _alloc(alloc), _start(NULL), _size(0), _words(0) {}
+
+		//fill constructor
+		explicit vector(size_type n, const value_type &val = value_type(), const allocator_type &alloc = allocator_type())
+		: _alloc(alloc), _start(NULL), _size(0), _words(0)
+		{
+			this->insert(this->end(), n, val);
+		}
+
+		//range constructor
+		template <typename InputIterator>
+		vector(InputIterator first, InputIterator last,
+				const allocator_type &alloc = allocator_type(),
+				typename ft::enable_if< !ft::is_integral< InputIterator >::value, InputIterator >::type* = NULL)
+		: _alloc(alloc), _start(NULL), _size(0), _words(0)
+		{
+			this->insert(this->end(), first, last);
+		}
+
+		//copy constructor
+		vector(const vector &x)
+		: _alloc(x._alloc), _start(NULL), _size(0), _words(0)
+		{
+			*this = x;
+		}
+
+		~vector()
+		{
+			if (this->_start)
+				this->_alloc.deallocate(this->_start, this->_words);
+		}
+
+		//word 단위로 복사한다.
+		vector &operator=(const vector &x)
+		{
+			if (this != &x)
+			{
+				size_type n = words_for(x._size);
+				if (n > this->_words)
+					this->reallocate(n);
+				if (n)
+					std::memcpy(this->_start, x._start, n * sizeof(bit_word));
+				if (this->_words > n)
+					std::memset(this->_start + n, 0, (this->_words - n) * sizeof(bit_word));
+				this->_size = x._size;
+			}
+			return (*this);
+		}
+
+		/**
+		 * @brief Iterator
+		 */
+		iterator begin()
+		{
+			return (iterator(this->_start, 0));
+		}
+
+		const_iterator begin() const
+		{
+			return (const_iterator(this->_start, 0));
+		}
+
+		iterator end()
+		{
+			return (this->begin() + this->_size);
+		}
+
+		const_iterator end() const
+		{
+			return (this->begin() + this->_size);
+		}
+
+		reverse_iterator rbegin()
+		{
+			return (reverse_iterator(this->end()));
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return (const_reverse_iterator(this->end()));
+		}
+
+		reverse_iterator rend()
+		{
+			return (reverse_iterator(this->begin()));
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return (const_reverse_iterator(this->begin()));
+		}
+
+		/**
+		 * @brief capacity
+		 */
+		size_type size() const
+		{
+			return (this->_size);
+		}
+
+		//word allocator가 할당할 수 있는 word 수 * word당 bit 수 (size_type을 넘으면 size_type의 최댓값)
+		size_type max_size() const
+		{
+			size_type words = this->_alloc.max_size();
+			if (words > static_cast<size_type>(-1) / bit_word_bits)
+				return (static_cast<size_type>(-1));
+			return (words * bit_word_bits);
+		}
+
+		void resize(size_type n, value_type val = value_type())
+		{
+			if (n < this->_size)
+				this->erase(this->begin() + n, this->end());
+			else if (n > this->_size)
+				this->insert(this->end(), n - this->_size, val);
+		}
+
+		size_type capacity() const
+		{
+			return (this->_words * bit_word_bits);
+		}
+
+		bool empty() const
+		{
+			return (this->_size == 0);
+		}
+
+		void reserve(size_type n)
+		{
+			if (n > max_size())
+				throw(std::length_error("Error: ft::vector<bool>::reserve"));
+			if (n > this->capacity())
+				this->reallocate(words_for(n));
+		}
+
+		/**
+		 * @brief element access
+		 */
+		reference operator[](size_type n)
+		{
+			return (reference(this->_start + n / bit_word_bits, bit_word(1) << (n % bit_word_bits)));
+		}
+
+		const_reference operator[](size_type n) const
+		{
+			return ((this->_start[n / bit_word_bits] >> (n % bit_word_bits)) & 1);
+		}
+
+		reference at(size_type n)
+		{
+			if (n >= this->_size)
+				throw(std::out_of_range("Error: ft::vector<bool>::at"));
+			return ((*this)[n]);
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= this->_size)
+				throw(std::out_of_range("Error: ft::vector<bool>::at"));
+			return ((*this)[n]);
+		}
+
+		reference front()
+		{
+			return ((*this)[0]);
+		}
+
+		const_reference front() const
+		{
+			return ((*this)[0]);
+		}
+
+		reference back()
+		{
+			return ((*this)[this->_size - 1]);
+		}
+
+		const_reference back() const
+		{
+			return ((*this)[this->_size - 1]);
+		}
+
+		/**
+		 * @brief modifiers
+		 *
+		 * 중간에 삽입/삭제하면 뒤의 bit를 한 칸씩 옮긴다.
+		 * 삭제 후 size() 이후로 밀려난 bit는 0으로 지운다.
+		 */
+		template <typename InputIterator>
+		void assign(InputIterator first, InputIterator last,
+			typename ft::enable_if< !ft::is_integral< InputIterator >::value, InputIterator >::type* = NULL)
+		{
+			this->clear();
+			this->insert(this->end(), first, last);
+		}
+
+		void assign(size_type n, const value_type &val)
+		{
+			this->clear();
+			this->insert(this->end(), n, val);
+		}
+
+		void push_back(const value_type &val)
+		{
+			if (this->_size == this->capacity())
+				this->reallocate(this->grow_words(1));
+			(*this)[this->_size++] = val;
+		}
+
+		void pop_back()
+		{
+			(*this)[--this->_size] = false;
+		}
+
+		iterator insert(iterator position, const value_type &val)
+		{
+			size_type index = position - this->begin();
+			this->insert(position, 1, val);
+			return (this->begin() + index);
+		}
+
+		void insert(iterator position, size_type n, const value_type &val)
+		{
+			size_type index = this->make_room(position - this->begin(), n);
+			for (iterator it = this->begin() + index; n--; ++it)
+				*it = val;
+		}
+
+		template <typename InputIterator>
+		void insert(iterator position, InputIterator first, InputIterator last,
+			typename ft::enable_if< !ft::is_integral< InputIterator >::value, InputIterator >::type* = NULL)
+		{
+			this->range_insert(position - this->begin(), first, last, typename ft::iterator_category_of<InputIterator>::type());
+		}
+
+		iterator erase(iterator position)
+		{
+			return (this->erase(position, position + 1));
+		}
+
+		iterator erase(iterator first, iterator last)
+		{
+			size_type index = first - this->begin();
+			size_type n = last - first;
+			copy_forward(last, this->end(), first);
+			for (iterator it = this->end() - n; it != this->end(); ++it)
+				*it = false;
+			this->_size -= n;
+			return (this->begin() + index);
+		}
+
+		void swap(vector &x)
+		{
+			word_allocator_type tmp_alloc = x._alloc;
+			bit_word* tmp_start = x._start;
+			size_type tmp_size = x._size;
+			size_type tmp_words = x._words;
+
+			x._alloc = this->_alloc;
+			x._start = this->_start;
+			x._size = this->_size;
+			x._words = this->_words;
+
+			this->_alloc = tmp_alloc;
+			this->_start = tmp_start;
+			this->_size = tmp_size;
+			this->_words = tmp_words;
+		}
+
+		//두 proxy가 가리키는 bit를 바꾼다.
+		static void swap(reference x, reference y)
+		{
+			bool tmp = x;
+			x = y;
+			y = tmp;
+		}
+
+		void clear()
+		{
+			if (this->_start)
+				std::memset(this->_start, 0, words_for(this->_size) * sizeof(bit_word));
+			this->_size = 0;
+		}
+
+		//모든 bit를 뒤집는다. size() 이후의 bit는 다시 0으로 지운다.
+		void flip()
+		{
+			size_type n = words_for(this->_size);
+			for (size_type i = 0; i < n; ++i)
+				this->_start[i] = ~this->_start[i];
+			this->clear_tail();
+		}
+
+		allocator_type get_allocator() const
+		{
+			return (allocator_type(this->_alloc));
+		}
+
+		/**
+		 * @brief word operations
+		 *
+		 * 모두 size() 이후의 bit가 0이라는 것을 이용해 마지막 word도 그대로 처리한다.
+		 */
+		//1인 bit의 수
+		size_type count() const
+		{
+			size_type n = words_for(this->_size);
+			size_type res = 0;
+			for (size_type i = 0; i < n; ++i)
+				res += bit_popcount(this->_start[i]);
+			return (res);
+		}
+
+		//첫 번째 1인 bit의 index. 없으면 npos
+		size_type find_first() const
+		{
+			return (this->find_from(0));
+		}
+
+		//pos보다 뒤에 있는 첫 번째 1인 bit의 index. 없으면 npos
+		size_type find_next(size_type pos) const
+		{
+			if (pos >= this->_size || pos + 1 == this->_size)
+				return (npos);
+			return (this->find_from(pos + 1));
+		}
+
+		//[0, pos)에서 1인 bit의 수. pos는 size() 이하여야 한다.
+		size_type rank(size_type pos) const
+		{
+			size_type w = pos / bit_word_bits;
+			size_type res = 0;
+			for (size_type i = 0; i < w; ++i)
+				res += bit_popcount(this->_start[i]);
+			if (pos % bit_word_bits)
+				res += bit_popcount(this->_start[w] & low_mask(pos % bit_word_bits));
+			return (res);
+		}
+
+		vector &operator&=(const vector &x)
+		{
+			if (this->_size != x._size)
+				throw(std::invalid_argument("Error: ft::vector<bool>::operator&="));
+			size_type n = words_for(this->_size);
+			for (size_type i = 0; i < n; ++i)
+				this->_start[i] &= x._start[i];
+			return (*this);
+		}
+
+		vector &operator|=(const vector &x)
+		{
+			if (this->_size != x._size)
+				throw(std::invalid_argument("Error: ft::vector<bool>::operator|="));
+			size_type n = words_for(this->_size);
+			for (size_type i = 0; i < n; ++i)
+				this->_start[i] |= x._start[i];
+			return (*this);
+		}
+
+		vector &operator^=(const vector &x)
+		{
+			if (this->_size != x._size)
+				throw(std::invalid_argument("Error: ft::vector<bool>::operator^="));
+			size_type n = words_for(this->_size);
+			for (size_type i = 0; i < n; ++i)
+				this->_start[i] ^= x._start[i];
+			return (*this);
+		}
+
+		//크기가 같으면 word끼리 비교한다.
+		bool equal_words(const vector &x) const
+		{
+			if (this->_size != x._size)
+				return (false);
+			size_type n = words_for(this->_size);
+			return (n == 0 || std::memcmp(this->_start, x._start, n * sizeof(bit_word)) == 0);
+		}
+
+		private:
+		static size_type words_for(size_type bits)
+		{
+			return ((bits + bit_word_bits - 1) / bit_word_bits);
+		}
+
+		//하위 n bit가 1인 mask (0 < n < bit_word_bits)
+		static bit_word low_mask(size_type n)
+		{
+			return ((bit_word(1) << n) - 1);
+		}
+
+		//n개를 더 넣을 때 필요한 word 수. 일반 vector처럼 두 배씩 늘린다.
+		size_type grow_words(size_type n) const
+		{
+			if (n > max_size() - this->_size)
+				throw(std::length_error("Error: ft::vector<bool>::insert"));
+			size_type need = words_for(this->_size + n);
+			size_type twice = this->_words * 2;
+			return ((twice > need) ? twice : need);
+		}
+
+		//words개의 word를 새로 할당해 0으로 채우고 기존 word를 복사한다.
+		void reallocate(size_type words)
+		{
+			bit_word* prev_start = this->_start;
+			bit_word* new_start = this->_alloc.allocate(words);
+			size_type used = words_for(this->_size);
+			if (used)
+				std::memcpy(new_start, prev_start, used * sizeof(bit_word));
+			std::memset(new_start + used, 0, (words - used) * sizeof(bit_word));
+			if (prev_start)
+				this->_alloc.deallocate(prev_start, this->_words);
+			this->_start = new_start;
+			this->_words = words;
+		}
+
+		//size() 이후 마지막 word에 남은 bit를 0으로 지운다.
+		void clear_tail()
+		{
+			if (this->_size % bit_word_bits)
+				this->_start[this->_size / bit_word_bits] &= low_mask(this->_size % bit_word_bits);
+		}
+
+		//from부터 word 단위로 1인 bit를 찾는다.
+		size_type find_from(size_type from) const
+		{
+			size_type n = words_for(this->_size);
+			size_type w = from / bit_word_bits;
+			if (w >= n)
+				return (npos);
+			bit_word word = this->_start[w] & (~bit_word(0) << (from % bit_word_bits));
+			while (!word)
+			{
+				if (++w == n)
+					return (npos);
+				word = this->_start[w];
+			}
+			return (w * bit_word_bits + bit_ctz(word));
+		}
+
+		//index 위치에 n개의 bit 자리를 만든다. 뒤의 bit는 n칸 뒤로 옮긴다.
+		size_type make_room(size_type index, size_type n)
+		{
+			if (n == 0)
+				return (index);
+			if (this->_size + n > this->capacity())
+				this->reallocate(this->grow_words(n));
+			iterator old_end = this->end();
+			this->_size += n;
+			copy_backward(this->begin() + index, old_end, this->end());
+			return (index);
+		}
+
+		template <typename InputIterator>
+		void range_insert(size_type index, InputIterator first, InputIterator last, ft::input_iterator_tag)
+		{
+			//개수를 알 수 없으므로 임시 vector에 모은 후 한 번에 삽입한다.
+			vector tmp;
+			for (; first != last; ++first)
+				tmp.push_back(*first);
+			this->range_insert(index, tmp.begin(), tmp.end(), ft::forward_iterator_tag());
+		}
+
+		template <typename ForwardIterator>
+		void range_insert(size_type index, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+		{
+			size_type n = ft::distance(first, last);
+			this->make_room(index, n);
+			for (iterator it = this->begin() + index; first != last; ++first, ++it)
+				*it = static_cast<bool>(*first);
+		}
+
+		static void copy_forward(iterator first, iterator last, iterator result)
+		{
+			for (; first != last; ++first, ++result)
+				*result = static_cast<bool>(*first);
+		}
+
+		static void copy_backward(iterator first, iterator last, iterator result)
+		{
+			while (first != last)
+				*--result = static_cast<bool>(*--last);
+		}
+	};
+
+	template <typename Allocator>
+	const typename vector<bool, Allocator>::size_type vector<bool, Allocator>::npos;
+
+	template <typename Allocator>
+	bool operator==(const vector<bool, Allocator> &lhs, const vector<bool, Allocator> &rhs)
+	{
+		return (lhs.equal_words(rhs));
+	}
+}
+
+#endif
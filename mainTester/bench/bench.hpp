@@ -0,0 +1,123 @@
+#ifndef BENCH_HPP
+# define BENCH_HPP
+
+#include <time.h>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+
+/**
+ * @brief benchmark helpers
+ *
+ * mainTester/bench 의 각 benchmark 에서 공통으로 사용하는 timer, 난수 생성기, 결과 출력 함수
+ * make bench 로 -O2 빌드 후 실행한다.
+ */
+namespace bench
+{
+	inline double now_ms()
+	{
+		timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return (ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0);
+	}
+
+	class timer
+	{
+		private:
+			double _start;
+		public:
+			timer() : _start(now_ms()) {}
+			void reset() { _start = now_ms(); }
+			double elapsed_ms() const { return (now_ms() - _start); }
+	};
+
+	//xorshift64 - 재현 가능한 난수열
+	class rng
+	{
+		private:
+			unsigned long long _state;
+		public:
+			explicit rng(unsigned long long seed = 88172645463325252ULL) : _state(seed ? seed : 1) {}
+			unsigned long long next()
+			{
+				_state ^= _state << 13;
+				_state ^= _state >> 7;
+				_state ^= _state << 17;
+				return (_state);
+			}
+			unsigned long long below(unsigned long long n) { return (next() % n); }
+	};
+
+	//결과값을 사용한 것처럼 만들어 compiler가 측정 구간을 지우지 못하게 한다.
+	template <typename T>
+	inline void keep(const T& val)
+	{
+		__asm__ __volatile__("" : : "r"(&val) : "memory");
+	}
+
+	//첫 번째 인자로 크기를 바꿀 수 있다. ex) ./priority_queue_bench 10000000
+	inline size_t arg_size(int argc, char** argv, size_t def)
+	{
+		if (argc > 1)
+			return (static_cast<size_t>(std::strtoul(argv[1], NULL, 10)));
+		return (def);
+	}
+
+	inline void report(const char* name, double ms, size_t ops)
+	{
+		std::cout << std::left << std::setw(40) << name
+				<< std::right << std::setw(10) << std::fixed << std::setprecision(2) << ms << " ms"
+				<< std::setw(10) << std::setprecision(1) << (ops ? ms * 1000000.0 / ops : 0.0) << " ns/op" << std::endl;
+	}
+
+	//counting_allocator로 할당된 byte 수 (해제하면 줄어든다)
+	inline size_t& live_bytes()
+	{
+		static size_t bytes = 0;
+		return (bytes);
+	}
+
+	//할당/해제한 byte 수를 live_bytes()에 기록하는 allocator. 컨테이너의 메모리 사용량을 잴 때 쓴다.
+	template <typename T>
+	class counting_allocator : public std::allocator<T>
+	{
+		public:
+			typedef typename std::allocator<T>::pointer		pointer;
+			typedef typename std::allocator<T>::size_type	size_type;
+
+			template <typename U>
+			struct rebind { typedef counting_allocator<U> other; };
+
+			counting_allocator() throw() {}
+			counting_allocator(const counting_allocator& x) throw() : std::allocator<T>(x) {}
+			template <typename U>
+			counting_allocator(const counting_allocator<U>&) throw() {}
+
+			pointer allocate(size_type n, const void* hint = 0)
+			{
+				live_bytes() += n * sizeof(T);
+				return (std::allocator<T>::allocate(n, hint));
+			}
+
+			void deallocate(pointer p, size_type n)
+			{
+				live_bytes() -= n * sizeof(T);
+				std::allocator<T>::deallocate(p, n);
+			}
+	};
+
+	inline void report_memory(const char* name, size_t bytes, size_t elements)
+	{
+		std::cout << std::left << std::setw(40) << name
+				<< std::right << std::setw(10) << bytes / 1024 << " KiB"
+				<< std::setw(10) << std::setprecision(1) << std::fixed << (elements ? static_cast<double>(bytes) / elements : 0.0) << " B/elem" << std::endl;
+	}
+
+	inline void title(const char* name, size_t n)
+	{
+		std::cout << std::endl << "----- " << name << " (n = " << n << ") -----" << std::endl;
+	}
+} // namespace bench
+
+#endif
@@ -0,0 +1,94 @@
+#include "map.hpp"
+#include "vector.hpp"
+#include "bench.hpp"
+#include <map>
+
+/**
+ * map compact benchmark
+ *
+ * 노드가 heap에 흩어진 map을 만든 후 compact 전/후의 순회와 random find를 비교한다.
+ * - 무작위 순서로 삽입하면서 크기가 다른 쓰레기 블록을 사이사이에 할당하고, 절반을 지운 뒤 다시 삽입한다.
+ *   -> key 순서와 메모리 순서가 무관하고 노드 사이에 빈 공간이 생긴다. (오래 쓴 map의 모양)
+ * - scan	: begin부터 end까지 순회 (key 순서대로 메모리를 앞에서부터 읽게 되는지)
+ * - find	: random find (root 근처 노드들이 적은 page에 모이는지)
+ * std::map은 같은 방법으로 만든 참고용이다.
+ */
+
+template <typename Map>
+static void scan(const char* name, const Map& mp, int rounds)
+{
+	long sum = 0;
+	bench::timer t;
+	for (int r = 0; r < rounds; ++r)
+		for (typename Map::const_iterator it = mp.begin(); it != mp.end(); ++it)
+			sum += it->first + it->second;
+	bench::report(name, t.elapsed_ms(), mp.size() * rounds);
+	bench::keep(sum);
+}
+
+template <typename Map>
+static void find(const char* name, const Map& mp, const ft::vector<int>& queries)
+{
+	long sum = 0;
+	bench::timer t;
+	for (size_t i = 0; i < queries.size(); ++i)
+		sum += (mp.find(queries[i]) != mp.end());
+	bench::report(name, t.elapsed_ms(), queries.size());
+	bench::keep(sum);
+}
+
+//쓰레기 블록을 섞어가며 삽입/삭제를 반복해 노드를 흩어놓는다.
+template <typename Map, typename Pair>
+static void fragment(Map& mp, const ft::vector<int>& keys, bench::rng& rng)
+{
+	ft::vector<char*> junk;
+	for (size_t i = 0; i < keys.size(); ++i)
+	{
+		mp.insert(Pair(keys[i], static_cast<int>(i)));
+		junk.push_back(new char[16 + rng.below(200)]);
+	}
+	for (size_t i = 0; i < keys.size(); i += 2)
+		mp.erase(keys[i]);
+	for (size_t i = 0; i < junk.size(); i += 3)
+	{
+		delete[] junk[i];
+		junk[i] = NULL;
+	}
+	for (size_t i = 0; i < keys.size(); i += 2)
+		mp.insert(Pair(keys[i], static_cast<int>(i)));
+	for (size_t i = 0; i < junk.size(); ++i)
+		delete[] junk[i];
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 1000000);
+	int rounds = static_cast<int>(20000000 / n) + 1;
+	bench::rng rng(n);
+
+	ft::vector<int> keys;
+	for (size_t i = 0; i < n; ++i)
+		keys.push_back(static_cast<int>(rng.next()));
+	ft::vector<int> queries;
+	for (size_t i = 0; i < n; ++i)
+		queries.push_back(keys[rng.below(n)]);
+
+	ft::map<int, int> fm;
+	std::map<int, int> sm;
+	fragment< ft::map<int, int>, ft::pair<int, int> >(fm, keys, rng);
+	fragment< std::map<int, int>, std::pair<int, int> >(sm, keys, rng);
+
+	bench::title("fragmented", fm.size());
+	scan("ft::map  scan", fm, rounds);
+	find("ft::map  find", fm, queries);
+	scan("std::map scan", sm, rounds);
+	find("std::map find", sm, queries);
+
+	bench::timer t;
+	fm.compact();
+	bench::title("after compact", fm.size());
+	bench::report("ft::map  compact", t.elapsed_ms(), fm.size());
+	scan("ft::map  scan", fm, rounds);
+	find("ft::map  find", fm, queries);
+	return (0);
+}
@@ -0,0 +1,88 @@
+#include "map.hpp"
+#include "multimap.hpp"
+#include "vector.hpp"
+#include "bench.hpp"
+#include <map>
+
+/**
+ * Comparator benchmark
+ *
+ * RBTree가 map/set이 받은 비교 함수 객체와 allocator를 compressed_pair로 size와 같은 자리에 저장한 후를 확인한다.
+ * - sizeof	: 빈 비교 함수 객체/allocator는 크기를 차지하지 않는다. (예전 map은 _alloc, _comp와 tree 안의 _comp, _node_alloc을 각각 멤버로 가졌다.)
+ *		  상태가 있는 비교 함수 객체는 그 크기만큼만 늘어난다.
+ * - find	: 상태가 있는 비교 함수 객체(정렬 방향)를 쓰는 map의 random find. 예전에는 tree가 기본 생성한 비교 함수 객체를 사용해 결과가 틀렸다.
+ * std 컨테이너는 참고용이다.
+ */
+
+//정렬 방향을 멤버로 가지는 비교 함수 객체
+struct dir_less
+{
+	bool	reverse;
+
+	dir_less(bool r = false) : reverse(r) {}
+	bool operator()(long x, long y) const { return (reverse ? y < x : x < y); }
+};
+
+//예전 map의 멤버 구성 (allocator, tree(root, nil, size, comp, node allocator), comp)
+struct legacy_map_layout
+{
+	std::allocator<int>	alloc;
+	struct
+	{
+		void*	root;
+		void*	nil;
+		size_t	size;
+		ft::less<int>	comp;
+		std::allocator<int>	node_alloc;
+	}	tree;
+	ft::less<int>	comp;
+};
+
+static void print_size(const char* name, size_t ft_size, size_t std_size)
+{
+	std::cout << "  " << std::left << std::setw(28) << name
+		<< "ft " << ft_size << " B  std " << std_size << " B" << std::endl;
+}
+
+template <typename Map, typename Pair>
+static void run(const char* name, const Map& proto, const ft::vector<long>& keys, const ft::vector<long>& queries)
+{
+	std::string label(name);
+	Map mp(proto);
+	bench::timer t;
+	for (size_t i = 0; i < keys.size(); ++i)
+		mp.insert(Pair(keys[i], keys[i]));
+	bench::report((label + " insert").c_str(), t.elapsed_ms(), keys.size());
+
+	long sum = 0;
+	t.reset();
+	for (size_t i = 0; i < queries.size(); ++i)
+		sum += (mp.find(queries[i]) != mp.end());
+	bench::report((label + " find").c_str(), t.elapsed_ms(), queries.size());
+	std::cout << "    first key " << mp.begin()->first << ", hits " << sum << std::endl;
+	bench::keep(sum);
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 1000000);
+	bench::rng rng(n);
+
+	bench::title("sizeof", n);
+	std::cout << "  legacy map<int, int>        " << sizeof(legacy_map_layout) << " B" << std::endl;
+	print_size("map<int, int>", sizeof(ft::map<int, int>), sizeof(std::map<int, int>));
+	print_size("multimap<int, int>", sizeof(ft::multimap<int, int>), sizeof(std::multimap<int, int>));
+	print_size("map<long, long, dir_less>", sizeof(ft::map<long, long, dir_less>), sizeof(std::map<long, long, dir_less>));
+
+	ft::vector<long> keys;
+	for (size_t i = 0; i < n; ++i)
+		keys.push_back(static_cast<long>(rng.below(n * 4)));
+	ft::vector<long> queries;
+	for (size_t i = 0; i < n; ++i)
+		queries.push_back(static_cast<long>(rng.below(n * 4)));
+
+	bench::title("map<long, long, dir_less(true)>", n);
+	run< ft::map<long, long, dir_less>, ft::pair<long, long> >("ft::map ", ft::map<long, long, dir_less>(dir_less(true)), keys, queries);
+	run< std::map<long, long, dir_less>, std::pair<long, long> >("std::map", std::map<long, long, dir_less>(dir_less(true)), keys, queries);
+	return (0);
+}
@@ -0,0 +1,121 @@
+#include "vector.hpp"
+#include "map.hpp"
+#include "set.hpp"
+#include "bench.hpp"
+#include <string>
+
+/**
+ * erase_if benchmark
+ *
+ * 조건에 맞는 원소를 모두 지울 때 erase를 반복하는 방법과 ft::erase_if를 비교한다. 지우는 비율은 1%, 50%, 99%
+ * - vector	: erase(it)를 반복하면 지울 때마다 뒤의 원소를 모두 당긴다. erase_if는 한 번에 당긴다.
+ * - map/set	: erase(it++)를 반복하면 지울 때마다 재조정하고 최댓값 노드를 다시 찾는다.
+ *			  erase_if는 최댓값 갱신을 마지막에 한 번만 하고, 지나온 노드의 절반 넘게 지웠다면 남는 노드로 tree를 다시 만든다.
+ * 측정 구간에는 지우는 작업만 포함한다. container는 매번 같은 내용으로 새로 만들고,
+ * tree는 compact해서 노드 배치(allocator가 돌려준 주소)에 따라 결과가 달라지지 않게 한다.
+ * std::string의 erase 반복은 O(n^2) 대입이므로 원소 수를 1/10로 줄인다.
+ */
+
+struct removal
+{
+	unsigned percent;
+	template <typename T>
+	bool operator()(const T& x) const { return (hash(key(x)) % 100 < percent); }
+	static unsigned hash(unsigned x) { return ((x * 2654435761u) >> 7); }
+	static unsigned key(int x) { return (static_cast<unsigned>(x)); }
+	static unsigned key(const std::string& s) { return (static_cast<unsigned>(s.size() * 31 + s[0])); }
+	template <typename Pair>
+	static unsigned key(const Pair& p) { return (static_cast<unsigned>(p.first)); }
+};
+
+template <typename Vector>
+static size_t erase_loop(Vector& v, removal pred)
+{
+	size_t n = v.size();
+	for (typename Vector::iterator it = v.begin(); it != v.end(); )
+	{
+		if (pred(*it))
+			it = v.erase(it);
+		else
+			++it;
+	}
+	return (n - v.size());
+}
+
+template <typename Tree>
+static size_t erase_loop_tree(Tree& c, removal pred)
+{
+	size_t n = c.size();
+	for (typename Tree::iterator it = c.begin(); it != c.end(); )
+	{
+		if (pred(*it))
+			c.erase(it++);
+		else
+			++it;
+	}
+	return (n - c.size());
+}
+
+template <typename Container>
+static void run_vector(const char* name, const Container& src, removal pred, bool loop)
+{
+	Container v(src);
+	bench::timer t;
+	size_t removed = loop ? erase_loop(v, pred) : ft::erase_if(v, pred);
+	double ms = t.elapsed_ms();
+	bench::report(name, ms, src.size());
+	bench::keep(removed);
+}
+
+template <typename Tree>
+static void run_tree(const char* name, const Tree& src, removal pred, bool loop)
+{
+	Tree c(src);
+	c.compact();
+	bench::timer t;
+	size_t removed = loop ? erase_loop_tree(c, pred) : ft::erase_if(c, pred);
+	double ms = t.elapsed_ms();
+	bench::report(name, ms, src.size());
+	bench::keep(removed);
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 50000);
+	size_t tree_n = n * 10;
+	bench::rng rng;
+	ft::vector<int> ints;
+	ft::vector<std::string> strings;
+	for (size_t i = 0; i < n; ++i)
+		ints.push_back(static_cast<int>(rng.next()));
+	for (size_t i = 0; i < n / 10; ++i)
+		strings.push_back(std::string(rng.below(30) + 1, static_cast<char>('a' + rng.below(26))));
+	ft::map<int, int> mp;
+	ft::set<int> st;
+	while (mp.size() < tree_n)
+	{
+		int k = static_cast<int>(rng.next());
+		mp.insert(ft::make_pair(k, k));
+		st.insert(k);
+	}
+
+	const unsigned percents[] = { 1, 50, 99 };
+	for (size_t i = 0; i < sizeof(percents) / sizeof(percents[0]); ++i)
+	{
+		removal pred = { percents[i] };
+		std::cout << std::endl << "===== remove " << pred.percent << "% =====" << std::endl;
+		bench::title("ft::vector<int>", n);
+		run_vector("erase loop", ints, pred, true);
+		run_vector("ft::erase_if", ints, pred, false);
+		bench::title("ft::vector<std::string>", strings.size());
+		run_vector("erase loop", strings, pred, true);
+		run_vector("ft::erase_if", strings, pred, false);
+		bench::title("ft::map<int, int>", tree_n);
+		run_tree("erase loop", mp, pred, true);
+		run_tree("ft::erase_if", mp, pred, false);
+		bench::title("ft::set<int>", tree_n);
+		run_tree("erase loop", st, pred, true);
+		run_tree("ft::erase_if", st, pred, false);
+	}
+	return (0);
+}
@@ -0,0 +1,83 @@
+#include "map.hpp"
+#include "vector.hpp"
+#include "bench.hpp"
+#include <map>
+
+/**
+ * find_batch benchmark
+ *
+ * 서로 독립인 key를 한꺼번에 찾을 때 map::find를 반복하는 것과 map::find_batch를 비교한다.
+ * find_batch는 16개의 탐색을 한 level씩 번갈아 진행하면서 다음 노드를 prefetch 한다.
+ * tree가 cache보다 커질수록 차이가 커진다. map 크기는 1M부터 4배씩 인자로 준 크기까지 늘린다. (기본 16M, 노드 하나 32 byte)
+ * query는 절반이 있는 key이고 순서는 무작위이다. std::map::find는 참고용이다.
+ */
+
+template <typename Map>
+static void fill(Map& mp, const ft::vector<int>& keys, size_t n)
+{
+	for (size_t i = 0; i < n; ++i)
+		mp.insert(typename Map::value_type(keys[i], static_cast<int>(i)));
+}
+
+static void run(const ft::vector<int>& keys, size_t n, const ft::vector<int>& queries)
+{
+	ft::map<int, int> fm;
+	fill(fm, keys, n);
+	size_t q = queries.size();
+
+	bench::title("map<int, int>", n);
+	ft::vector<ft::map<int, int>::iterator> out(q);
+	long hits = 0;
+	bench::timer t;
+	for (size_t i = 0; i < q; ++i)
+	{
+		out[i] = fm.find(queries[i]);
+		hits += (out[i] != fm.end());
+	}
+	bench::report("ft::map find", t.elapsed_ms(), q);
+
+	long hits2 = 0;
+	t.reset();
+	fm.find_batch(&queries[0], q, &out[0]);
+	for (size_t i = 0; i < q; ++i)
+		hits2 += (out[i] != fm.end());
+	bench::report("ft::map find_batch", t.elapsed_ms(), q);
+	std::cout << "    same result: " << ((hits == hits2) ? "OK" : "KO") << " (" << hits << " hits)" << std::endl;
+	fm.clear();
+
+	std::map<int, int> sm;
+	fill(sm, keys, n);
+	long hits3 = 0;
+	t.reset();
+	for (size_t i = 0; i < q; ++i)
+		hits3 += (sm.find(queries[i]) != sm.end());
+	bench::report("std::map find", t.elapsed_ms(), q);
+	bench::keep(hits3);
+}
+
+int main(int argc, char** argv)
+{
+	size_t max_n = bench::arg_size(argc, argv, 16000000);
+	size_t q = 2000000;
+	bench::rng rng(max_n);
+
+	//서로 다른 key: i * 2 + 1 을 섞어서 사용하고, 없는 key는 짝수
+	ft::vector<int> keys(max_n);
+	for (size_t i = 0; i < max_n; ++i)
+		keys[i] = static_cast<int>(i * 2 + 1);
+	for (size_t i = max_n; i > 1; --i)
+	{
+		size_t j = rng.below(i);
+		int tmp = keys[i - 1];
+		keys[i - 1] = keys[j];
+		keys[j] = tmp;
+	}
+	for (size_t n = (max_n < 1000000 ? max_n : 1000000); n <= max_n; n *= 4)
+	{
+		ft::vector<int> queries(q);
+		for (size_t i = 0; i < q; ++i)
+			queries[i] = (i & 1) ? keys[rng.below(n)] : static_cast<int>(rng.below(n) * 2);
+		run(keys, n, queries);
+	}
+	return (0);
+}
@@ -0,0 +1,124 @@
+#include "interval_map.hpp"
+#include "multimap.hpp"
+#include "vector.hpp"
+#include <iterator>
+#include "bench.hpp"
+
+/**
+ * interval_map benchmark
+ *
+ * 1년치 예약(분 단위)을 저장하고 "[a, b)와 겹치는 예약은?"을 묻는다.
+ * 대부분은 30분 ~ 2시간이지만 일부는 며칠짜리 긴 예약이다.
+ *
+ * 비교 대상은 시작 시간을 key로 하는 multimap에서 lower_bound(a - 가장 긴 예약 길이)부터 b까지 훑는 방식이다.
+ * 긴 예약이 하나라도 있으면 훑어야 하는 범위가 크게 늘어난다.
+ */
+
+static const int YEAR = 365 * 24 * 60;
+
+struct reservation
+{
+	int	start;
+	int	end;
+};
+
+static ft::vector<reservation> make_calendar(size_t n, size_t long_every)
+{
+	bench::rng rng(n);
+	ft::vector<reservation> res;
+	res.reserve(n);
+	for (size_t i = 0; i < n; ++i)
+	{
+		reservation r;
+		r.start = static_cast<int>(rng.below(YEAR));
+		if (long_every != 0 && i % long_every == 0)
+			r.end = r.start + 60 * 24 * static_cast<int>(1 + rng.below(30));
+		else
+			r.end = r.start + 30 + static_cast<int>(rng.below(90));
+		res.push_back(r);
+	}
+	return (res);
+}
+
+static void run(size_t n, size_t queries, size_t long_every)
+{
+	ft::vector<reservation> cal = make_calendar(n, long_every);
+	int longest = 0;
+	for (size_t i = 0; i < n; ++i)
+		if (cal[i].end - cal[i].start > longest)
+			longest = cal[i].end - cal[i].start;
+
+	ft::interval_map<int, int> im;
+	ft::multimap<int, int> mm;
+	{
+		bench::timer t;
+		for (size_t i = 0; i < n; ++i)
+			im.insert(cal[i].start, cal[i].end, static_cast<int>(i));
+		bench::report("build: interval_map", t.elapsed_ms(), n);
+		t.reset();
+		for (size_t i = 0; i < n; ++i)
+			mm.insert(ft::make_pair(cal[i].start, cal[i].end));
+		bench::report("build: multimap<start, end>", t.elapsed_ms(), n);
+	}
+
+	bench::rng rng(42);
+	ft::vector<int> lo(queries);
+	for (size_t i = 0; i < queries; ++i)
+		lo[i] = static_cast<int>(rng.below(YEAR));
+
+	//multimap scan은 긴 예약이 있으면 query 하나에 수 ms가 걸리므로 앞쪽 1%만 실행하고 그 구간의 결과를 비교한다.
+	size_t scan_queries = queries / 100;
+	ft::vector<ft::interval_map<int, int>::iterator> out;
+	long a = 0;
+	bench::timer t;
+	for (size_t i = 0; i < queries; ++i)
+	{
+		out.clear();
+		im.overlap(lo[i], lo[i] + 60, std::back_inserter(out));
+		if (i < scan_queries)
+			a += static_cast<long>(out.size());
+	}
+	bench::report("overlap 1h: interval_map", t.elapsed_ms(), queries);
+
+	long b = 0;
+	t.reset();
+	for (size_t i = 0; i < scan_queries; ++i)
+	{
+		int hi = lo[i] + 60;
+		for (ft::multimap<int, int>::iterator it = mm.lower_bound(lo[i] - longest); it != mm.end() && it->first < hi; ++it)
+			if (lo[i] < it->second)
+				++b;
+	}
+	bench::report("overlap 1h: multimap scan", t.elapsed_ms(), scan_queries);
+	std::cout << "    same result: " << ((a == b) ? "OK" : "KO") << " (" << a << " hits)" << std::endl;
+
+	a = 0;
+	t.reset();
+	for (size_t i = 0; i < queries; ++i)
+	{
+		out.clear();
+		im.stab(lo[i], std::back_inserter(out));
+		a += static_cast<long>(out.size());
+	}
+	bench::report("stab: interval_map", t.elapsed_ms(), queries);
+
+	long free_slots = 0;
+	t.reset();
+	for (size_t i = 0; i < queries; ++i)
+		if (im.find_overlap(lo[i], lo[i] + 15) == im.end())
+			++free_slots;
+	bench::report("is [a, a + 15) free: find_overlap", t.elapsed_ms(), queries);
+	bench::keep(free_slots);
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 1000000);
+	size_t queries = 100000;
+
+	bench::title("short reservations only", n);
+	run(n, queries, 0);
+	bench::title("1 in 1000 reservations lasts days", n);
+	run(n, queries, 1000);
+	return (0);
+}
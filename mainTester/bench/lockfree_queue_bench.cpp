@@ -0,0 +1,257 @@
+#include "lockfree_queue.hpp"
+#include "stack.hpp"
+#include "bench.hpp"
+#include <pthread.h>
+#include <sched.h>
+
+/**
+ * lock-free queue benchmark
+ *
+ * 지금 pipeline에서 사용하는 mutex + ft::stack과 spsc_queue / mpmc_queue를 비교한다.
+ * - throughput : producer/consumer thread 1 ~ 32개로 n개의 요소를 넘기는 데 걸린 시간
+ * - latency    : spsc_queue 두 개로 ping-pong 했을 때 왕복 시간
+ * 실패(full/empty)하면 sched_yield()로 다른 thread에게 양보한다. (core 수보다 thread가 많아도 진행되도록)
+ */
+
+static const size_t QUEUE_CAPACITY = 4096;
+static const size_t BATCH = 64;
+
+class locked_stack
+{
+	private:
+		pthread_mutex_t		_lock;
+		ft::stack<long>		_stack;
+		size_t				_capacity;
+	public:
+		explicit locked_stack(size_t capacity) : _stack(), _capacity(capacity) { pthread_mutex_init(&_lock, NULL); }
+		~locked_stack() { pthread_mutex_destroy(&_lock); }
+		bool push(const long& val)
+		{
+			pthread_mutex_lock(&_lock);
+			bool ok = _stack.size() < _capacity;
+			if (ok)
+				_stack.push(val);
+			pthread_mutex_unlock(&_lock);
+			return (ok);
+		}
+		bool pop(long& out)
+		{
+			pthread_mutex_lock(&_lock);
+			bool ok = !_stack.empty();
+			if (ok)
+			{
+				out = _stack.top();
+				_stack.pop();
+			}
+			pthread_mutex_unlock(&_lock);
+			return (ok);
+		}
+		template <class InputIterator>
+		size_t push_n(InputIterator first, size_t n)
+		{
+			pthread_mutex_lock(&_lock);
+			size_t i = 0;
+			for (; i < n && _stack.size() < _capacity; ++i, ++first)
+				_stack.push(*first);
+			pthread_mutex_unlock(&_lock);
+			return (i);
+		}
+		template <class OutputIterator>
+		size_t pop_n(OutputIterator out, size_t n)
+		{
+			pthread_mutex_lock(&_lock);
+			size_t i = 0;
+			for (; i < n && !_stack.empty(); ++i, ++out)
+			{
+				*out = _stack.top();
+				_stack.pop();
+			}
+			pthread_mutex_unlock(&_lock);
+			return (i);
+		}
+};
+
+template <typename Queue>
+struct worker
+{
+	Queue*			queue;
+	long			begin;
+	long			end;
+	size_t			batch;
+	int*			start;
+	long			sum;
+};
+
+template <typename Queue>
+static void* produce(void* arg)
+{
+	worker<Queue>* w = static_cast<worker<Queue>*>(arg);
+	while (!__atomic_load_n(w->start, __ATOMIC_ACQUIRE))
+		sched_yield();
+	long buf[BATCH];
+	for (long v = w->begin; v < w->end; )
+	{
+		if (w->batch == 1)
+		{
+			if (w->queue->push(v))
+				++v;
+			else
+				sched_yield();
+			continue;
+		}
+		size_t n = 0;
+		for (; n < w->batch && v + static_cast<long>(n) < w->end; ++n)
+			buf[n] = v + n;
+		size_t done = 0;
+		while (done < n)
+		{
+			size_t pushed = w->queue->push_n(buf + done, n - done);
+			if (pushed == 0)
+				sched_yield();
+			done += pushed;
+		}
+		v += n;
+	}
+	return (NULL);
+}
+
+template <typename Queue>
+static void* consume(void* arg)
+{
+	worker<Queue>* w = static_cast<worker<Queue>*>(arg);
+	while (!__atomic_load_n(w->start, __ATOMIC_ACQUIRE))
+		sched_yield();
+	long buf[BATCH];
+	long remain = w->end - w->begin;
+	long sum = 0;
+	while (remain > 0)
+	{
+		size_t want = remain < static_cast<long>(w->batch) ? remain : w->batch;
+		size_t got;
+		if (w->batch == 1)
+			got = w->queue->pop(buf[0]) ? 1 : 0;
+		else
+			got = w->queue->pop_n(buf, want);
+		if (got == 0)
+		{
+			sched_yield();
+			continue;
+		}
+		for (size_t i = 0; i < got; ++i)
+			sum += buf[i];
+		remain -= got;
+	}
+	w->sum = sum;
+	return (NULL);
+}
+
+//threads개의 thread를 producer/consumer 반반으로 나눠 n개를 넘긴다. (threads == 1이면 1:1)
+template <typename Queue>
+static void throughput(const char* name, Queue& queue, size_t threads, size_t n, size_t batch)
+{
+	size_t producers = threads < 2 ? 1 : threads / 2;
+	size_t consumers = threads < 2 ? 1 : threads - producers;
+	int start = 0;
+	ft::vector<worker<Queue> > ws(producers + consumers);
+	ft::vector<pthread_t> tids(producers + consumers);
+	for (size_t i = 0; i < producers; ++i)
+	{
+		worker<Queue> w = { &queue, static_cast<long>(n * i / producers), static_cast<long>(n * (i + 1) / producers), batch, &start, 0 };
+		ws[i] = w;
+	}
+	for (size_t i = 0; i < consumers; ++i)
+	{
+		worker<Queue> w = { &queue, static_cast<long>(n * i / consumers), static_cast<long>(n * (i + 1) / consumers), batch, &start, 0 };
+		ws[producers + i] = w;
+	}
+	for (size_t i = 0; i < ws.size(); ++i)
+		pthread_create(&tids[i], NULL, i < producers ? produce<Queue> : consume<Queue>, &ws[i]);
+	bench::timer t;
+	__atomic_store_n(&start, 1, __ATOMIC_RELEASE);
+	long sum = 0;
+	for (size_t i = 0; i < ws.size(); ++i)
+	{
+		pthread_join(tids[i], NULL);
+		if (i >= producers)
+			sum += ws[i].sum;
+	}
+	double ms = t.elapsed_ms();
+	long expected = static_cast<long>(n) * (static_cast<long>(n) - 1) / 2;
+	std::cout << std::setw(3) << threads << " threads  ";
+	bench::report(name, ms, n);
+	if (sum != expected)
+		std::cout << "    checksum: KO" << std::endl;
+}
+
+struct ping_pong
+{
+	ft::spsc_queue<long>*	to;
+	ft::spsc_queue<long>*	from;
+	size_t					rounds;
+};
+
+static void* pong(void* arg)
+{
+	ping_pong* p = static_cast<ping_pong*>(arg);
+	long v;
+	for (size_t i = 0; i < p->rounds; ++i)
+	{
+		while (!p->from->pop(v))
+			sched_yield();
+		while (!p->to->push(v))
+			sched_yield();
+	}
+	return (NULL);
+}
+
+static void latency(size_t rounds)
+{
+	ft::spsc_queue<long> ping(QUEUE_CAPACITY);
+	ft::spsc_queue<long> back(QUEUE_CAPACITY);
+	ping_pong p = { &back, &ping, rounds };
+	pthread_t tid;
+	pthread_create(&tid, NULL, pong, &p);
+	bench::timer t;
+	long v;
+	for (size_t i = 0; i < rounds; ++i)
+	{
+		while (!ping.push(static_cast<long>(i)))
+			sched_yield();
+		while (!back.pop(v))
+			sched_yield();
+	}
+	double ms = t.elapsed_ms();
+	pthread_join(tid, NULL);
+	bench::report("spsc_queue ping-pong round trip", ms, rounds);
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 1000000);
+	const size_t counts[] = { 1, 2, 4, 8, 16, 32 };
+
+	bench::title("spsc throughput (1 producer, 1 consumer)", n);
+	{
+		ft::spsc_queue<long> q(QUEUE_CAPACITY);
+		throughput("spsc_queue push/pop", q, 1, n, 1);
+		throughput("spsc_queue push_n/pop_n", q, 1, n, BATCH);
+		locked_stack s(QUEUE_CAPACITY);
+		throughput("mutex + ft::stack push/pop", s, 1, n, 1);
+		throughput("mutex + ft::stack batch", s, 1, n, BATCH);
+	}
+
+	bench::title("mpmc throughput", n);
+	for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i)
+	{
+		ft::mpmc_queue<long> q(QUEUE_CAPACITY);
+		throughput("mpmc_queue push/pop", q, counts[i], n, 1);
+		throughput("mpmc_queue push_n/pop_n", q, counts[i], n, BATCH);
+		locked_stack s(QUEUE_CAPACITY);
+		throughput("mutex + ft::stack push/pop", s, counts[i], n, 1);
+		throughput("mutex + ft::stack batch", s, counts[i], n, BATCH);
+	}
+
+	bench::title("latency", n / 10);
+	latency(n / 10);
+	return (0);
+}
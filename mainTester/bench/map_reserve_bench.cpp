@@ -0,0 +1,66 @@
+#include "map.hpp"
+#include "vector.hpp"
+#include "bench.hpp"
+#include <map>
+#include <vector>
+#include <algorithm>
+
+/**
+ * map reserve benchmark
+ *
+ * map::reserve로 노드를 slab에 미리 할당한 후의 삽입 지연 시간 분포를 본다.
+ * 삽입마다 시간을 재서 p50/p99/p99.9/max를 출력한다. (측정 자체에 clock_gettime 한 번, 20~30 ns가 포함된다.)
+ * - no reserve	: 삽입마다 allocator를 부른다. malloc이 heap을 늘리거나 새 page를 처음 만질 때 지연이 튄다.
+ * - reserve	: slab에서 노드를 꺼내므로 allocator를 부르지 않고, reserve가 page를 미리 만져둔다.
+ * reserve 자체에 걸린 시간도 따로 출력한다. std::map은 참고용이다.
+ */
+
+template <typename Map, typename Pair>
+static void run(const char* name, Map& mp, const ft::vector<int>& keys)
+{
+	std::string label(name);
+	std::vector<double> lat(keys.size());
+	bench::timer total;
+	for (size_t i = 0; i < keys.size(); ++i)
+	{
+		double start = bench::now_ms();
+		mp.insert(Pair(keys[i], static_cast<int>(i)));
+		lat[i] = bench::now_ms() - start;
+	}
+	bench::report((label + " insert").c_str(), total.elapsed_ms(), keys.size());
+	std::sort(lat.begin(), lat.end());
+	size_t n = lat.size();
+	std::cout << "    latency ns  p50 " << lat[n / 2] * 1000000.0
+		<< "  p99 " << lat[n - n / 100 - 1] * 1000000.0
+		<< "  p99.9 " << lat[n - n / 1000 - 1] * 1000000.0
+		<< "  max " << lat[n - 1] * 1000000.0 << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 2000000);
+	bench::rng rng(n);
+
+	ft::vector<int> keys;
+	for (size_t i = 0; i < n; ++i)
+		keys.push_back(static_cast<int>(rng.next()));
+
+	bench::title("random insert", n);
+	{
+		ft::map<int, int> mp;
+		run< ft::map<int, int>, ft::pair<int, int> >("ft::map  no reserve", mp, keys);
+	}
+	{
+		ft::map<int, int> mp;
+		bench::timer t;
+		mp.reserve(n);
+		bench::report("ft::map  reserve(n)", t.elapsed_ms(), n);
+		run< ft::map<int, int>, ft::pair<int, int> >("ft::map  reserve", mp, keys);
+		std::cout << "    node_capacity " << mp.node_capacity() << " size " << mp.size() << std::endl;
+	}
+	{
+		std::map<int, int> mp;
+		run< std::map<int, int>, std::pair<int, int> >("std::map", mp, keys);
+	}
+	return (0);
+}
@@ -0,0 +1,147 @@
+#include "multimap.hpp"
+#include "map.hpp"
+#include "vector.hpp"
+#include "bench.hpp"
+
+/**
+ * multimap benchmark
+ *
+ * 같은 key에 여러 값을 저장할 때 지금까지 쓰던 map<key, vector<value> >와 multimap을 비교한다.
+ * - build      : n개의 (key, value)를 삽입
+ * - lookup     : key마다 equal_range로 값을 모두 읽는다.
+ * - count      : key마다 값의 수를 센다.
+ * - scan       : 전체를 (key, value) 순서로 순회
+ * - erase one  : 특정 값 하나를 지운다. (map-of-vectors는 vector 안에서 찾아서 지워야 한다.)
+ *                multimap은 삽입할 때 받은 iterator로 탐색 없이 지울 수도 있다.
+ * 마지막으로 lower_bound가 O(logN) 탐색으로 바뀐 것을 map에서 확인한다.
+ */
+
+typedef ft::multimap<int, int>				multi;
+typedef ft::map<int, ft::vector<int> >		map_of_vectors;
+
+static void run(size_t n, size_t keys)
+{
+	bench::rng rng(keys);
+	ft::vector<int> ks;
+	ks.reserve(n);
+	for (size_t i = 0; i < n; ++i)
+		ks.push_back(static_cast<int>(rng.below(keys)));
+	std::cout << "  " << n / keys << " values per key" << std::endl;
+
+	multi mm;
+	map_of_vectors mv;
+	ft::vector<multi::iterator> handles(n);
+	{
+		bench::timer t;
+		for (size_t i = 0; i < n; ++i)
+			handles[i] = mm.insert(ft::make_pair(ks[i], static_cast<int>(i)));
+		bench::report("build: multimap", t.elapsed_ms(), n);
+		t.reset();
+		for (size_t i = 0; i < n; ++i)
+			mv[ks[i]].push_back(static_cast<int>(i));
+		bench::report("build: map<int, vector<int> >", t.elapsed_ms(), n);
+	}
+	{
+		long sum = 0;
+		bench::timer t;
+		for (size_t k = 0; k < keys; ++k)
+		{
+			ft::pair<multi::iterator, multi::iterator> r = mm.equal_range(static_cast<int>(k));
+			for (; r.first != r.second; ++r.first)
+				sum += r.first->second;
+		}
+		bench::report("lookup: multimap::equal_range", t.elapsed_ms(), n);
+		t.reset();
+		for (size_t k = 0; k < keys; ++k)
+		{
+			map_of_vectors::iterator it = mv.find(static_cast<int>(k));
+			if (it == mv.end())
+				continue;
+			for (size_t i = 0; i < it->second.size(); ++i)
+				sum -= it->second[i];
+		}
+		bench::report("lookup: map::find + vector", t.elapsed_ms(), n);
+		bench::keep(sum);
+	}
+	{
+		size_t total = 0;
+		bench::timer t;
+		for (size_t k = 0; k < keys; ++k)
+			total += mm.count(static_cast<int>(k));
+		bench::report("count: multimap::count", t.elapsed_ms(), keys);
+		bench::keep(total);
+	}
+	{
+		long sum = 0;
+		bench::timer t;
+		for (multi::iterator it = mm.begin(); it != mm.end(); ++it)
+			sum += it->second;
+		bench::report("scan: multimap", t.elapsed_ms(), n);
+		t.reset();
+		for (map_of_vectors::iterator it = mv.begin(); it != mv.end(); ++it)
+			for (size_t i = 0; i < it->second.size(); ++i)
+				sum -= it->second[i];
+		bench::report("scan: map<int, vector<int> >", t.elapsed_ms(), n);
+		std::cout << "    checksum: " << ((sum == 0) ? "OK" : "KO") << std::endl;
+	}
+	{
+		size_t m = n / 10;
+		bench::timer t;
+		for (size_t i = 0; i < m; ++i)
+		{
+			ft::pair<multi::iterator, multi::iterator> r = mm.equal_range(ks[i]);
+			for (; r.first != r.second; ++r.first)
+				if (r.first->second == static_cast<int>(i))
+				{
+					mm.erase(r.first);
+					break;
+				}
+		}
+		bench::report("erase one: multimap", t.elapsed_ms(), m);
+		t.reset();
+		for (size_t i = 0; i < m; ++i)
+		{
+			ft::vector<int>& v = mv[ks[i]];
+			for (ft::vector<int>::iterator it = v.begin(); it != v.end(); ++it)
+				if (*it == static_cast<int>(i))
+				{
+					v.erase(it);
+					break;
+				}
+		}
+		bench::report("erase one: map<int, vector<int> >", t.elapsed_ms(), m);
+		//multimap의 iterator는 다른 요소를 지워도 유효하므로 삽입할 때 받은 iterator로 바로 지울 수 있다.
+		t.reset();
+		for (size_t i = m; i < 2 * m; ++i)
+			mm.erase(handles[i]);
+		bench::report("erase by iterator: multimap", t.elapsed_ms(), m);
+	}
+}
+
+static void bound(size_t n)
+{
+	ft::map<int, int> mp;
+	for (size_t i = 0; i < n; ++i)
+		mp.insert(ft::make_pair(static_cast<int>(i * 2), 0));
+	bench::rng rng;
+	size_t m = 100000;
+	long sum = 0;
+	bench::timer t;
+	for (size_t i = 0; i < m; ++i)
+		sum += mp.lower_bound(static_cast<int>(rng.below(n * 2)))->first;
+	bench::report("ft::map::lower_bound", t.elapsed_ms(), m);
+	bench::keep(sum);
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 1000000);
+
+	bench::title("many keys, few values", n);
+	run(n, n / 4);
+	bench::title("few keys, many values", n);
+	run(n, 64);
+	bench::title("lower_bound", n);
+	bound(n);
+	return (0);
+}
@@ -0,0 +1,153 @@
+#include "priority_queue.hpp"
+#include "map.hpp"
+#include "bench.hpp"
+
+/**
+ * priority_queue benchmark
+ *
+ * map을 priority queue로 쓰는 방식(insert + begin() + erase(begin()))과
+ * binary / 4-ary heap을 비교한다. 모두 min-queue로 동작한다.
+ */
+
+typedef ft::priority_queue<int, ft::vector<int>, ft::greater<int>, 2>	binary_heap;
+typedef ft::priority_queue<int, ft::vector<int>, ft::greater<int>, 4>	quad_heap;
+typedef ft::map<ft::pair<int, size_t>, int>								map_queue;
+
+static ft::vector<int> make_keys(size_t n)
+{
+	bench::rng rng;
+	ft::vector<int> keys;
+	keys.reserve(n);
+	for (size_t i = 0; i < n; ++i)
+		keys.push_back(static_cast<int>(rng.below(n * 4)));
+	return (keys);
+}
+
+template <typename Heap>
+static unsigned long long heap_push_pop(const char* name, const ft::vector<int>& keys)
+{
+	unsigned long long sum = 0;
+	bench::timer t;
+	Heap pq;
+	for (size_t i = 0; i < keys.size(); ++i)
+		pq.push(keys[i]);
+	for (size_t i = 0; !pq.empty(); ++i)
+	{
+		sum = sum * 31 + pq.top();
+		pq.pop();
+	}
+	bench::report(name, t.elapsed_ms(), keys.size() * 2);
+	return (sum);
+}
+
+static unsigned long long map_push_pop(const char* name, const ft::vector<int>& keys)
+{
+	unsigned long long sum = 0;
+	bench::timer t;
+	map_queue mq;
+	for (size_t i = 0; i < keys.size(); ++i)
+		mq.insert(ft::make_pair(ft::make_pair(keys[i], i), 0));
+	while (!mq.empty())
+	{
+		sum = sum * 31 + mq.begin()->first.first;
+		mq.erase(mq.begin());
+	}
+	bench::report(name, t.elapsed_ms(), keys.size() * 2);
+	return (sum);
+}
+
+//timer wheel처럼 크기를 유지한 채 push/pop을 반복한다.
+template <typename Heap>
+static void heap_steady(const char* name, const ft::vector<int>& keys)
+{
+	Heap pq(keys.begin(), keys.begin() + keys.size() / 2);
+	bench::timer t;
+	for (size_t i = keys.size() / 2; i < keys.size(); ++i)
+	{
+		pq.push(pq.top() + keys[i] % 64);
+		pq.pop();
+	}
+	bench::keep(pq.top());
+	bench::report(name, t.elapsed_ms(), keys.size() - keys.size() / 2);
+}
+
+static void map_steady(const char* name, const ft::vector<int>& keys)
+{
+	map_queue mq;
+	for (size_t i = 0; i < keys.size() / 2; ++i)
+		mq.insert(ft::make_pair(ft::make_pair(keys[i], i), 0));
+	bench::timer t;
+	for (size_t i = keys.size() / 2; i < keys.size(); ++i)
+	{
+		mq.insert(ft::make_pair(ft::make_pair(mq.begin()->first.first + keys[i] % 64, i), 0));
+		mq.erase(mq.begin());
+	}
+	bench::keep(mq.begin()->first.first);
+	bench::report(name, t.elapsed_ms(), keys.size() - keys.size() / 2);
+}
+
+template <typename Heap>
+static void heap_push_range(const char* name, const ft::vector<int>& keys)
+{
+	bench::timer t;
+	Heap pq;
+	pq.push_range(keys.begin(), keys.end());
+	bench::keep(pq.top());
+	bench::report(name, t.elapsed_ms(), keys.size());
+}
+
+//Dijkstra에서처럼 들어있는 key를 줄여가며 pop 한다.
+template <size_t Arity>
+static void indexed_decrease_key(const char* name, const ft::vector<int>& keys)
+{
+	size_t n = keys.size();
+	bench::rng rng(7);
+	bench::timer t;
+	ft::indexed_priority_queue<int, ft::greater<int>, Arity> pq(n);
+	for (size_t i = 0; i < n; ++i)
+		pq.push(i, keys[i]);
+	size_t ops = n;
+	while (!pq.empty())
+	{
+		int top = pq.top();
+		pq.pop();
+		for (int k = 0; k < 2; ++k)
+		{
+			size_t id = rng.below(n);
+			if (pq.contains(id) && pq.key(id) > top)
+			{
+				pq.decrease_key(id, top + (pq.key(id) - top) / 2);
+				++ops;
+			}
+		}
+		++ops;
+	}
+	bench::report(name, t.elapsed_ms(), ops);
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 1000000);
+	ft::vector<int> keys = make_keys(n);
+
+	//map 소멸 직후에는 malloc이 해제된 노드를 정리하느라 큰 할당이 느려지므로 가장 먼저 측정한다.
+	bench::title("bulk push_range (O(n) heapify)", n);
+	heap_push_range<binary_heap>("push_range (binary)", keys);
+	heap_push_range<quad_heap>("push_range (4-ary)", keys);
+
+	bench::title("push n + pop n", n);
+	unsigned long long a = heap_push_pop<binary_heap>("ft::priority_queue (binary)", keys);
+	unsigned long long b = heap_push_pop<quad_heap>("ft::priority_queue (4-ary)", keys);
+	unsigned long long c = map_push_pop("ft::map as priority queue", keys);
+	std::cout << "same pop order: " << ((a == b && b == c) ? "OK" : "KO") << std::endl;
+
+	bench::title("steady state push + pop (timer wheel)", n / 2);
+	heap_steady<binary_heap>("ft::priority_queue (binary)", keys);
+	heap_steady<quad_heap>("ft::priority_queue (4-ary)", keys);
+	map_steady("ft::map as priority queue", keys);
+
+	bench::title("indexed heap pop + decrease_key", n);
+	indexed_decrease_key<2>("ft::indexed_priority_queue (binary)", keys);
+	indexed_decrease_key<4>("ft::indexed_priority_queue (4-ary)", keys);
+	return (0);
+}
@@ -0,0 +1,165 @@
+#include "radix_map.hpp"
+#include "map.hpp"
+#include "vector.hpp"
+#include "bench.hpp"
+#include <cstdlib>
+#include <new>
+
+/**
+ * radix_map benchmark
+ *
+ * URL / 파일 경로처럼 긴 공통 prefix를 가진 key로 ft::map<std::string, int>와 radix_map<int>를 비교한다.
+ * - memory : 전역 operator new를 바꿔서 컨테이너가 요청한 byte 수를 센다. (std::string이 따로 할당하는 버퍼 포함)
+ * - build / find hit / find miss / 정렬 순서 scan / prefix scan
+ */
+
+static size_t g_live_bytes = 0;
+
+//inline되면 gcc가 malloc/free와 new/delete의 짝이 맞지 않는다고 경고하므로 inline하지 않는다.
+__attribute__((noinline))
+void* operator new(std::size_t size) throw(std::bad_alloc)
+{
+	std::size_t* p = static_cast<std::size_t*>(std::malloc(size + sizeof(std::size_t) * 2));
+	if (p == NULL)
+		throw std::bad_alloc();
+	p[0] = size;
+	g_live_bytes += size;
+	return (p + 2);
+}
+
+__attribute__((noinline))
+void operator delete(void* ptr) throw()
+{
+	if (ptr == NULL)
+		return ;
+	std::size_t* p = static_cast<std::size_t*>(ptr) - 2;
+	g_live_bytes -= p[0];
+	std::free(p);
+}
+
+static std::string number(size_t n)
+{
+	char buf[32];
+	int len = 0;
+	do
+	{
+		buf[len++] = static_cast<char>('0' + n % 10);
+		n /= 10;
+	} while (n != 0);
+	std::string res;
+	while (len > 0)
+		res += buf[--len];
+	return (res);
+}
+
+static ft::vector<std::string> make_urls(size_t n)
+{
+	static const char* hosts[] = { "https://www.example.com", "https://api.example.com", "https://cdn.example.net" };
+	static const char* paths[] = { "/api/v1/users/", "/api/v1/orders/", "/api/v2/users/", "/static/assets/img/", "/docs/reference/" };
+	bench::rng rng(1);
+	ft::vector<std::string> keys;
+	keys.reserve(n);
+	for (size_t i = 0; i < n; ++i)
+	{
+		std::string k(hosts[rng.below(3)]);
+		k += paths[rng.below(5)];
+		k += number(rng.below(n));
+		if (rng.below(2) == 0)
+			k += "/details";
+		keys.push_back(k);
+	}
+	return (keys);
+}
+
+static ft::vector<std::string> make_paths(size_t n)
+{
+	static const char* dirs[] = { "/var/lib/service/data/", "/var/log/service/", "/home/user/projects/ft_containers/src/" };
+	bench::rng rng(2);
+	ft::vector<std::string> keys;
+	keys.reserve(n);
+	for (size_t i = 0; i < n; ++i)
+	{
+		std::string k(dirs[rng.below(3)]);
+		k += number(rng.below(64));
+		k += "/part-";
+		k += number(rng.below(n));
+		k += ".log";
+		keys.push_back(k);
+	}
+	return (keys);
+}
+
+template <typename Map>
+static void run(const char* name, const ft::vector<std::string>& keys, const ft::vector<std::string>& misses, const std::string& prefix)
+{
+	std::cout << name << std::endl;
+	size_t before = g_live_bytes;
+	Map* mp = new Map();
+	bench::timer t;
+	for (size_t i = 0; i < keys.size(); ++i)
+		(*mp)[keys[i]] = static_cast<int>(i);
+	bench::report("  build", t.elapsed_ms(), keys.size());
+	size_t bytes = g_live_bytes - before;
+	std::cout << "  memory: " << bytes / 1024 << " KiB, " << bytes / mp->size() << " bytes/key" << std::endl;
+
+	long sum = 0;
+	t.reset();
+	for (size_t i = keys.size(); i-- > 0; )
+		sum += mp->find(keys[i])->second;
+	bench::report("  find hit", t.elapsed_ms(), keys.size());
+
+	t.reset();
+	for (size_t i = 0; i < misses.size(); ++i)
+		sum += (mp->find(misses[i]) == mp->end()) ? 1 : 0;
+	bench::report("  find miss", t.elapsed_ms(), misses.size());
+
+	size_t len = 0;
+	t.reset();
+	for (typename Map::iterator it = mp->begin(); it != mp->end(); ++it)
+		len += it->first.size();
+	bench::report("  ordered scan", t.elapsed_ms(), mp->size());
+
+	size_t matched = 0;
+	t.reset();
+	for (typename Map::iterator it = mp->lower_bound(prefix); it != mp->end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it)
+		++matched;
+	bench::report("  prefix scan", t.elapsed_ms(), matched);
+	std::cout << "  checksum: " << sum << " / " << len << " / " << matched << std::endl;
+	delete mp;
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 500000);
+
+	ft::vector<std::string> urls = make_urls(n);
+	ft::vector<std::string> url_misses;
+	for (size_t i = 0; i < n / 4; ++i)
+		url_misses.push_back(urls[i] + "x");
+	bench::title("URL keys", n);
+	run< ft::map<std::string, int> >("ft::map<std::string, int>", urls, url_misses, "https://api.example.com/api/v1/users/1");
+	run< ft::radix_map<int> >("ft::radix_map<int>", urls, url_misses, "https://api.example.com/api/v1/users/1");
+
+	ft::vector<std::string> paths = make_paths(n);
+	ft::vector<std::string> path_misses;
+	for (size_t i = 0; i < n / 4; ++i)
+		path_misses.push_back(paths[i].substr(0, paths[i].size() - 4));
+	bench::title("file path keys", n);
+	run< ft::map<std::string, int> >("ft::map<std::string, int>", paths, path_misses, "/var/log/service/3");
+	run< ft::radix_map<int> >("ft::radix_map<int>", paths, path_misses, "/var/log/service/3");
+
+	//radix_map::prefix_range는 lower_bound 두 번으로 범위를 바로 구한다.
+	ft::radix_map<int> rm;
+	for (size_t i = 0; i < paths.size(); ++i)
+		rm[paths[i]] = static_cast<int>(i);
+	bench::timer t;
+	size_t total = 0;
+	for (int d = 0; d < 64; ++d)
+	{
+		ft::pair<ft::radix_map<int>::iterator, ft::radix_map<int>::iterator> r = rm.prefix_range("/var/log/service/" + number(d) + "/");
+		for (; r.first != r.second; ++r.first)
+			++total;
+	}
+	bench::report("radix_map::prefix_range per directory", t.elapsed_ms(), total);
+	return (0);
+}
@@ -0,0 +1,103 @@
+#include "map.hpp"
+#include "multimap.hpp"
+#include "multiset.hpp"
+#include "vector.hpp"
+#include "bench.hpp"
+#include <map>
+#include <set>
+
+/**
+ * RBTree memory benchmark
+ *
+ * RBTreeNode가 color를 parent 포인터의 하위 bit에 넣고, value를 노드 안에 두고, allocator 멤버를 없앤 후의 메모리 사용량을 본다.
+ * - node size	: sizeof(RBTreeNode)와 예전 노드 구조(value*, parent, child[2], color, allocator + 따로 할당한 value)를 비교한다.
+ * - memory	: bench::counting_allocator로 컨테이너가 할당한 byte 수를 세어 원소당 byte를 출력한다.
+ *		  (nil 노드 포함, malloc header 제외. std::string의 문자열 buffer는 세지 않는다.)
+ * - find	: 노드가 작아져서 cache에 더 많이 들어가는지 random find로 확인한다.
+ * std 컨테이너는 참고용이다.
+ */
+
+//예전 RBTreeNode의 구조. value는 노드 밖에 따로 할당했다.
+template <typename T>
+struct legacy_node
+{
+	T*				value;
+	legacy_node*	parent;
+	legacy_node*	child[2];
+	ft::RBColor		color;
+	std::allocator<T>	alloc;
+};
+
+template <typename T>
+static void node_size(const char* name)
+{
+	std::cout << "  " << std::left << std::setw(24) << name
+		<< "node " << sizeof(ft::RBTreeNode<T>) << " B"
+		<< "  (legacy " << sizeof(legacy_node<T>) << " + " << sizeof(T) << " B)" << std::endl;
+}
+
+template <typename Map, typename Pair>
+static void run(const char* name, const ft::vector<long>& keys, const ft::vector<long>& queries)
+{
+	std::string label(name);
+	size_t before = bench::live_bytes();
+	Map* mp = new Map();
+	for (size_t i = 0; i < keys.size(); ++i)
+		mp->insert(Pair(keys[i], keys[i]));
+	bench::report_memory((label + " memory").c_str(), bench::live_bytes() - before, mp->size());
+
+	long sum = 0;
+	bench::timer t;
+	for (size_t i = 0; i < queries.size(); ++i)
+		sum += (mp->find(queries[i]) != mp->end());
+	bench::report((label + " find").c_str(), t.elapsed_ms(), queries.size());
+	bench::keep(sum);
+	delete mp;
+}
+
+template <typename Set>
+static void run_set(const char* name, const ft::vector<long>& keys)
+{
+	size_t before = bench::live_bytes();
+	Set* st = new Set();
+	for (size_t i = 0; i < keys.size(); ++i)
+		st->insert(static_cast<int>(keys[i]));
+	bench::report_memory(name, bench::live_bytes() - before, st->size());
+	delete st;
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 1000000);
+	bench::rng rng(n);
+
+	ft::vector<long> keys;
+	for (size_t i = 0; i < n; ++i)
+		keys.push_back(static_cast<long>(rng.below(n * 4)));
+	ft::vector<long> queries;
+	for (size_t i = 0; i < n; ++i)
+		queries.push_back(static_cast<long>(rng.below(n * 4)));
+
+	bench::title("node size", n);
+	node_size<int>("int");
+	node_size< ft::pair<const int, int> >("pair<const int, int>");
+	node_size< ft::pair<const long, long> >("pair<const long, long>");
+	node_size< ft::pair<const std::string, int> >("pair<const string, int>");
+
+	bench::title("map<int, int>", n);
+	run< ft::map<int, int, ft::less<int>, bench::counting_allocator< ft::pair<const int, int> > >, ft::pair<int, int> >("ft::map ", keys, queries);
+	run< std::map<int, int, std::less<int>, bench::counting_allocator< std::pair<const int, int> > >, std::pair<int, int> >("std::map", keys, queries);
+
+	bench::title("map<long, long>", n);
+	run< ft::map<long, long, ft::less<long>, bench::counting_allocator< ft::pair<const long, long> > >, ft::pair<long, long> >("ft::map ", keys, queries);
+	run< std::map<long, long, std::less<long>, bench::counting_allocator< std::pair<const long, long> > >, std::pair<long, long> >("std::map", keys, queries);
+
+	bench::title("multimap<long, long>", n);
+	run< ft::multimap<long, long, ft::less<long>, bench::counting_allocator< ft::pair<const long, long> > >, ft::pair<long, long> >("ft::multimap ", keys, queries);
+	run< std::multimap<long, long, std::less<long>, bench::counting_allocator< std::pair<const long, long> > >, std::pair<long, long> >("std::multimap", keys, queries);
+
+	bench::title("multiset<int>", n);
+	run_set< ft::multiset<int, ft::less<int>, bench::counting_allocator<int> > >("ft::multiset  memory", keys);
+	run_set< std::multiset<int, std::less<int>, bench::counting_allocator<int> > >("std::multiset memory", keys);
+	return (0);
+}
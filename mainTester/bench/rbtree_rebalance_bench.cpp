@@ -0,0 +1,84 @@
+#include "map.hpp"
+#include "vector.hpp"
+#include "bench.hpp"
+#include <map>
+
+/**
+ * RBTree rebalance benchmark
+ *
+ * 삽입/삭제 후 재조정(insert_case, delete_case, rotate)이 방향(dir)을 인자로 받는 한 벌의 코드로 합쳐진 후의 처리량을 본다.
+ * - random		: 무작위 key 삽입 후 무작위 순서로 모두 삭제 -> 좌우 회전이 섞여서 일어난다.
+ * - ascending		: 오름차순 삽입 후 오름차순 삭제 -> 한쪽 방향의 회전만 반복된다.
+ * - churn		: 크기를 유지하면서 삽입 하나, 삭제 하나를 반복
+ * std::map은 참고용이다.
+ *
+ * 코드 크기는 아래처럼 RBTree<int>의 insert/erase를 쓰는 object 파일을 만들어 비교할 수 있다.
+ *   g++ -std=c++98 -O2 -c rb_size.cpp && size -A rb_size.o
+ */
+
+template <typename Map, typename Pair>
+static void run(const char* name, const ft::vector<int>& keys, const ft::vector<int>& order)
+{
+	std::string label(name);
+	size_t n = keys.size();
+	Map mp;
+	bench::timer t;
+	for (size_t i = 0; i < n; ++i)
+		mp.insert(Pair(keys[i], static_cast<int>(i)));
+	bench::report((label + " insert").c_str(), t.elapsed_ms(), n);
+
+	t.reset();
+	size_t erased = 0;
+	for (size_t i = 0; i < n; ++i)
+		erased += mp.erase(order[i]);
+	bench::report((label + " erase").c_str(), t.elapsed_ms(), n);
+	bench::keep(erased);
+
+	//절반 크기를 유지하면서 삽입 하나, 삭제 하나
+	for (size_t i = 0; i < n / 2; ++i)
+		mp.insert(Pair(keys[i], 0));
+	t.reset();
+	for (size_t i = n / 2; i < n; ++i)
+	{
+		mp.insert(Pair(keys[i], 0));
+		mp.erase(keys[i - n / 2]);
+	}
+	bench::report((label + " churn").c_str(), t.elapsed_ms(), n - n / 2);
+}
+
+static void run_all(const char* title, const ft::vector<int>& keys, const ft::vector<int>& order)
+{
+	bench::title(title, keys.size());
+	run< ft::map<int, int>, ft::pair<int, int> >("ft::map ", keys, order);
+	run< std::map<int, int>, std::pair<int, int> >("std::map", keys, order);
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 500000);
+	bench::rng rng(n);
+
+	ft::vector<int> keys(n);
+	for (size_t i = 0; i < n; ++i)
+		keys[i] = static_cast<int>(i);
+	run_all("ascending", keys, keys);
+
+	//Fisher-Yates shuffle
+	for (size_t i = n; i > 1; --i)
+	{
+		size_t j = rng.below(i);
+		int tmp = keys[i - 1];
+		keys[i - 1] = keys[j];
+		keys[j] = tmp;
+	}
+	ft::vector<int> order(keys);
+	for (size_t i = n; i > 1; --i)
+	{
+		size_t j = rng.below(i);
+		int tmp = order[i - 1];
+		order[i - 1] = order[j];
+		order[j] = tmp;
+	}
+	run_all("random", keys, order);
+	return (0);
+}
@@ -0,0 +1,122 @@
+#include "RBTree.hpp"
+#include "vector.hpp"
+#include "bench.hpp"
+
+/**
+ * RBTree search benchmark
+ *
+ * RBTree::find가 노드마다 비교 한 번 + 마지막 확인 한 번으로 바뀐 것을 확인한다.
+ * 비교 대상은 예전 find 루프(_comp(val, x) || _comp(x, val) 후 _comp(val, x)로 방향 결정)를 그대로 옮긴 legacy_find이다.
+ * key는 int와 64 byte key(앞 56 byte가 같고 마지막 8 byte만 다른 최악의 경우) 두 종류이다.
+ * 비교 함수 호출 수를 세어 find 한 번당 평균 비교 횟수도 출력한다.
+ * (분기 없이 child[비교 결과]로 내려가면서 두 자식을 prefetch 한다. prefetch 없이 분기만 없애면 64 byte key에서는 예전보다 느렸다.)
+ */
+
+static size_t g_calls = 0;
+
+struct key64
+{
+	unsigned long	word[8];
+
+	key64() {}
+	explicit key64(unsigned long v)
+	{
+		for (int i = 0; i < 7; ++i)
+			word[i] = 0x2f7061746832f2fUL;
+		word[7] = v;
+	}
+	bool operator<(const key64& x) const
+	{
+		for (int i = 0; i < 8; ++i)
+			if (word[i] != x.word[i])
+				return (word[i] < x.word[i]);
+		return (false);
+	}
+};
+
+template <typename Key>
+struct counting_less
+{
+	bool operator()(const Key& x, const Key& y) const
+	{
+		++g_calls;
+		return (x < y);
+	}
+};
+
+//예전 RBTree::find
+template <typename Tree>
+typename Tree::node_type* legacy_find(const Tree& tree, const typename Tree::value_type& val)
+{
+	typedef typename Tree::node_type node_type;
+	typename Tree::value_comp comp;
+	node_type* res = tree.get_root();
+	while (!res->is_nil() && (comp(val, res->value) || comp(res->value, val)))
+	{
+		if (comp(val, res->value))
+			res = res->child[ft::LEFT];
+		else
+			res = res->child[ft::RIGHT];
+	}
+	return (res);
+}
+
+template <typename Key, typename Compare>
+static void run(const char* name, size_t n, bool count)
+{
+	//set처럼 key만 저장하는 RBTree로 비교한다.
+	ft::RBTree<Key, Compare> tree;
+	ft::vector<Key> keys;
+	bench::rng rng(n);
+	for (size_t i = 0; i < n; ++i)
+	{
+		keys.push_back(Key(rng.next()));
+		tree.insert(keys.back());
+	}
+	//절반은 없는 key
+	ft::vector<Key> queries;
+	for (size_t i = 0; i < n; ++i)
+		queries.push_back((i & 1) ? keys[rng.below(n)] : Key(rng.next()));
+
+	std::string label(name);
+	long found = 0;
+	g_calls = 0;
+	bench::timer t;
+	for (size_t i = 0; i < n; ++i)
+		found += !legacy_find(tree, queries[i])->is_nil();
+	double legacy_ms = t.elapsed_ms();
+	size_t legacy_calls = g_calls;
+
+	long found2 = 0;
+	g_calls = 0;
+	t.reset();
+	for (size_t i = 0; i < n; ++i)
+		found2 += !tree.find(queries[i])->is_nil();
+	double find_ms = t.elapsed_ms();
+	size_t find_calls = g_calls;
+
+	if (count)
+	{
+		std::cout << "  " << label << ": legacy " << static_cast<double>(legacy_calls) / n
+			<< " -> find " << static_cast<double>(find_calls) / n << " compares / lookup"
+			<< ((found == found2) ? "" : "  (KO: different result)") << std::endl;
+		return ;
+	}
+	bench::report((label + " legacy find").c_str(), legacy_ms, n);
+	bench::report((label + " find").c_str(), find_ms, n);
+	std::cout << "    same result: " << ((found == found2) ? "OK" : "KO") << " (" << found << " hits)" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 1000000);
+
+	bench::title("lookup time (half hits)", n);
+	run<long, ft::less<long> >("int     ", n, false);
+	run<key64, ft::less<key64> >("64B key ", n / 4, false);
+
+	bench::title("comparator calls", n);
+	run<long, counting_less<long> >("int     ", n, true);
+	run<key64, counting_less<key64> >("64B key ", n / 4, true);
+	return (0);
+}
@@ -0,0 +1,107 @@
+#include "segmented_stack.hpp"
+#include "bench.hpp"
+
+/**
+ * segmented_stack benchmark
+ *
+ * push 한 번 한 번의 시간을 재서 tail latency를 비교한다.
+ * ft::stack(vector)은 capacity가 두 배가 될 때마다 전체를 복사하므로 최대값이 크게 튄다.
+ * 마지막으로 top()의 주소가 push 이후에도 유지되는지 확인한다.
+ */
+
+struct frame
+{
+	long	node;
+	long	depth;
+	long	edge;
+	long	parent;
+};
+
+template <typename Stack>
+static void push_latency(const char* name, size_t n)
+{
+	Stack st;
+	frame f = { 0, 0, 0, 0 };
+	double worst = 0;
+	size_t over_1us = 0;
+	size_t over_100us = 0;
+	bench::timer total;
+	for (size_t i = 0; i < n; ++i)
+	{
+		f.node = static_cast<long>(i);
+		double start = bench::now_ms();
+		st.push(f);
+		double us = (bench::now_ms() - start) * 1000.0;
+		if (us > worst)
+			worst = us;
+		if (us > 1.0)
+			++over_1us;
+		if (us > 100.0)
+			++over_100us;
+	}
+	double ms = total.elapsed_ms();
+	bench::report(name, ms, n);
+	std::cout << "    worst push: " << std::setprecision(1) << worst << " us"
+			<< ", pushes > 1us: " << over_1us << ", pushes > 100us: " << over_100us << std::endl;
+
+	bench::timer t;
+	long sum = 0;
+	while (!st.empty())
+	{
+		sum += st.top().node;
+		st.pop();
+	}
+	bench::keep(sum);
+	bench::report("    pop all", t.elapsed_ms(), n);
+}
+
+//DFS처럼 깊이가 오르내리며 chunk 경계를 계속 넘나드는 경우
+template <typename Stack>
+static void boundary_thrash(const char* name, size_t n)
+{
+	Stack st;
+	frame f = { 0, 0, 0, 0 };
+	for (size_t i = 0; i < 4096 / sizeof(frame); ++i)
+		st.push(f);
+	bench::timer t;
+	for (size_t i = 0; i < n; ++i)
+	{
+		st.push(f);
+		st.push(f);
+		st.pop();
+		st.pop();
+	}
+	bench::report(name, t.elapsed_ms(), n * 4);
+}
+
+template <typename Stack>
+static void reference_stability(const char* name)
+{
+	Stack st;
+	frame f = { 42, 0, 0, 0 };
+	st.push(f);
+	const frame* top = &st.top();
+	for (long i = 0; i < 100000; ++i)
+		st.push(f);
+	for (long i = 0; i < 100000; ++i)
+		st.pop();
+	std::cout << std::left << std::setw(40) << name << ((top == &st.top()) ? "stable" : "moved") << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 5000000);
+
+	bench::title("push latency", n);
+	push_latency< ft::stack<frame> >("ft::stack<frame> (vector)", n);
+	push_latency< ft::segmented_stack<frame> >("ft::segmented_stack<frame>", n);
+
+	bench::title("push/pop around a chunk boundary", n);
+	boundary_thrash< ft::stack<frame> >("ft::stack<frame> (vector)", n);
+	boundary_thrash< ft::segmented_stack<frame> >("ft::segmented_stack<frame>", n);
+
+	bench::title("address of the first top() after 100000 push/pop", 100000);
+	reference_stability< ft::stack<frame> >("ft::stack<frame> (vector)");
+	reference_stability< ft::segmented_stack<frame> >("ft::segmented_stack<frame>");
+	return (0);
+}
@@ -0,0 +1,115 @@
+#include "soa_vector.hpp"
+#include "vector.hpp"
+#include "bench.hpp"
+
+/**
+ * soa_vector column scan benchmark
+ *
+ * 96 byte 레코드(trade) 중 price와 qty 두 필드만 읽는 scan을 비교한다.
+ * - ft::vector<trade>	: 레코드를 이어서 저장 -> 레코드마다 96 byte를 cache로 가져와 16 byte만 사용한다.
+ * - soa_vector span	: column<K>()의 포인터 두 개로 scan -> 읽는 byte가 사용하는 byte와 같다. 단순 루프라 vectorize 된다.
+ * - soa_vector row	: soa_row proxy로 레코드 단위 접근 (AoS처럼 쓰는 경우의 비용)
+ * 레코드 하나를 읽고 쓰는 push_back도 함께 본다. (column 8개에 각각 쓰므로 vector<trade>보다 느리다.)
+ */
+
+//tag는 필드 5개 분량(40 byte)을 차지하는 scan에서 읽지 않는 데이터
+struct trade_tag
+{
+	long	word[5];
+};
+
+struct trade
+{
+	long		id;
+	long		timestamp;
+	double		price;
+	double		qty;
+	long		side;
+	long		venue;
+	long		account;
+	trade_tag	tag;
+};
+
+typedef ft::soa_vector<long, long, double, double, long, long, long, trade_tag>	trade_columns;
+
+static trade make_trade(bench::rng& rng, size_t i)
+{
+	trade t;
+	t.id = static_cast<long>(i);
+	t.timestamp = static_cast<long>(i * 7);
+	t.price = 100.0 + static_cast<double>(rng.below(10000)) / 100.0;
+	t.qty = static_cast<double>(rng.below(1000));
+	t.side = static_cast<long>(rng.below(2));
+	t.venue = static_cast<long>(rng.below(16));
+	t.account = static_cast<long>(rng.below(1000));
+	for (int w = 0; w < 5; ++w)
+		t.tag.word[w] = static_cast<long>(i + w);
+	return (t);
+}
+
+static trade_columns::value_type to_row(const trade& t)
+{
+	return (trade_columns::value_type(t.id, t.timestamp, t.price, t.qty, t.side, t.venue, t.account, t.tag));
+}
+
+//연속된 두 배열의 곱의 합
+static double notional(const double* price, const double* qty, size_t n)
+{
+	double sum = 0;
+	for (size_t i = 0; i < n; ++i)
+		sum += price[i] * qty[i];
+	return (sum);
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 4000000);
+	const int rounds = 10;
+	bench::rng rng(n);
+
+	std::cout << "  sizeof(trade) = " << sizeof(trade) << " B" << std::endl;
+
+	bench::title("push_back", n);
+	ft::vector<trade> aos;
+	trade_columns soa;
+	bench::timer t;
+	bench::rng rng_aos(n);
+	for (size_t i = 0; i < n; ++i)
+		aos.push_back(make_trade(rng_aos, i));
+	bench::report("ft::vector<trade>", t.elapsed_ms(), n);
+	t.reset();
+	bench::rng rng_soa(n);
+	for (size_t i = 0; i < n; ++i)
+		soa.push_back(to_row(make_trade(rng_soa, i)));
+	bench::report("ft::soa_vector", t.elapsed_ms(), n);
+
+	bench::title("scan price * qty", n);
+	double sum_aos = 0;
+	t.reset();
+	for (int r = 0; r < rounds; ++r)
+		for (size_t i = 0; i < n; ++i)
+			sum_aos += aos[i].price * aos[i].qty;
+	bench::report("ft::vector<trade>", t.elapsed_ms(), n * rounds);
+
+	double sum_span = 0;
+	t.reset();
+	for (int r = 0; r < rounds; ++r)
+	{
+		ft::soa_span<const double> price = static_cast<const trade_columns&>(soa).column<2>();
+		ft::soa_span<const double> qty = static_cast<const trade_columns&>(soa).column<3>();
+		sum_span += notional(price.data(), qty.data(), price.size());
+	}
+	bench::report("ft::soa_vector span", t.elapsed_ms(), n * rounds);
+
+	double sum_row = 0;
+	t.reset();
+	for (int r = 0; r < rounds; ++r)
+		for (trade_columns::const_iterator it = soa.begin(); it != soa.end(); ++it)
+			sum_row += (*it).get<2>() * (*it).get<3>();
+	bench::report("ft::soa_vector row", t.elapsed_ms(), n * rounds);
+
+	//vectorize된 합은 더하는 순서가 달라 오차가 생길 수 있다.
+	double diff = (sum_aos - sum_span) / sum_aos;
+	std::cout << "    same result: " << ((diff < 1e-9 && diff > -1e-9 && sum_aos == sum_row) ? "OK" : "KO") << std::endl;
+	return (0);
+}
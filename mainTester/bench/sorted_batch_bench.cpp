@@ -0,0 +1,109 @@
+#include "map.hpp"
+#include "vector.hpp"
+#include "bench.hpp"
+
+/**
+ * sorted batch benchmark
+ *
+ * 정렬된 key 묶음을 찾거나 삽입할 때 root부터 찾는 find/insert와 finger search(find_sorted_batch, insert_sorted_batch)를 비교한다.
+ * - dense	: 연속된 key m개 (merge join에서 겹치는 구간, 정렬된 log 재생)
+ * - sparse	: 전체 key 범위에 고르게 퍼진 m개
+ * finger search는 이전 결과에서 다음 key까지의 거리 d에 대해 O(log d)이므로 dense에서 차이가 크다.
+ * sparse에서는 방문하는 노드 수는 적지만(100k개에서 find 약 21개 -> 올라가기 5 + 내려가기 6) 더 느리다.
+ * 서로 독립인 find는 CPU가 다음 find의 cache miss를 미리 겹쳐 처리할 수 있는데, finger search는 이전 결과에 의존해서 한 줄로 기다리기 때문이다.
+ * 간격이 넓은 key는 find_batch가 낫다.
+ * 삽입은 map에 없는 홀수 key를 넣는다.
+ */
+
+static ft::vector<int> dense_keys(size_t n, size_t m, bench::rng& rng)
+{
+	ft::vector<int> keys;
+	size_t start = rng.below(n - m);
+	for (size_t i = 0; i < m; ++i)
+		keys.push_back(static_cast<int>((start + i) * 2));
+	return (keys);
+}
+
+static ft::vector<int> sparse_keys(size_t n, size_t m)
+{
+	ft::vector<int> keys;
+	for (size_t i = 0; i < m; ++i)
+		keys.push_back(static_cast<int>(i * (n / m) * 2));
+	return (keys);
+}
+
+static void find(const char* title, const ft::map<int, int>& mp, const ft::vector<int>& keys, int rounds)
+{
+	std::string label(title);
+	size_t m = keys.size();
+	ft::vector<ft::map<int, int>::const_iterator> out(m);
+	long sum = 0;
+	bench::timer t;
+	for (int r = 0; r < rounds; ++r)
+		for (size_t i = 0; i < m; ++i)
+			out[i] = mp.find(keys[i]);
+	bench::report((label + " find").c_str(), t.elapsed_ms(), m * rounds);
+	sum += out[m - 1]->second;
+
+	t.reset();
+	for (int r = 0; r < rounds; ++r)
+		mp.find_sorted_batch(&keys[0], m, &out[0]);
+	bench::report((label + " find_sorted_batch").c_str(), t.elapsed_ms(), m * rounds);
+	sum += out[m - 1]->second;
+	bench::keep(sum);
+}
+
+static void insert(const char* title, const ft::map<int, int>& base, const ft::vector<int>& keys)
+{
+	std::string label(title);
+	ft::vector< ft::pair<int, int> > vals;
+	for (size_t i = 0; i < keys.size(); ++i)
+		vals.push_back(ft::make_pair(keys[i] + 1, static_cast<int>(i)));
+
+	ft::map<int, int> a(base);
+	bench::timer t;
+	for (size_t i = 0; i < vals.size(); ++i)
+		a.insert(vals[i]);
+	bench::report((label + " insert").c_str(), t.elapsed_ms(), vals.size());
+
+	ft::map<int, int> b(base);
+	t.reset();
+	b.insert_sorted_batch(vals.begin(), vals.end());
+	bench::report((label + " insert_sorted_batch").c_str(), t.elapsed_ms(), vals.size());
+	std::cout << "    same result: " << ((a == b) ? "OK" : "KO") << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 1000000);
+	bench::rng rng(n);
+
+	//짝수 key 0, 2, ..., 2(n-1)를 무작위 순서로 넣는다.
+	ft::vector<int> keys(n);
+	for (size_t i = 0; i < n; ++i)
+		keys[i] = static_cast<int>(i * 2);
+	for (size_t i = n; i > 1; --i)
+	{
+		size_t j = rng.below(i);
+		int tmp = keys[i - 1];
+		keys[i - 1] = keys[j];
+		keys[j] = tmp;
+	}
+	ft::map<int, int> mp;
+	for (size_t i = 0; i < n; ++i)
+		mp.insert(ft::make_pair(keys[i], static_cast<int>(i)));
+
+	size_t sizes[] = { 1000, 100000 };
+	for (size_t s = 0; s < 2; ++s)
+	{
+		size_t m = sizes[s];
+		int rounds = static_cast<int>(1000000 / m);
+		bench::title("sorted batch lookup", m);
+		find("dense ", mp, dense_keys(n, m, rng), rounds);
+		find("sparse", mp, sparse_keys(n, m), rounds);
+		bench::title("sorted batch insert", m);
+		insert("dense ", mp, dense_keys(n, m, rng));
+		insert("sparse", mp, sparse_keys(n, m));
+	}
+	return (0);
+}
@@ -0,0 +1,110 @@
+#include "static_vector.hpp"
+#include "vector.hpp"
+#include "stack.hpp"
+#include "bench.hpp"
+#include <new>
+#include <cstdlib>
+
+/**
+ * static_vector benchmark
+ *
+ * 작은 임시 buffer를 만들고 버리는 hot path에서 ft::vector와 ft::static_vector<T, N>을 비교한다.
+ * - allocations	: 전역 operator new를 바꿔서 측정 구간의 heap 할당 횟수를 센다. static_vector는 0이어야 한다.
+ * - scratch		: buffer를 만들어 k개를 push_back 하고, 가운데에 하나 insert, 하나 erase 한 후 합을 구하고 버린다.
+ * - stack			: ft::stack<int, Container>에 k개를 push 한 후 모두 pop
+ * ft::vector는 reserve를 하지 않은 경우와 한 경우를 모두 본다.
+ */
+
+static size_t g_allocations = 0;
+
+void* operator new(size_t size) throw(std::bad_alloc)
+{
+	++g_allocations;
+	void* p = std::malloc(size ? size : 1);
+	if (!p)
+		throw std::bad_alloc();
+	return (p);
+}
+
+void operator delete(void* p) throw()
+{
+	std::free(p);
+}
+
+template <typename Buffer>
+static long scratch(size_t k, bool reserve)
+{
+	Buffer buf;
+	if (reserve)
+		buf.reserve(k + 1);
+	for (size_t i = 0; i < k; ++i)
+		buf.push_back(static_cast<int>(i));
+	buf.insert(buf.begin() + k / 2, 7);
+	buf.erase(buf.begin() + k / 4);
+	long sum = 0;
+	for (typename Buffer::const_iterator it = buf.begin(); it != buf.end(); ++it)
+		sum += *it;
+	return (sum);
+}
+
+template <typename Buffer>
+static void run_scratch(const char* name, size_t k, size_t rounds, bool reserve)
+{
+	long sum = 0;
+	size_t before = g_allocations;
+	bench::timer t;
+	for (size_t r = 0; r < rounds; ++r)
+		sum += scratch<Buffer>(k, reserve);
+	double ms = t.elapsed_ms();
+	size_t allocations = g_allocations - before;
+	bench::report(name, ms, rounds);
+	std::cout << "    allocations / round: " << static_cast<double>(allocations) / rounds << std::endl;
+	bench::keep(sum);
+}
+
+template <typename Container>
+static void run_stack(const char* name, size_t k, size_t rounds)
+{
+	long sum = 0;
+	size_t before = g_allocations;
+	bench::timer t;
+	for (size_t r = 0; r < rounds; ++r)
+	{
+		ft::stack<int, Container> st;
+		for (size_t i = 0; i < k; ++i)
+			st.push(static_cast<int>(i));
+		while (!st.empty())
+		{
+			sum += st.top();
+			st.pop();
+		}
+	}
+	double ms = t.elapsed_ms();
+	size_t allocations = g_allocations - before;
+	bench::report(name, ms, rounds);
+	std::cout << "    allocations / round: " << static_cast<double>(allocations) / rounds << std::endl;
+	bench::keep(sum);
+}
+
+template <size_t N>
+static void run_all(size_t rounds)
+{
+	const size_t k = N - 1;
+	std::cout << std::endl << "===== k = " << k << " elements (static_vector<int, " << N << ">) =====" << std::endl;
+	bench::title("scratch buffer", rounds);
+	run_scratch< ft::vector<int> >("ft::vector", k, rounds, false);
+	run_scratch< ft::vector<int> >("ft::vector + reserve", k, rounds, true);
+	run_scratch< ft::static_vector<int, N> >("ft::static_vector", k, rounds, false);
+	bench::title("stack push / pop", rounds);
+	run_stack< ft::vector<int> >("ft::stack<ft::vector>", k, rounds);
+	run_stack< ft::static_vector<int, N> >("ft::stack<ft::static_vector>", k, rounds);
+}
+
+int main(int argc, char** argv)
+{
+	size_t rounds = bench::arg_size(argc, argv, 1000000);
+	run_all<8>(rounds);
+	run_all<32>(rounds);
+	run_all<128>(rounds / 4);
+	return (0);
+}
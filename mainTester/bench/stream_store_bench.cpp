@@ -0,0 +1,151 @@
+#define FT_STREAM_THREADS 4
+#include "vector.hpp"
+#include "bench.hpp"
+#include <pthread.h>
+
+/**
+ * streaming store benchmark
+ *
+ * 아주 큰 ft::vector<int>를 fill constructor, copy constructor, assign(n, val)로 만들 때 store 방법을 비교한다.
+ * - cached		: threshold를 최대로 두어 streaming store를 끈다. (memcpy / 대입)
+ * - stream		: streaming store (기본 threshold)
+ * - stream x4	: streaming store를 thread 4개로 나눈다.
+ * 측정 항목
+ * - bandwidth	: 쓴 byte / 시간. constructor는 새로 할당한 page를 처음 건드리는 비용(page fault)을 포함하고, assign은 포함하지 않는다.
+ * - probe		: L2에 들어가는 table(1MB)을 무작위로 읽는 작업. assign(n, val) 직후 다시 읽는 시간을 assign 전과 비교한다.
+ * - concurrent	: 다른 thread가 probe를 계속 반복하는 동안 assign(n, val)을 반복하고, 그동안 probe 처리량을 혼자 돌 때와 비교한다.
+ *				  (core가 하나뿐이면 두 thread가 번갈아 실행되므로 cache를 빼앗긴 효과만 보인다.)
+ * probe는 이미 할당된 vector의 assign으로 잰다. 새 page는 kernel이 0으로 채우면서 cache를 거치므로 store 방법과 관계없이 cache를 밀어낸다.
+ * 첫 번째 인자로 vector의 크기(MB)를 바꿀 수 있다.
+ */
+
+static const size_t PROBE_WORDS = (1 << 20) / sizeof(unsigned);
+//cycle을 한 바퀴 돈다. 모든 원소를 한 번씩 읽으므로 cache에서 밀려난 만큼 그대로 느려진다.
+static const size_t PROBE_STEPS = PROBE_WORDS;
+static unsigned g_table[PROBE_WORDS];
+
+//table 안에서 다음 index를 읽은 값으로 정하므로 읽기가 하나씩 이어진다. (prefetch가 도울 수 없다)
+static unsigned probe(size_t steps)
+{
+	unsigned idx = 0;
+	for (size_t i = 0; i < steps; ++i)
+		idx = g_table[idx];
+	return (idx);
+}
+
+struct prober
+{
+	int		stop;
+	size_t	rounds;
+};
+
+static void* probe_loop(void* arg)
+{
+	prober* p = static_cast<prober*>(arg);
+	unsigned sink = 0;
+	while (!__atomic_load_n(&p->stop, __ATOMIC_ACQUIRE))
+	{
+		sink += probe(PROBE_STEPS / 16);
+		__atomic_add_fetch(&p->rounds, 1, __ATOMIC_RELAXED);
+	}
+	bench::keep(sink);
+	return (NULL);
+}
+
+static void report_bandwidth(const char* name, double ms, size_t bytes)
+{
+	bench::report(name, ms, bytes / sizeof(int));
+	std::cout << "    bandwidth: " << std::setprecision(2) << bytes / (ms * 1000000.0) << " GB/s" << std::endl;
+}
+
+static void set_mode(size_t threshold, unsigned threads)
+{
+	ft::stream_settings().threshold = threshold;
+	ft::stream_settings().threads = threads;
+	ft::stream_settings().thread_threshold = 64UL << 20;
+}
+
+//fill / copy / assign을 한 번씩 하고 걸린 시간을 출력한다.
+static void build(size_t n, bool print)
+{
+	size_t bytes = n * sizeof(int);
+	bench::timer t;
+	ft::vector<int> filled(n, 7);
+	double fill_ms = t.elapsed_ms();
+	t.reset();
+	ft::vector<int> copied(filled);
+	double copy_ms = t.elapsed_ms();
+	t.reset();
+	copied.assign(n, 9);
+	double assign_ms = t.elapsed_ms();
+	bench::keep(filled[n / 2]);
+	bench::keep(copied[n / 3]);
+	if (!print)
+		return ;
+	report_bandwidth("fill constructor", fill_ms, bytes);
+	report_bandwidth("copy constructor", copy_ms, bytes);
+	report_bandwidth("assign(n, val)", assign_ms, bytes);
+}
+
+static void run_mode(const char* name, size_t n, size_t threshold, unsigned threads)
+{
+	set_mode(threshold, threads);
+	bench::title(name, n);
+	build(n, true);
+
+	ft::vector<int> target(n, 1);
+	probe(PROBE_STEPS);
+	bench::timer t;
+	bench::keep(probe(PROBE_STEPS));
+	double warm = t.elapsed_ms();
+	target.assign(n, 3);
+	t.reset();
+	bench::keep(probe(PROBE_STEPS));
+	double after = t.elapsed_ms();
+	bench::report("probe (warm)", warm, PROBE_STEPS);
+	bench::report("probe (after assign)", after, PROBE_STEPS);
+
+	prober idle = { 0, 0 };
+	pthread_t tid;
+	pthread_create(&tid, NULL, probe_loop, &idle);
+	t.reset();
+	while (t.elapsed_ms() < 300)
+		;
+	__atomic_store_n(&idle.stop, 1, __ATOMIC_RELEASE);
+	pthread_join(tid, NULL);
+	double idle_rate = idle.rounds / t.elapsed_ms();
+
+	prober busy = { 0, 0 };
+	pthread_create(&tid, NULL, probe_loop, &busy);
+	t.reset();
+	for (int i = 0; i < 8; ++i)
+		target.assign(n, i);
+	__atomic_store_n(&busy.stop, 1, __ATOMIC_RELEASE);
+	double busy_ms = t.elapsed_ms();
+	pthread_join(tid, NULL);
+	double busy_rate = busy.rounds / busy_ms;
+	std::cout << "concurrent probe throughput: " << std::setprecision(1) << 100.0 * busy_rate / idle_rate
+		<< "% of idle (" << std::setprecision(2) << busy_rate << " / " << idle_rate << " rounds/ms)" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	size_t mb = bench::arg_size(argc, argv, 512);
+	size_t n = (mb << 20) / sizeof(int);
+	bench::rng rng;
+	//하나의 긴 cycle을 만든다. (Sattolo)
+	for (size_t i = 0; i < PROBE_WORDS; ++i)
+		g_table[i] = static_cast<unsigned>(i);
+	for (size_t i = PROBE_WORDS - 1; i > 0; --i)
+	{
+		size_t j = rng.below(i);
+		unsigned tmp = g_table[i];
+		g_table[i] = g_table[j];
+		g_table[j] = tmp;
+	}
+	std::cout << "vector size: " << mb << " MB, streaming threshold: " << (FT_STREAM_THRESHOLD >> 20) << " MB" << std::endl;
+	run_mode("cached", n, static_cast<size_t>(-1), 1);
+	run_mode("stream", n, FT_STREAM_THRESHOLD, 1);
+	run_mode("stream x4", n, FT_STREAM_THRESHOLD, 4);
+	return (0);
+}
@@ -0,0 +1,155 @@
+#include "map.hpp"
+#include "prefixed_string.hpp"
+#include "vector.hpp"
+#include "bench.hpp"
+#include <map>
+
+/**
+ * string key map benchmark
+ *
+ * std::string key의 find/insert에서 비교 방식에 따른 차이를 본다.
+ * - ft::map<std::string>			: ft::less<std::string> -> string::compare 한 번으로 방향과 일치 여부를 정한다. (three way)
+ * - ft::map<std::string, less_than>	: three way를 모르는 비교 함수 객체 -> 노드마다 < 한 번, 마지막에 한 번 더 확인
+ * - ft::map<ft::prefixed_string>		: 노드의 key에 캐시된 앞 8 byte를 먼저 비교한다.
+ * - std::map<std::string>			: 참고용
+ *
+ * key는 앞부분이 긴 URL(앞 8 byte가 모두 같다)과 앞부분부터 다른 hex id 두 종류이다.
+ * 마지막에 비교 함수 호출 수를 세어 find 한 번에 몇 번 비교하는지 출력한다.
+ */
+
+//three way를 모르는 사용자 비교 함수 객체
+struct less_than
+{
+	bool operator()(const std::string& x, const std::string& y) const
+	{
+		return (x < y);
+	}
+};
+
+//호출 수를 세는 비교 함수 객체들
+static size_t g_calls = 0;
+
+struct counting_less
+{
+	bool operator()(const std::string& x, const std::string& y) const
+	{
+		++g_calls;
+		return (x < y);
+	}
+};
+
+struct counting_three_way
+{
+	bool operator()(const std::string& x, const std::string& y) const
+	{
+		++g_calls;
+		return (x < y);
+	}
+};
+
+namespace ft
+{
+	template <>
+	struct key_three_way<counting_three_way>
+	{
+		static const bool enabled = true;
+
+		static int compare(const counting_three_way&, const std::string& x, const std::string& y)
+		{
+			++g_calls;
+			return (x.compare(y));
+		}
+	};
+}
+
+static std::string hex(unsigned long n, size_t width)
+{
+	static const char digits[] = "0123456789abcdef";
+	std::string res(width, '0');
+	for (size_t i = width; i-- > 0; n >>= 4)
+		res[i] = digits[n & 15];
+	return (res);
+}
+
+static ft::vector<std::string> make_urls(size_t n, unsigned long seed)
+{
+	static const char* paths[] = { "https://www.example.com/api/v1/users/", "https://www.example.com/api/v1/orders/", "https://www.example.com/static/img/" };
+	bench::rng rng(seed);
+	ft::vector<std::string> keys;
+	keys.reserve(n);
+	for (size_t i = 0; i < n; ++i)
+		keys.push_back(paths[rng.below(3)] + hex(rng.next(), 12));
+	return (keys);
+}
+
+static ft::vector<std::string> make_ids(size_t n, unsigned long seed)
+{
+	bench::rng rng(seed);
+	ft::vector<std::string> keys;
+	keys.reserve(n);
+	for (size_t i = 0; i < n; ++i)
+		keys.push_back(hex(rng.next(), 16) + "-" + hex(rng.next(), 16));
+	return (keys);
+}
+
+template <typename Map, typename Key, typename Pair>
+static void run(const char* name, const ft::vector<std::string>& keys, const ft::vector<std::string>& misses)
+{
+	ft::vector<Key> k(keys.begin(), keys.end());
+	ft::vector<Key> m(misses.begin(), misses.end());
+	Map mp;
+	std::string label(name);
+
+	bench::timer t;
+	for (size_t i = 0; i < k.size(); ++i)
+		mp.insert(Pair(k[i], static_cast<int>(i)));
+	bench::report((label + " insert").c_str(), t.elapsed_ms(), k.size());
+
+	long sum = 0;
+	t.reset();
+	for (size_t i = k.size(); i-- > 0; )
+		sum += mp.find(k[i])->second;
+	bench::report((label + " find hit").c_str(), t.elapsed_ms(), k.size());
+
+	t.reset();
+	for (size_t i = 0; i < m.size(); ++i)
+		sum += (mp.find(m[i]) == mp.end()) ? 1 : 0;
+	bench::report((label + " find miss").c_str(), t.elapsed_ms(), m.size());
+	bench::keep(sum);
+}
+
+template <typename Map>
+static void count_compares(const char* name, const ft::vector<std::string>& keys)
+{
+	Map mp;
+	for (size_t i = 0; i < keys.size(); ++i)
+		mp.insert(ft::make_pair(keys[i], static_cast<int>(i)));
+	g_calls = 0;
+	for (size_t i = 0; i < keys.size(); ++i)
+		bench::keep(mp.find(keys[i])->second);
+	std::cout << "  " << name << ": " << static_cast<double>(g_calls) / keys.size() << " compares / find" << std::endl;
+}
+
+static void run_all(const char* title, const ft::vector<std::string>& keys, const ft::vector<std::string>& misses)
+{
+	bench::title(title, keys.size());
+	run< ft::map<std::string, int>, std::string, ft::pair<std::string, int> >("ft::map<string>             ", keys, misses);
+	run< ft::map<std::string, int, less_than>, std::string, ft::pair<std::string, int> >("ft::map<string, less_than>  ", keys, misses);
+	run< ft::map<ft::prefixed_string, int>, ft::prefixed_string, ft::pair<ft::prefixed_string, int> >("ft::map<prefixed_string>    ", keys, misses);
+	run< std::map<std::string, int>, std::string, std::pair<std::string, int> >("std::map<string>            ", keys, misses);
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 200000);
+
+	ft::vector<std::string> urls = make_urls(n, 1);
+	run_all("URL keys (shared 24+ byte prefix)", urls, make_urls(n / 4, 2));
+	ft::vector<std::string> ids = make_ids(n, 3);
+	run_all("hex id keys", ids, make_ids(n / 4, 4));
+
+	bench::title("comparator calls per find", n);
+	count_compares< ft::map<std::string, int, counting_less> >("single <  + final check", urls);
+	count_compares< ft::map<std::string, int, counting_three_way> >("three way compare       ", urls);
+	return (0);
+}
@@ -0,0 +1,114 @@
+#include "vector.hpp"
+#include "bench.hpp"
+#include <string>
+
+/**
+ * unordered_erase / erase_indices benchmark
+ *
+ * 큰 vector의 임의 위치에서 요소를 지운다.
+ * - single	: k번 임의 위치를 erase / unordered_erase. erase는 뒤의 요소를 모두 당기고 unordered_erase는 마지막 요소 하나만 옮긴다.
+ * - bulk	: k개의 정렬된 index를 뒤에서부터 erase 하는 방법과 erase_indices 한 번을 비교한다.
+ * 요소 타입
+ * - int		: trivially copyable (memmove/memcpy)
+ * - entity		: 64 byte POD
+ * - handle		: 복사하면 heap을 새로 할당하는 타입. is_trivially_relocatable을 특수화하면 대입 대신 memmove로 옮긴다.
+ * - std::string	: 대입으로 옮긴다.
+ */
+
+struct entity
+{
+	float	pos[4];
+	float	vel[4];
+	int		id;
+	int		pad[7];
+};
+
+class handle
+{
+	private:
+		int*	_p;
+	public:
+		handle(int v = 0) : _p(new int(v)) {}
+		handle(const handle& x) : _p(new int(*x._p)) {}
+		handle& operator=(const handle& x) { *_p = *x._p; return (*this); }
+		~handle() { delete _p; }
+		int get() const { return (*_p); }
+};
+
+//handle은 자기 주소를 저장하지 않으므로 memcpy로 옮긴 후 원래 자리를 버려도 된다.
+namespace ft
+{
+	template <>
+	struct is_trivially_relocatable<handle> { static const bool value = true; };
+}
+
+template <typename T> T make(size_t i);
+template <> int make<int>(size_t i) { return (static_cast<int>(i)); }
+template <> entity make<entity>(size_t i) { entity e = entity(); e.id = static_cast<int>(i); return (e); }
+template <> handle make<handle>(size_t i) { return (handle(static_cast<int>(i))); }
+template <> std::string make<std::string>(size_t i) { return (std::string(i % 24 + 1, 'a')); }
+
+template <typename T>
+static void run_single(const char* name, const ft::vector<T>& src, size_t k, bool unordered)
+{
+	ft::vector<T> v(src);
+	bench::rng rng;
+	bench::timer t;
+	for (size_t i = 0; i < k; ++i)
+	{
+		typename ft::vector<T>::iterator pos = v.begin() + rng.below(v.size());
+		if (unordered)
+			v.unordered_erase(pos);
+		else
+			v.erase(pos);
+	}
+	double ms = t.elapsed_ms();
+	bench::report(name, ms, k);
+	bench::keep(v.size());
+}
+
+template <typename T>
+static void run_bulk(const char* name, const ft::vector<T>& src, const ft::vector<size_t>& indices, bool bulk)
+{
+	ft::vector<T> v(src);
+	bench::timer t;
+	if (bulk)
+		v.erase_indices(indices.begin(), indices.end());
+	else
+		for (size_t i = indices.size(); i-- > 0; )
+			v.erase(v.begin() + indices[i]);
+	double ms = t.elapsed_ms();
+	bench::report(name, ms, indices.size());
+	bench::keep(v.size());
+}
+
+template <typename T>
+static void run_all(const char* type, size_t n, size_t k)
+{
+	ft::vector<T> src;
+	src.reserve(n);
+	for (size_t i = 0; i < n; ++i)
+		src.push_back(make<T>(i));
+	ft::vector<size_t> indices;
+	bench::rng rng(42);
+	for (size_t i = 0; i < n; ++i)
+		if (rng.below(n) < k)
+			indices.push_back(i);
+	std::cout << std::endl << "===== " << type << " (n = " << n << ") =====" << std::endl;
+	bench::title("single random erase", k);
+	run_single("erase", src, k, false);
+	run_single("unordered_erase", src, k, true);
+	bench::title("bulk erase (sorted indices)", indices.size());
+	run_bulk("erase per index (back to front)", src, indices, false);
+	run_bulk("erase_indices", src, indices, true);
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 1000000);
+	run_all<int>("int", n, 1000);
+	run_all<entity>("entity (64 byte)", n / 4, 1000);
+	run_all<handle>("handle (relocatable)", n / 10, 1000);
+	run_all<std::string>("std::string", n / 10, 1000);
+	return (0);
+}
@@ -0,0 +1,125 @@
+#include "vector.hpp"
+#include "bench.hpp"
+
+/**
+ * vector<bool> benchmark
+ *
+ * bit 하나에 1 bit를 쓰는 ft::vector<bool>과 flag 하나에 1 byte를 쓰는 ft::vector<char>를 비교한다.
+ * - memory		: counting_allocator로 센 원소당 byte
+ * - count		: 1인 flag의 수 (vector<bool>은 word마다 popcount, vector<char>는 원소마다 더한다.)
+ * - scan		: find_first/find_next로 1인 flag를 모두 찾는다. (vector<char>는 원소마다 검사)
+ * - and / or	: 같은 크기의 두 bitmap을 합친다. (vector<bool>은 word 단위, vector<char>는 원소마다)
+ * - rank		: [0, pos)의 1인 flag 수. rank 전용 index가 없으므로 vector<bool>도 pos / 64개의 word를 popcount 한다.
+ * flag는 약 1/64 확률로 1이다. (bitmap index에서 흔한 sparse한 경우)
+ */
+
+typedef ft::vector<bool, bench::counting_allocator<bool> >	bits_type;
+typedef ft::vector<char, bench::counting_allocator<char> >	chars_type;
+
+//from 이후의 첫 번째 1인 flag
+static size_t char_find_from(const chars_type& v, size_t from)
+{
+	for (size_t i = from; i < v.size(); ++i)
+		if (v[i])
+			return (i);
+	return (bits_type::npos);
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 64000000);
+	bench::rng rng(n);
+	const int rounds = 10;
+
+	bench::title("memory", n);
+	size_t before = bench::live_bytes();
+	bits_type* bits = new bits_type(n);
+	bench::report_memory("ft::vector<bool>", bench::live_bytes() - before, n);
+	before = bench::live_bytes();
+	chars_type* chars = new chars_type(n);
+	bench::report_memory("ft::vector<char>", bench::live_bytes() - before, n);
+
+	bits_type other_bits(n);
+	chars_type other_chars(n);
+	for (size_t i = 0; i < n; ++i)
+	{
+		bool b = (rng.below(64) == 0);
+		(*bits)[i] = b;
+		(*chars)[i] = b;
+		b = (rng.below(64) == 0);
+		other_bits[i] = b;
+		other_chars[i] = b;
+	}
+
+	bench::title("count", n);
+	size_t sum = 0;
+	bench::timer t;
+	for (int r = 0; r < rounds; ++r)
+		sum += bits->count();
+	bench::report("ft::vector<bool> count", t.elapsed_ms(), n * rounds);
+	size_t sum2 = 0;
+	t.reset();
+	for (int r = 0; r < rounds; ++r)
+		for (size_t i = 0; i < n; ++i)
+			sum2 += (*chars)[i] != 0;
+	bench::report("ft::vector<char> count", t.elapsed_ms(), n * rounds);
+	std::cout << "    same result: " << ((sum == sum2) ? "OK" : "KO") << std::endl;
+
+	bench::title("scan set flags", n);
+	sum = 0;
+	t.reset();
+	for (size_t i = bits->find_first(); i != bits_type::npos; i = bits->find_next(i))
+		sum += i;
+	bench::report("ft::vector<bool> find_next", t.elapsed_ms(), n);
+	sum2 = 0;
+	t.reset();
+	for (size_t i = char_find_from(*chars, 0); i != bits_type::npos; i = char_find_from(*chars, i + 1))
+		sum2 += i;
+	bench::report("ft::vector<char> find_next", t.elapsed_ms(), n);
+	std::cout << "    same result: " << ((sum == sum2) ? "OK" : "KO") << std::endl;
+
+	bench::title("and / or", n);
+	t.reset();
+	for (int r = 0; r < rounds; ++r)
+	{
+		*bits |= other_bits;
+		*bits &= other_bits;
+	}
+	bench::report("ft::vector<bool> |= &=", t.elapsed_ms(), n * rounds);
+	t.reset();
+	for (int r = 0; r < rounds; ++r)
+	{
+		for (size_t i = 0; i < n; ++i)
+			(*chars)[i] |= other_chars[i];
+		for (size_t i = 0; i < n; ++i)
+			(*chars)[i] &= other_chars[i];
+	}
+	bench::report("ft::vector<char> |= &=", t.elapsed_ms(), n * rounds);
+	sum = bits->count();
+	sum2 = 0;
+	for (size_t i = 0; i < n; ++i)
+		sum2 += (*chars)[i] != 0;
+	std::cout << "    same result: " << ((sum == sum2) ? "OK" : "KO") << std::endl;
+
+	const size_t queries = 100;
+	bench::title("rank", queries);
+	sum = 0;
+	t.reset();
+	for (size_t q = 0; q < queries; ++q)
+		sum += bits->rank(rng.below(n));
+	bench::report("ft::vector<bool> rank", t.elapsed_ms(), queries);
+	sum2 = 0;
+	t.reset();
+	for (size_t q = 0; q < queries; ++q)
+	{
+		size_t pos = rng.below(n);
+		for (size_t i = 0; i < pos; ++i)
+			sum2 += (*chars)[i] != 0;
+	}
+	bench::report("ft::vector<char> rank", t.elapsed_ms(), queries);
+	bench::keep(sum + sum2);
+
+	delete bits;
+	delete chars;
+	return (0);
+}
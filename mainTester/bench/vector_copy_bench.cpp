@@ -0,0 +1,112 @@
+#include "vector.hpp"
+#include "bench.hpp"
+#include <vector>
+#include <list>
+
+/**
+ * vector assign/insert copy benchmark
+ *
+ * 원본이 연속된 메모리(pointer, VectorIterator)이고 원소가 trivially copyable이면 assign/range insert가 memcpy/memmove 한 번으로 복사한다.
+ * - pointer, VectorIterator	: memcpy 경로
+ * - std::list iterator		: 원소마다 construct하는 일반 경로
+ * - element-wise		: 복사 생성자가 있는 같은 크기의 타입(wrapped_int)을 pointer로 복사 -> 예전처럼 원소마다 복사하는 비용
+ * insert는 절반 크기의 vector 가운데에 나머지 절반을 넣는다. (capacity가 충분한 경우와 재할당하는 경우)
+ * std::vector는 참고용이다.
+ */
+
+//복사 생성자가 있어서 trivially copyable이 아닌 int
+struct wrapped_int
+{
+	int	value;
+
+	wrapped_int(int v = 0) : value(v) {}
+	wrapped_int(const wrapped_int& x) : value(x.value) {}
+	wrapped_int& operator=(const wrapped_int& x)
+	{
+		value = x.value;
+		return (*this);
+	}
+};
+
+template <typename Vector, typename Iterator>
+static void assign(const char* name, Iterator first, Iterator last, size_t n, int rounds)
+{
+	Vector v;
+	v.reserve(n);
+	long sum = 0;
+	bench::timer t;
+	for (int r = 0; r < rounds; ++r)
+	{
+		v.assign(first, last);
+		sum += v.size();
+	}
+	bench::report(name, t.elapsed_ms(), n * rounds);
+	bench::keep(sum);
+}
+
+template <typename Vector, typename Iterator>
+static void insert(const char* name, Iterator first, Iterator last, size_t n, int rounds, bool reserve)
+{
+	typedef typename Vector::value_type value_type;
+	long sum = 0;
+	double ms = 0;
+	for (int r = 0; r < rounds; ++r)
+	{
+		Vector v(n / 2, value_type(1));
+		if (reserve)
+			v.reserve(n);
+		bench::timer t;
+		v.insert(v.begin() + n / 4, first, last);
+		ms += t.elapsed_ms();
+		sum += v.size();
+	}
+	bench::report(name, ms, (n / 2) * rounds);
+	bench::keep(sum);
+}
+
+template <typename Vector>
+static void insert_all(const char* title, const ft::vector<typename Vector::value_type>& half, const std::list<typename Vector::value_type>& lst, size_t n, int rounds, bool reserve)
+{
+	typedef typename Vector::value_type value_type;
+	const value_type* p = &half[0];
+	bench::title(title, n / 2);
+	insert<Vector>("ft  pointer", p, p + n / 2, n, rounds, reserve);
+	insert<Vector>("ft  VectorIterator", half.begin(), half.end(), n, rounds, reserve);
+	insert<Vector>("ft  std::list iterator", lst.begin(), lst.end(), n, rounds, reserve);
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 4000000);
+	int rounds = 20;
+	bench::rng rng(n);
+
+	ft::vector<int> src;
+	ft::vector<wrapped_int> wsrc;
+	for (size_t i = 0; i < n; ++i)
+	{
+		src.push_back(static_cast<int>(rng.below(1000000)));
+		wsrc.push_back(wrapped_int(src.back()));
+	}
+	std::list<int> lst(src.begin(), src.end());
+	const int* p = &src[0];
+	const wrapped_int* wp = &wsrc[0];
+
+	bench::title("assign (capacity reserved)", n);
+	assign< ft::vector<int> >("ft  pointer", p, p + n, n, rounds);
+	assign< ft::vector<int> >("ft  VectorIterator", src.begin(), src.end(), n, rounds);
+	assign< ft::vector<int> >("ft  std::list iterator", lst.begin(), lst.end(), n, 3);
+	assign< ft::vector<wrapped_int> >("ft  element-wise (wrapped_int)", wp, wp + n, n, rounds);
+	assign< std::vector<int> >("std pointer", p, p + n, n, rounds);
+	assign< std::vector<int> >("std std::list iterator", lst.begin(), lst.end(), n, 3);
+
+	ft::vector<int> half(src.begin(), src.begin() + n / 2);
+	std::list<int> half_lst(half.begin(), half.end());
+	insert_all< ft::vector<int> >("insert in the middle (capacity reserved)", half, half_lst, n, rounds, true);
+	insert< ft::vector<wrapped_int> >("ft  element-wise (wrapped_int)", wp, wp + n / 2, n, rounds, true);
+	insert< std::vector<int> >("std pointer", p, p + n / 2, n, rounds, true);
+	insert_all< ft::vector<int> >("insert in the middle (reallocate)", half, half_lst, n, rounds, false);
+	insert< ft::vector<wrapped_int> >("ft  element-wise (wrapped_int)", wp, wp + n / 2, n, rounds, false);
+	insert< std::vector<int> >("std pointer", p, p + n / 2, n, rounds, false);
+	return (0);
+}
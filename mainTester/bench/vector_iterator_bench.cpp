@@ -0,0 +1,144 @@
+#include "vector.hpp"
+#include "map.hpp"
+#include "bench.hpp"
+#include <vector>
+#include <map>
+
+/**
+ * iterator benchmark
+ *
+ * VectorIterator, RBTreeIterator에서 virtual 소멸자와 직접 만든 copy 생성자/대입 연산자를 없앤 후를 확인한다.
+ * - layout		: iterator가 포인터 하나 크기이고 trivially copyable(trivial copy/assign/destructor)인지 출력한다.
+ * - vector sum	: for (it = v.begin(); it != v.end(); ++it) sum += *it 를 raw pointer 루프, std::vector와 비교한다.
+ * - short ranges	: 8개짜리 범위를 iterator 값으로 받는 함수에 넘긴다. (register로 넘어가는지에 따라 호출 비용이 달라진다.)
+ * - map sum		: tree iterator로 전체를 순회한다.
+ *
+ * vectorize 여부는 아래처럼 확인할 수 있다. sum_pointer와 sum_ft가 같은 loop vectorized 메세지를 내야 한다.
+ *   g++ -std=c++98 -O3 -fopt-info-vec-optimized -Iincludes -ImainTester/bench mainTester/bench/vector_iterator_bench.cpp
+ * -S로 sum_range<VectorIterator<int> >를 보면 iterator가 rdi/rsi register로 넘어와 포인터 루프와 같은 코드가 된다.
+ * (virtual 소멸자가 있을 때는 iterator가 메모리로 넘어와 루프를 돌 때마다 _ptr을 메모리에 다시 저장했다.)
+ */
+
+template <typename It>
+static void layout(const char* name)
+{
+	std::cout << "  " << std::left << std::setw(36) << name
+		<< "sizeof " << sizeof(It)
+		<< "  trivial copy " << (__has_trivial_copy(It) ? "yes" : "no")
+		<< "  trivial assign " << (__has_trivial_assign(It) ? "yes" : "no")
+		<< "  trivial destructor " << (__has_trivial_destructor(It) ? "yes" : "no") << std::endl;
+}
+
+__attribute__((noinline)) static long sum_pointer(const int* first, const int* last)
+{
+	long sum = 0;
+	for (; first != last; ++first)
+		sum += *first;
+	return (sum);
+}
+
+__attribute__((noinline)) static long sum_ft(const ft::vector<int>& v)
+{
+	long sum = 0;
+	for (ft::vector<int>::const_iterator it = v.begin(); it != v.end(); ++it)
+		sum += *it;
+	return (sum);
+}
+
+__attribute__((noinline)) static long sum_std(const std::vector<int>& v)
+{
+	long sum = 0;
+	for (std::vector<int>::const_iterator it = v.begin(); it != v.end(); ++it)
+		sum += *it;
+	return (sum);
+}
+
+//iterator를 값으로 넘긴다. trivial하지 않은 class는 ABI상 stack에 복사본을 만들고 주소로 넘겨야 한다.
+template <typename It>
+__attribute__((noinline)) static long sum_range(It first, It last)
+{
+	long sum = 0;
+	for (; first != last; ++first)
+		sum += *first;
+	return (sum);
+}
+
+template <typename Map>
+__attribute__((noinline)) static long sum_map(const Map& mp)
+{
+	long sum = 0;
+	for (typename Map::const_iterator it = mp.begin(); it != mp.end(); ++it)
+		sum += it->second;
+	return (sum);
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 1000000);
+	int rounds = 50;
+	bench::rng rng(n);
+
+	bench::title("layout", n);
+	layout< ft::vector<int>::iterator >("ft::vector<int>::iterator");
+	layout< ft::map<int, int>::iterator >("ft::map<int, int>::iterator");
+	layout< ft::map<int, int>::const_iterator >("ft::map<int, int>::const_iterator");
+
+	ft::vector<int> fv;
+	for (size_t i = 0; i < n; ++i)
+		fv.push_back(static_cast<int>(rng.below(1000)));
+	std::vector<int> sv(&fv[0], &fv[0] + n);
+
+	bench::title("vector sum", n);
+	long sum = 0;
+	bench::timer t;
+	for (int r = 0; r < rounds; ++r)
+		sum += sum_pointer(&fv[0], &fv[0] + n);
+	bench::report("raw pointer", t.elapsed_ms(), n * rounds);
+	t.reset();
+	for (int r = 0; r < rounds; ++r)
+		sum += sum_ft(fv);
+	bench::report("ft::vector iterator", t.elapsed_ms(), n * rounds);
+	t.reset();
+	for (int r = 0; r < rounds; ++r)
+		sum += sum_std(sv);
+	bench::report("std::vector iterator", t.elapsed_ms(), n * rounds);
+	bench::keep(sum);
+
+	bench::title("short ranges (8 elements, iterators by value)", n);
+	t.reset();
+	for (int r = 0; r < rounds / 10; ++r)
+		for (size_t i = 0; i + 8 <= n; i += 8)
+			sum += sum_range(&fv[0] + i, &fv[0] + i + 8);
+	bench::report("raw pointer", t.elapsed_ms(), n / 8 * (rounds / 10));
+	t.reset();
+	for (int r = 0; r < rounds / 10; ++r)
+		for (size_t i = 0; i + 8 <= n; i += 8)
+			sum += sum_range(fv.begin() + i, fv.begin() + i + 8);
+	bench::report("ft::vector iterator", t.elapsed_ms(), n / 8 * (rounds / 10));
+	t.reset();
+	for (int r = 0; r < rounds / 10; ++r)
+		for (size_t i = 0; i + 8 <= n; i += 8)
+			sum += sum_range(sv.begin() + i, sv.begin() + i + 8);
+	bench::report("std::vector iterator", t.elapsed_ms(), n / 8 * (rounds / 10));
+	bench::keep(sum);
+
+	ft::map<int, int> fm;
+	std::map<int, int> sm;
+	for (size_t i = 0; i < n / 4; ++i)
+	{
+		int k = static_cast<int>(rng.next());
+		fm.insert(ft::make_pair(k, static_cast<int>(i)));
+		sm.insert(std::make_pair(k, static_cast<int>(i)));
+	}
+	bench::title("map traversal", fm.size());
+	t.reset();
+	for (int r = 0; r < rounds / 10; ++r)
+		sum += sum_map(fm);
+	bench::report("ft::map iterator", t.elapsed_ms(), fm.size() * (rounds / 10));
+	t.reset();
+	for (int r = 0; r < rounds / 10; ++r)
+		sum += sum_map(sm);
+	bench::report("std::map iterator", t.elapsed_ms(), sm.size() * (rounds / 10));
+	bench::keep(sum);
+	return (0);
+}
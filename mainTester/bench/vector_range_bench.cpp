@@ -0,0 +1,75 @@
+#include "vector.hpp"
+#include "bench.hpp"
+#include <vector>
+#include <list>
+#include <sstream>
+#include <iterator>
+
+/**
+ * vector range construction benchmark
+ *
+ * ft::distance/advance가 iterator category로 dispatch 된 후 range constructor의 비용을 본다.
+ * - pointer, VectorIterator	: random access -> 크기를 last - first로 바로 구하고 한 번에 할당한다.
+ * - std::list iterator		: bidirectional -> 한 번 세고 한 번 복사한다.
+ * - istream_iterator		: input -> 두 번 읽을 수 없으므로 한 번 읽으면서 늘린다. (예전 구현은 세는 동안 stream을 다 읽어 빈 vector가 되었다.)
+ * (-O2에서는 pointer/VectorIterator에 대한 예전 first++ 루프도 compiler가 last - first로 바꿔버려서 distance만 따로 재는 것은 의미가 없었다.)
+ * std::vector는 참고용이다.
+ */
+
+template <typename Vector, typename Iterator>
+static void construct(const char* name, Iterator first, Iterator last, size_t n, int rounds)
+{
+	long sum = 0;
+	bench::timer t;
+	for (int r = 0; r < rounds; ++r)
+	{
+		Vector v(first, last);
+		sum += v.size();
+	}
+	bench::report(name, t.elapsed_ms(), n * rounds);
+	bench::keep(sum);
+}
+
+template <typename Vector>
+static void from_stream(const char* name, const std::string& text, size_t n, int rounds)
+{
+	long sum = 0;
+	double ms = 0;
+	for (int r = 0; r < rounds; ++r)
+	{
+		std::istringstream in(text);
+		bench::timer t;
+		Vector v((std::istream_iterator<int>(in)), std::istream_iterator<int>());
+		ms += t.elapsed_ms();
+		sum += v.size();
+	}
+	bench::report(name, ms, n * rounds);
+	bench::keep(sum);
+}
+
+int main(int argc, char** argv)
+{
+	size_t n = bench::arg_size(argc, argv, 1000000);
+	int rounds = 10;
+	bench::rng rng(n);
+
+	ft::vector<int> src;
+	for (size_t i = 0; i < n; ++i)
+		src.push_back(static_cast<int>(rng.below(1000000)));
+	std::list<int> lst(src.begin(), src.end());
+	std::ostringstream out;
+	for (size_t i = 0; i < n; ++i)
+		out << src[i] << ' ';
+	std::string text = out.str();
+
+	const int* p = &src[0];
+	bench::title("range constructor", n);
+	construct< ft::vector<int> >("ft  pointer", p, p + n, n, rounds);
+	construct< std::vector<int> >("std pointer", p, p + n, n, rounds);
+	construct< ft::vector<int> >("ft  VectorIterator", src.begin(), src.end(), n, rounds);
+	construct< ft::vector<int> >("ft  std::list iterator", lst.begin(), lst.end(), n, rounds);
+	construct< std::vector<int> >("std std::list iterator", lst.begin(), lst.end(), n, rounds);
+	from_stream< ft::vector<int> >("ft  istream_iterator", text, n, 3);
+	from_stream< std::vector<int> >("std istream_iterator", text, n, 3);
+	return (0);
+}
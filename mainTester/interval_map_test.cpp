@@ -0,0 +1,335 @@
+#include "interval_map.hpp"
+#include <iostream>
+#include <vector>
+#include <map>
+#include <stdexcept>
+
+#ifndef TESTED_NAMESPACE
+#define TESTED_NAMESPACE ft
+#endif
+
+//interval_map은 std에 대응하는 컨테이너가 없으므로 모든 구간을 훑는 naive_interval_map과 비교한다.
+//naive_interval_map은 시작점으로 정렬한 std::multimap에 구간을 저장하고 질의마다 처음부터 끝까지 검사한다.
+template <class Key, class T, class Compare>
+class naive_interval_map
+{
+	private:
+		struct start_less
+		{
+			Compare comp;
+			start_less(const Compare& c) : comp(c) {}
+			bool operator()(const std::pair<Key, Key>& x, const std::pair<Key, Key>& y) const { return (comp(x.first, y.first)); }
+		};
+		typedef std::multimap<std::pair<Key, Key>, T, start_less>	tree_type;
+
+		tree_type	_tree;
+		Compare		_comp;
+
+		bool overlaps(const std::pair<Key, Key>& iv, const Key& lo, const Key& hi, bool stab) const
+		{
+			bool before_hi = stab ? !_comp(hi, iv.first) : _comp(iv.first, hi);
+			return (before_hi && _comp(lo, iv.second));
+		}
+
+	public:
+		typedef typename tree_type::iterator	iterator;
+		typedef typename tree_type::const_iterator	const_iterator;
+		typedef typename tree_type::size_type	size_type;
+
+		explicit naive_interval_map(const Compare& comp = Compare()) : _tree(start_less(comp)), _comp(comp) {}
+
+		iterator begin() { return (_tree.begin()); }
+		iterator end() { return (_tree.end()); }
+		const_iterator end() const { return (_tree.end()); }
+		size_type size() const { return (_tree.size()); }
+		bool empty() const { return (_tree.empty()); }
+
+		iterator insert(const Key& start, const Key& end, const T& val = T())
+		{
+			if (!_comp(start, end))
+				throw std::invalid_argument("Error: naive_interval_map::insert");
+			return (_tree.insert(std::make_pair(std::make_pair(start, end), val)));
+		}
+		void erase(iterator position) { _tree.erase(position); }
+		void erase(iterator first, iterator last) { _tree.erase(first, last); }
+		void clear() { _tree.clear(); }
+
+		template <class OutputIterator>
+		OutputIterator overlap(const Key& lo, const Key& hi, OutputIterator out)
+		{
+			for (iterator it = _tree.begin(); it != _tree.end(); ++it)
+				if (overlaps(it->first, lo, hi, false))
+					*out++ = it;
+			return (out);
+		}
+		template <class OutputIterator>
+		OutputIterator stab(const Key& point, OutputIterator out)
+		{
+			for (iterator it = _tree.begin(); it != _tree.end(); ++it)
+				if (overlaps(it->first, point, point, true))
+					*out++ = it;
+			return (out);
+		}
+		iterator find_overlap(const Key& lo, const Key& hi)
+		{
+			for (iterator it = _tree.begin(); it != _tree.end(); ++it)
+				if (overlaps(it->first, lo, hi, false))
+					return (it);
+			return (_tree.end());
+		}
+
+		template <class OutputIterator>
+		OutputIterator overlap(const Key& lo, const Key& hi, OutputIterator out) const
+		{
+			for (const_iterator it = _tree.begin(); it != _tree.end(); ++it)
+				if (overlaps(it->first, lo, hi, false))
+					*out++ = it;
+			return (out);
+		}
+		template <class OutputIterator>
+		OutputIterator stab(const Key& point, OutputIterator out) const
+		{
+			for (const_iterator it = _tree.begin(); it != _tree.end(); ++it)
+				if (overlaps(it->first, point, point, true))
+					*out++ = it;
+			return (out);
+		}
+		const_iterator find_overlap(const Key& lo, const Key& hi) const
+		{
+			for (const_iterator it = _tree.begin(); it != _tree.end(); ++it)
+				if (overlaps(it->first, lo, hi, false))
+					return (it);
+			return (_tree.end());
+		}
+};
+
+namespace interval_test
+{
+	namespace ft { template <typename Compare> struct map_of { typedef ::ft::interval_map<int, int, Compare> type; }; }
+	namespace std { template <typename Compare> struct map_of { typedef naive_interval_map<int, int, Compare> type; }; }
+}
+
+//상태가 있는 비교 함수 객체. reverse이면 큰 값이 앞선다.
+struct dir_less
+{
+	bool reverse;
+	dir_less(bool r = false) : reverse(r) {}
+	bool operator()(int x, int y) const { return (reverse ? y < x : x < y); }
+};
+
+#define INTERVAL_MAP interval_test::TESTED_NAMESPACE::map_of< std::less<int> >::type
+#define DIR_INTERVAL_MAP interval_test::TESTED_NAMESPACE::map_of<dir_less>::type
+
+//같은 입력에 대해 ft와 naive가 같은 순서를 만들도록 고정된 seed의 LCG를 쓴다.
+static unsigned int g_seed = 42;
+static int next_rand(int range)
+{
+	g_seed = g_seed * 1103515245u + 12345u;
+	return (static_cast<int>((g_seed >> 16) % static_cast<unsigned int>(range)));
+}
+
+template <typename Map>
+void printContainers(Map& mp, bool print_content = true) {
+	std::cout << "size: " << mp.size() << std::endl;
+	if (print_content) {
+		std::cout << "Content is:" << std::endl;
+		for (typename Map::iterator it = mp.begin(); it != mp.end(); ++it)
+			std::cout << "- [" << it->first.first << ", " << it->first.second << ")\t& value: " << it->second << std::endl;
+	}
+	std::cout << "------------------------" << std::endl;
+}
+
+template <typename Iterator>
+void printHits(const char* name, int lo, int hi, const std::vector<Iterator>& hits) {
+	std::cout << name << " [" << lo << ", " << hi << "):";
+	for (size_t i = 0; i < hits.size(); ++i)
+		std::cout << " [" << hits[i]->first.first << ", " << hits[i]->first.second << "):" << hits[i]->second;
+	std::cout << std::endl;
+}
+
+//모든 질의 결과를 출력한다. lo == hi인 overlap은 항상 비어 있어야 한다.
+template <typename Map>
+void printQueries(Map& mp, int from, int to) {
+	typedef typename Map::iterator iterator;
+	for (int p = from; p <= to; p += 5) {
+		std::vector<iterator> hits;
+		mp.stab(p, std::back_inserter(hits));
+		printHits("stab", p, p + 1, hits);
+	}
+	for (int lo = from; lo <= to; lo += 15) {
+		for (int len = 0; len <= 30; len += 10) {
+			std::vector<iterator> hits;
+			mp.overlap(lo, lo + len, std::back_inserter(hits));
+			printHits("overlap", lo, lo + len, hits);
+			iterator first = mp.find_overlap(lo, lo + len);
+			std::cout << "find_overlap [" << lo << ", " << lo + len << "): ";
+			if (first == mp.end())
+				std::cout << "end" << std::endl;
+			else
+				std::cout << "[" << first->first.first << ", " << first->first.second << ")" << std::endl;
+		}
+	}
+}
+
+//const interval_map의 질의는 const_iterator를 돌려준다. 같은 질의를 non-const로 한 결과와 같은 요소를 가리켜야 한다.
+template <typename Map>
+void printConstQueries(const Map& cmp, Map& mp, int from, int to) {
+	typedef typename Map::iterator iterator;
+	typedef typename Map::const_iterator const_iterator;
+	bool same = true;
+	for (int lo = from; lo <= to; lo += 5) {
+		std::vector<iterator> hits;
+		std::vector<const_iterator> chits;
+		mp.stab(lo, std::back_inserter(hits));
+		cmp.stab(lo, std::back_inserter(chits));
+		same = same && hits.size() == chits.size();
+		for (size_t i = 0; same && i < hits.size(); ++i)
+			same = &*hits[i] == &*chits[i];
+		hits.clear();
+		chits.clear();
+		mp.overlap(lo, lo + 10, std::back_inserter(hits));
+		cmp.overlap(lo, lo + 10, std::back_inserter(chits));
+		same = same && hits.size() == chits.size();
+		for (size_t i = 0; same && i < hits.size(); ++i)
+			same = &*hits[i] == &*chits[i];
+		iterator first = mp.find_overlap(lo, lo + 10);
+		const_iterator cfirst = cmp.find_overlap(lo, lo + 10);
+		if (first == mp.end())
+			same = same && cfirst == cmp.end();
+		else
+			same = same && cfirst != cmp.end() && &*first == &*cfirst;
+	}
+	std::cout << "const queries [" << from << ", " << to << "]: " << (same ? "OK" : "KO") << std::endl;
+}
+
+//질의마다 결과의 개수와 합만 출력한다.
+template <typename Map>
+void printChecksum(Map& mp, int queries, int range) {
+	typedef typename Map::iterator iterator;
+	long stab_sum = 0, overlap_sum = 0, find_sum = 0;
+	size_t stab_count = 0, overlap_count = 0;
+	for (int i = 0; i < queries; ++i) {
+		int lo = next_rand(range);
+		int hi = lo + next_rand(range / 10 + 1);
+		std::vector<iterator> hits;
+		mp.stab(lo, std::back_inserter(hits));
+		stab_count += hits.size();
+		for (size_t j = 0; j < hits.size(); ++j)
+			stab_sum += hits[j]->second * static_cast<long>(j + 1);
+		hits.clear();
+		mp.overlap(lo, hi, std::back_inserter(hits));
+		overlap_count += hits.size();
+		for (size_t j = 0; j < hits.size(); ++j)
+			overlap_sum += hits[j]->second * static_cast<long>(j + 1);
+		iterator first = mp.find_overlap(lo, hi);
+		find_sum += (first == mp.end()) ? -1 : first->second;
+	}
+	std::cout << "stab: " << stab_count << " hits, checksum " << stab_sum << std::endl;
+	std::cout << "overlap: " << overlap_count << " hits, checksum " << overlap_sum << std::endl;
+	std::cout << "find_overlap: checksum " << find_sum << std::endl;
+}
+
+int main() {
+	const int intervals[][2] = {
+		{ 10, 20 }, { 15, 25 }, { 0, 5 }, { 30, 40 }, { 10, 12 }, { 5, 50 },
+		{ 42, 43 }, { 25, 30 }, { 10, 20 }, { 60, 70 }, { 35, 36 }, { -10, 0 }
+	};
+	const int interval_count = sizeof(intervals) / sizeof(intervals[0]);
+
+	std::cout << "################ Test Interval Map ################" << std::endl;
+	std::cout << "===== insert =====" << std::endl;
+	INTERVAL_MAP mp;
+	printContainers(mp);
+	for (int i = 0; i < interval_count; ++i)
+		mp.insert(intervals[i][0], intervals[i][1], i);
+	printContainers(mp);
+
+	std::cout << "===== insert (end <= start) =====" << std::endl;
+	const int invalid[][2] = { { 7, 7 }, { 9, 3 } };
+	for (int i = 0; i < 2; ++i) {
+		try {
+			mp.insert(invalid[i][0], invalid[i][1], -1);
+			std::cout << "[" << invalid[i][0] << ", " << invalid[i][1] << "): no exception" << std::endl;
+		} catch (std::invalid_argument&) {
+			std::cout << "[" << invalid[i][0] << ", " << invalid[i][1] << "): invalid_argument" << std::endl;
+		}
+	}
+	printContainers(mp, false);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== stab | overlap | find_overlap =====" << std::endl;
+	printQueries(mp, -15, 75);
+	printConstQueries<INTERVAL_MAP>(mp, mp, -15, 75);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== erase =====" << std::endl;
+	//max_end를 가진 구간([5, 50))과 시작점이 같은 구간 중 하나를 지운 후 다시 질의한다.
+	INTERVAL_MAP::iterator it = mp.begin();
+	for (; it != mp.end() && it->first.first != 5; ++it)
+		;
+	mp.erase(it);
+	it = mp.begin();
+	for (; it != mp.end() && it->first.first != 10; ++it)
+		;
+	mp.erase(it);
+	printContainers(mp);
+	printQueries(mp, -15, 75);
+	it = mp.begin();
+	for (int i = 0; i < 3; ++i)
+		++it;
+	mp.erase(mp.begin(), it);
+	printContainers(mp);
+	printQueries(mp, -15, 75);
+	mp.clear();
+	printContainers(mp);
+	printQueries(mp, 0, 30);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== random insert | erase =====" << std::endl;
+	const int range = 10000;
+	for (int i = 0; i < 2000; ++i) {
+		int start = next_rand(range);
+		mp.insert(start, start + 1 + next_rand(range / 20), i);
+	}
+	printContainers(mp, false);
+	printChecksum(mp, 500, range);
+	//앞에서부터 하나씩 건너뛰며 지워 회전이 많이 일어나게 한다.
+	it = mp.begin();
+	while (it != mp.end()) {
+		mp.erase(it++);
+		if (it != mp.end())
+			++it;
+	}
+	printContainers(mp, false);
+	printChecksum(mp, 500, range);
+	for (int i = 0; i < 500; ++i) {
+		int start = next_rand(range);
+		mp.insert(start, start + 1 + next_rand(range / 2), i + 2000);
+	}
+	printContainers(mp, false);
+	printChecksum(mp, 500, range);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== stateful comparator =====" << std::endl;
+	//역순 비교 함수 객체에서 구간은 [start, end) = start >= x > end 이다. max_end도 이 순서의 최댓값(가장 작은 수)이어야 한다.
+	DIR_INTERVAL_MAP rev((dir_less(true)));
+	rev.insert(100, 0, 1);
+	rev.insert(50, 40, 2);
+	rev.insert(30, 10, 3);
+	printContainers(rev);
+	std::vector<DIR_INTERVAL_MAP::iterator> hits;
+	rev.stab(20, std::back_inserter(hits));
+	printHits("stab", 20, 19, hits);
+	for (int i = 0; i < 1000; ++i) {
+		int start = next_rand(range);
+		rev.insert(start, start - 1 - next_rand(range / 20), i);
+	}
+	printContainers(rev, false);
+	for (int p = range; p >= 0; p -= range / 8) {
+		hits.clear();
+		rev.stab(p, std::back_inserter(hits));
+		std::cout << "stab " << p << ": " << hits.size() << " hits";
+		DIR_INTERVAL_MAP::iterator first = rev.find_overlap(p, p - range / 100);
+		std::cout << ", find_overlap: " << (first == rev.end() ? -1 : first->second) << std::endl;
+	}
+}
@@ -0,0 +1,343 @@
+#include "lockfree_queue.hpp"
+#include <iostream>
+#include <deque>
+#include <vector>
+#include <stdexcept>
+#include <pthread.h>
+#include <sched.h>
+
+#ifndef TESTED_NAMESPACE
+#define TESTED_NAMESPACE ft
+#endif
+
+//lock-free queue는 std에 대응하는 컨테이너가 없으므로 mutex로 보호한 std::deque와 비교한다.
+//capacity를 2의 거듭제곱으로 올리는 것과 full / empty에서 실패하는 동작을 같게 맞춘다.
+template <typename T>
+class locked_queue
+{
+	private:
+		pthread_mutex_t	_lock;
+		std::deque<T>	_queue;
+		size_t			_capacity;
+
+		locked_queue(const locked_queue&);
+		locked_queue& operator=(const locked_queue&);
+
+	public:
+		typedef size_t	size_type;
+
+		explicit locked_queue(size_t capacity) : _queue(), _capacity(1)
+		{
+			if (capacity == 0)
+				throw(std::length_error("Error: locked_queue"));
+			while (_capacity < capacity)
+				_capacity <<= 1;
+			pthread_mutex_init(&_lock, NULL);
+		}
+		~locked_queue() { pthread_mutex_destroy(&_lock); }
+		size_t capacity() const { return (_capacity); }
+		size_t size() { pthread_mutex_lock(&_lock); size_t n = _queue.size(); pthread_mutex_unlock(&_lock); return (n); }
+		bool empty() { return (size() == 0); }
+		bool push(const T& val) { return (push_n(&val, 1) == 1); }
+		bool pop(T& out) { return (pop_n(&out, 1) == 1); }
+		//요소의 복사가 예외를 던지면 그 전까지 옮긴 요소는 그대로 두고 lock을 푼 후 다시 던진다.
+		template <class InputIterator>
+		size_t push_n(InputIterator first, size_t n)
+		{
+			pthread_mutex_lock(&_lock);
+			size_t i = 0;
+			try {
+				for (; i < n && _queue.size() < _capacity; ++i, ++first)
+					_queue.push_back(*first);
+			} catch (...) {
+				pthread_mutex_unlock(&_lock);
+				throw ;
+			}
+			pthread_mutex_unlock(&_lock);
+			return (i);
+		}
+		template <class OutputIterator>
+		size_t pop_n(OutputIterator out, size_t n)
+		{
+			pthread_mutex_lock(&_lock);
+			size_t i = 0;
+			try {
+				for (; i < n && !_queue.empty(); ++i, ++out)
+				{
+					*out = _queue.front();
+					_queue.pop_front();
+				}
+			} catch (...) {
+				pthread_mutex_unlock(&_lock);
+				throw ;
+			}
+			pthread_mutex_unlock(&_lock);
+			return (i);
+		}
+};
+
+namespace queue_test
+{
+	namespace ft
+	{
+		template <typename T> struct spsc_of { typedef ::ft::spsc_queue<T> type; };
+		template <typename T> struct mpmc_of { typedef ::ft::mpmc_queue<T> type; };
+	}
+	namespace std
+	{
+		template <typename T> struct spsc_of { typedef locked_queue<T> type; };
+		template <typename T> struct mpmc_of { typedef locked_queue<T> type; };
+	}
+}
+
+#define SPSC_QUEUE(T) queue_test::TESTED_NAMESPACE::spsc_of<T>::type
+#define MPMC_QUEUE(T) queue_test::TESTED_NAMESPACE::mpmc_of<T>::type
+
+//살아있는 객체 수를 센다. queue가 push에서 construct, pop과 소멸자에서 destroy 하는지 확인한다.
+//mpmc_queue는 예외를 던지지 않는 복사를 요구하므로 throw()로 선언한다.
+class tracked
+{
+	public:
+		static int	live;
+		int			value;
+		tracked(int v = 0) : value(v) { ++live; }
+		tracked(const tracked& x) throw() : value(x.value) { ++live; }
+		tracked& operator=(const tracked& x) throw() { value = x.value; return (*this); }
+		~tracked() { --live; }
+};
+int tracked::live = 0;
+
+//countdown번째 복사(생성 또는 대입)에서 예외를 던진다. spsc_queue의 push_n / pop_n이 실패한 후 상태를 확인한다.
+class fragile
+{
+	public:
+		static int	live;
+		static int	countdown;
+		int			value;
+		fragile(int v = 0) : value(v) { ++live; }
+		fragile(const fragile& x) : value(x.value)
+		{
+			tick();
+			++live;
+		}
+		fragile& operator=(const fragile& x)
+		{
+			tick();
+			value = x.value;
+			return (*this);
+		}
+		~fragile() { --live; }
+	private:
+		static void tick()
+		{
+			if (countdown > 0 && --countdown == 0)
+				throw(std::runtime_error("fragile"));
+		}
+};
+int fragile::live = 0;
+int fragile::countdown = 0;
+
+//push_n과 pop_n은 예외가 나기 전까지 옮긴 요소만 반영하고, 만든 요소는 모두 소멸해야 한다.
+template <typename Queue>
+void exception_safety(const char* name) {
+	std::cout << "===== " << name << " (throwing copy) =====" << std::endl;
+	{
+		Queue q(8);
+		std::vector<fragile> batch;
+		for (int i = 0; i < 5; ++i)
+			batch.push_back(fragile(i));
+		fragile::countdown = 3;
+		try {
+			q.push_n(batch.begin(), batch.size());
+			std::cout << "push_n: no exception" << std::endl;
+		} catch (std::runtime_error&) {
+			std::cout << "push_n: runtime_error" << std::endl;
+		}
+		std::cout << "size: " << q.size() << " / live: " << fragile::live - 5 << std::endl;
+		std::cout << "push_n again: " << q.push_n(batch.begin() + 2, 3) << std::endl;
+		fragile buf[4];
+		fragile::countdown = 3;
+		try {
+			q.pop_n(buf, 4);
+			std::cout << "pop_n: no exception" << std::endl;
+		} catch (std::runtime_error&) {
+			std::cout << "pop_n: runtime_error" << std::endl;
+		}
+		std::cout << "popped: " << buf[0].value << " " << buf[1].value << " / size: " << q.size() << std::endl;
+		fragile out;
+		std::cout << "pop:";
+		while (q.pop(out))
+			std::cout << " " << out.value;
+		std::cout << std::endl;
+		q.push(fragile(7));
+	}
+	std::cout << "live after destruction: " << fragile::live << std::endl;
+}
+
+template <typename Queue>
+void drain(Queue& q) {
+	tracked out;
+	std::cout << "pop:";
+	while (q.pop(out))
+		std::cout << " " << out.value;
+	std::cout << std::endl;
+	std::cout << "size: " << q.size() << " / empty: " << q.empty() << " / live: " << tracked::live - 1 << std::endl;
+}
+
+//단일 thread에서 full / empty / wrap around / batch 동작을 확인한다.
+template <typename Queue>
+void sequential(const char* name) {
+	std::cout << "===== " << name << " =====" << std::endl;
+	{
+		Queue q(5);
+		std::cout << "capacity: " << q.capacity() << std::endl;
+		int pushed = 0;
+		while (q.push(tracked(pushed)))
+			++pushed;
+		std::cout << "pushed until full: " << pushed << " / live: " << tracked::live << std::endl;
+		tracked out;
+		for (int i = 0; i < 3; ++i)
+			q.pop(out);
+		std::cout << "popped: " << out.value << " / size: " << q.size() << std::endl;
+		//index가 한 바퀴를 넘어가도록 다시 채운다.
+		std::vector<tracked> batch;
+		for (int i = 100; i < 110; ++i)
+			batch.push_back(tracked(i));
+		std::cout << "push_n 10: " << q.push_n(batch.begin(), batch.size()) << std::endl;
+		std::cout << "push_n when full: " << q.push_n(batch.begin(), 1) << std::endl;
+		tracked buf[4];
+		size_t got = q.pop_n(buf, 4);
+		std::cout << "pop_n 4:";
+		for (size_t i = 0; i < got; ++i)
+			std::cout << " " << buf[i].value;
+		std::cout << std::endl;
+		drain(q);
+		std::cout << "pop_n when empty: " << q.pop_n(buf, 4) << std::endl;
+		for (int i = 0; i < 3; ++i)
+			q.push(tracked(i + 200));
+		std::cout << "live before destruction: " << tracked::live - 5 << std::endl;
+	}
+	std::cout << "live after destruction: " << tracked::live << std::endl;
+	try {
+		Queue q(0);
+		std::cout << "capacity 0: no exception" << std::endl;
+	} catch (std::length_error&) {
+		std::cout << "capacity 0: length_error" << std::endl;
+	}
+}
+
+/**
+ * 여러 thread가 동시에 push/pop 한다.
+ * producer p는 p * per_producer 부터 per_producer개를 순서대로 넣는다.
+ * consumer는 producer마다 마지막으로 받은 값보다 큰 값만 받아야 하고 (FIFO), 모든 값은 정확히 한 번씩 나와야 한다. (합과 개수)
+ */
+template <typename Queue>
+struct stress
+{
+	Queue*	queue;
+	int*	start;
+	long	producer;
+	long	per_producer;
+	long	count;
+	size_t	batch;
+	size_t	producers;
+	long	received;
+	long	sum;
+	bool	ordered;
+};
+
+template <typename Queue>
+void* produce(void* arg) {
+	stress<Queue>* s = static_cast<stress<Queue>*>(arg);
+	while (!__atomic_load_n(s->start, __ATOMIC_ACQUIRE))
+		sched_yield();
+	long buf[16];
+	long base = s->producer * s->per_producer;
+	//push_n이 일부만 넣었다면 남은 값부터 다시 넣는다.
+	for (long i = 0; i < s->count; ) {
+		size_t n = 0;
+		for (; n < s->batch && i + static_cast<long>(n) < s->count; ++n)
+			buf[n] = base + i + n;
+		size_t pushed = (s->batch == 1) ? s->queue->push(buf[0]) : s->queue->push_n(buf, n);
+		if (pushed == 0)
+			sched_yield();
+		i += pushed;
+	}
+	return (NULL);
+}
+
+template <typename Queue>
+void* consume(void* arg) {
+	stress<Queue>* s = static_cast<stress<Queue>*>(arg);
+	while (!__atomic_load_n(s->start, __ATOMIC_ACQUIRE))
+		sched_yield();
+	std::vector<long> last(s->producers, -1);
+	long buf[16];
+	while (s->received < s->count) {
+		size_t want = s->batch;
+		if (static_cast<long>(want) > s->count - s->received)
+			want = s->count - s->received;
+		size_t got = (s->batch == 1) ? s->queue->pop(buf[0]) : s->queue->pop_n(buf, want);
+		if (got == 0)
+			sched_yield();
+		for (size_t i = 0; i < got; ++i) {
+			long producer = buf[i] / s->per_producer;
+			if (buf[i] <= last[producer])
+				s->ordered = false;
+			last[producer] = buf[i];
+			s->sum += buf[i];
+		}
+		s->received += got;
+	}
+	return (NULL);
+}
+
+//producers개의 producer가 per_producer개씩 넣고, consumers개의 consumer가 같은 수만큼 나눠서 꺼낸다.
+template <typename Queue>
+void concurrent(const char* name, size_t producers, size_t consumers, long per_producer, size_t batch) {
+	Queue q(64);
+	int start = 0;
+	long total = per_producer * static_cast<long>(producers);
+	std::vector< stress<Queue> > ws(producers + consumers);
+	std::vector<pthread_t> tids(producers + consumers);
+	for (size_t i = 0; i < ws.size(); ++i) {
+		stress<Queue> s = { &q, &start, static_cast<long>(i), per_producer, per_producer, batch, producers, 0, 0, true };
+		if (i >= producers)
+			s.count = total * (i - producers + 1) / consumers - total * (i - producers) / consumers;
+		ws[i] = s;
+	}
+	for (size_t i = 0; i < ws.size(); ++i)
+		pthread_create(&tids[i], NULL, i < producers ? produce<Queue> : consume<Queue>, &ws[i]);
+	__atomic_store_n(&start, 1, __ATOMIC_RELEASE);
+	long received = 0, sum = 0;
+	bool ordered = true;
+	for (size_t i = 0; i < ws.size(); ++i) {
+		pthread_join(tids[i], NULL);
+		if (i >= producers) {
+			received += ws[i].received;
+			sum += ws[i].sum;
+			ordered = ordered && ws[i].ordered;
+		}
+	}
+	std::cout << name << " (" << producers << " : " << consumers << ", batch " << batch << "): "
+		<< "count " << (received == total ? "OK" : "KO")
+		<< " / sum " << (sum == total * (total - 1) / 2 ? "OK" : "KO")
+		<< " / order " << (ordered ? "OK" : "KO")
+		<< " / empty " << (q.empty() ? "OK" : "KO") << std::endl;
+}
+
+int main() {
+	std::cout << "################ Test Lock-free Queue ################" << std::endl;
+	sequential<SPSC_QUEUE(tracked)>("spsc_queue");
+	sequential<MPMC_QUEUE(tracked)>("mpmc_queue");
+	exception_safety<SPSC_QUEUE(fragile)>("spsc_queue");
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== concurrent push | pop =====" << std::endl;
+	concurrent<SPSC_QUEUE(long)>("spsc_queue", 1, 1, 200000, 1);
+	concurrent<SPSC_QUEUE(long)>("spsc_queue", 1, 1, 200000, 16);
+	concurrent<MPMC_QUEUE(long)>("mpmc_queue", 1, 1, 200000, 1);
+	concurrent<MPMC_QUEUE(long)>("mpmc_queue", 4, 4, 50000, 1);
+	concurrent<MPMC_QUEUE(long)>("mpmc_queue", 4, 2, 50000, 16);
+	concurrent<MPMC_QUEUE(long)>("mpmc_queue", 2, 4, 50000, 7);
+}
@@ -1,4 +1,5 @@
 #include "map.hpp"
+#include "prefixed_string.hpp"
 #include <iostream>
 #include <string>
 #include <list>
@@ -13,6 +14,137 @@
 #define T3 TESTED_NAMESPACE::map<T1, T2>::value_type
 #define T_SIZE_TYPE typename TESTED_NAMESPACE::map<T1, T2>::size_type
 
+//정렬 방향을 멤버로 가지는 비교 함수 객체. 컨테이너는 생성자로 받은 객체를 그대로 사용해야 한다.
+struct dir_less
+{
+	bool	reverse;
+
+	dir_less(bool r = false) : reverse(r) {}
+	bool operator()(int x, int y) const { return (reverse ? y < x : x < y); }
+};
+
+//ft::map은 빈 비교 함수 객체와 allocator에 공간을 쓰지 않는다. (root, nil, size) std의 크기는 구현마다 다르므로 확인하지 않는다.
+namespace size_test
+{
+	namespace ft { static const bool compact = (sizeof(::ft::map<int, int>) == 3 * sizeof(void*)); }
+	namespace std { static const bool compact = true; }
+}
+typedef char map_size_check[size_test::TESTED_NAMESPACE::compact ? 1 : -1];
+
+//compact, reserve, shrink_to_fit, erase_if는 ft에만 있으므로 std에서는 아무것도 하지 않거나 erase로 같은 일을 한다. 결과가 같으면 요소와 순서가 그대로인 것이다.
+//batch 탐색과 삽입은 std에서 key마다 find/insert 한다.
+namespace ext_test
+{
+	namespace ft
+	{
+		template <typename Map> void compact(Map& mp) { mp.compact(); }
+		template <typename Map> void reserve(Map& mp, size_t n) { mp.reserve(n); }
+		template <typename Map> void shrink_to_fit(Map& mp) { mp.shrink_to_fit(); }
+		template <typename Map, typename Pred> size_t erase_if(Map& mp, Pred pred) { return (::ft::erase_if(mp, pred)); }
+		template <typename Map, typename Key, typename Iter>
+		void find_batch(Map& mp, const Key* keys, size_t n, Iter* out) { mp.find_batch(keys, n, out); }
+		template <typename Map, typename Key, typename Iter>
+		void find_sorted_batch(Map& mp, const Key* keys, size_t n, Iter* out) { mp.find_sorted_batch(keys, n, out); }
+		template <typename Map, typename InputIterator>
+		void insert_sorted_batch(Map& mp, InputIterator first, InputIterator last) { mp.insert_sorted_batch(first, last); }
+	}
+	namespace std
+	{
+		template <typename Map, typename Key, typename Iter>
+		void find_batch(Map& mp, const Key* keys, size_t n, Iter* out)
+		{
+			for (size_t i = 0; i < n; ++i)
+				out[i] = mp.find(keys[i]);
+		}
+		template <typename Map, typename Key, typename Iter>
+		void find_sorted_batch(Map& mp, const Key* keys, size_t n, Iter* out)
+		{
+			for (size_t i = 0; i < n; ++i)
+				out[i] = mp.find(keys[i]);
+		}
+		template <typename Map, typename InputIterator>
+		void insert_sorted_batch(Map& mp, InputIterator first, InputIterator last) { mp.insert(first, last); }
+		template <typename Map, typename Pred> size_t erase_if(Map& mp, Pred pred)
+		{
+			size_t n = mp.size();
+			for (typename Map::iterator it = mp.begin(); it != mp.end(); )
+			{
+				if (pred(*it))
+					mp.erase(it++);
+				else
+					++it;
+			}
+			return (n - mp.size());
+		}
+		template <typename Map> void compact(Map&) {}
+		template <typename Map> void reserve(Map&, size_t) {}
+		template <typename Map> void shrink_to_fit(Map&) {}
+	}
+}
+
+//ft::prefixed_string을 key로 한 map은 std::string을 key로 한 std::map과 같은 순서여야 한다.
+namespace prefix_test
+{
+	namespace ft { typedef ::ft::map< ::ft::prefixed_string, int> map_type; }
+	namespace std { typedef ::std::map< ::std::string, int> map_type; }
+}
+
+inline const std::string& key_str(const std::string& key) { return (key); }
+inline const std::string& key_str(const ft::prefixed_string& key) { return (key.str()); }
+
+//문자열 literal 전체를 ('\0' 포함) std::string으로 만든다.
+template <size_t N>
+std::string raw(const char (&str)[N]) { return (std::string(str, N - 1)); }
+
+//'\0'과 0x80 이상의 byte가 보이도록 출력 가능한 문자가 아니면 16진수로 쓴다.
+void printEscaped(const std::string& str) {
+	static const char hex[] = "0123456789abcdef";
+	std::cout << '"';
+	for (size_t i = 0; i < str.size(); ++i) {
+		unsigned char c = static_cast<unsigned char>(str[i]);
+		if (c >= 0x20 && c < 0x7f)
+			std::cout << str[i];
+		else
+			std::cout << "\\x" << hex[c >> 4] << hex[c & 15];
+	}
+	std::cout << '"';
+}
+
+//erase_if에 넘기는 조건. value_type(pair)의 key로 판단한다.
+template <int N>
+struct key_multiple
+{
+	template <typename Pair> bool operator()(const Pair& p) const { return (p.first % N == 0); }
+};
+
+template <int N>
+struct key_not_multiple
+{
+	template <typename Pair> bool operator()(const Pair& p) const { return (p.first % N != 0); }
+};
+
+template <typename Map>
+void printKeys(Map const &mp) {
+	std::cout << "size: " << mp.size() << " keys:";
+	for (typename Map::const_iterator it = mp.begin(); it != mp.end(); ++it)
+		std::cout << " " << it->first;
+	std::cout << std::endl;
+}
+
+//batch 탐색 결과를 key마다 출력한다.
+template <typename Map, typename Iter>
+void printBatch(Map &mp, const T1* keys, size_t n, Iter* out) {
+	std::cout << "batch:";
+	for (size_t i = 0; i < n; ++i) {
+		std::cout << " " << keys[i] << "->";
+		if (out[i] == mp.end())
+			std::cout << "end";
+		else
+			std::cout << out[i]->second;
+	}
+	std::cout << std::endl;
+}
+
 template <typename T>
 void printContainers(T const &mp, bool print_content = true) {
 	const T_SIZE_TYPE size = mp.size();
@@ -120,6 +252,40 @@ int main() {
 	std::cout << "upper_bound: " << mp_ot.upper_bound(5)->first << std::endl;
 	std::cout << "equal_range: " << mp_ot.equal_range(5).first->first << ", " << mp_ot.equal_range(5).second->first << std::endl;
 
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== rbegin | rend | reverse_iterator =====" << std::endl;
+	for (TESTED_NAMESPACE::map<T1, T2>::reverse_iterator rit = mp_range.rbegin(); rit != mp_range.rend(); ++rit)
+		std::cout << "- key: " << rit->first << "\t& value: " << (*rit).second << std::endl;
+	TESTED_NAMESPACE::map<T1, T2>::const_reverse_iterator crit = mp_range.rbegin();
+	std::cout << "rbegin.base() == end: " << ((mp_range.rbegin().base() == mp_range.end()) ? "OK" : "KO") << std::endl;
+	std::cout << "rend.base() == begin: " << ((mp_range.rend().base() == mp_range.begin()) ? "OK" : "KO") << std::endl;
+	std::cout << "++rbegin: " << (++crit)->first << std::endl;
+	std::cout << "--(++rbegin): " << (--crit)->first << std::endl;
+	TESTED_NAMESPACE::map<T1, T2>::reverse_iterator rlast = mp_range.rend();
+	std::cout << "--rend: " << (--rlast)->first << std::endl;
+	TESTED_NAMESPACE::map<T1, T2>::reverse_iterator rfind(mp_range.find(5));
+	std::cout << "reverse_iterator(find(5)): " << rfind->first << std::endl;
+	std::cout << "empty rbegin == rend: " << ((mp.rbegin() == mp.rend()) ? "OK" : "KO") << std::endl;
+	TESTED_NAMESPACE::map<T1, T2> emptied(mp_range);
+	emptied.clear();
+	std::cout << "cleared rend.base() == begin: " << ((emptied.rend().base() == emptied.begin()) ? "OK" : "KO") << std::endl;
+	emptied[3] = "three";
+	emptied.erase(3);
+	std::cout << "erased rend.base() == end: " << ((emptied.rend().base() == emptied.end()) ? "OK" : "KO") << std::endl;
+	emptied[4] = "four";
+	TESTED_NAMESPACE::map<T1, T2>::reverse_iterator rone = emptied.rend();
+	std::cout << "--rend after refill: " << (--rone)->first << std::endl;
+	//reverse_iterator와 const_reverse_iterator는 어느 쪽을 왼쪽에 두어도 비교할 수 있어야 한다.
+	TESTED_NAMESPACE::map<T1, T2>::reverse_iterator rmix = mp_range.rbegin();
+	TESTED_NAMESPACE::map<T1, T2>::const_reverse_iterator cmix = mp_range.rbegin();
+	const TESTED_NAMESPACE::map<T1, T2>& mp_const = mp_range;
+	std::cout << "rit == crit: " << ((rmix == cmix) ? "OK" : "KO") << std::endl;
+	std::cout << "crit == rit: " << ((cmix == rmix) ? "OK" : "KO") << std::endl;
+	++cmix;
+	std::cout << "rit != ++crit: " << ((rmix != cmix) ? "OK" : "KO") << std::endl;
+	std::cout << "rit != const rend: " << ((rmix != mp_const.rend()) ? "OK" : "KO") << std::endl;
+	std::cout << "const rbegin == rit: " << ((mp_const.rbegin() == rmix) ? "OK" : "KO") << std::endl;
+
 	std::cout << "\n################################################" << std::endl;
 	std::cout << "===== relational operators =====" << std::endl;
 	lst_size = 7;
@@ -148,4 +314,203 @@ int main() {
 	std::cout << "operator<=: " << ((lhs <= rhs) ? "OK" : "KO") << std::endl;
 	std::cout << "operator>:  " << ((lhs > rhs) ? "OK" : "KO") << std::endl;
 	std::cout << "operator>=: " << ((lhs >= rhs) ? "OK" : "KO") << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== string key (find | insert | count) =====" << std::endl;
+	const char* paths[] = { "/api/v1/users", "/api/v1/user", "/api/v1/users/42", "/api/v2", "/", "", "/api/v1/users" };
+	TESTED_NAMESPACE::map<std::string, int> str_mp;
+	for (unsigned int i = 0; i < sizeof(paths) / sizeof(paths[0]); ++i)
+		std::cout << "insert \"" << paths[i] << "\": " << (str_mp.insert(TESTED_NAMESPACE::make_pair(std::string(paths[i]), i)).second ? "inserted" : "exists") << std::endl;
+	for (TESTED_NAMESPACE::map<std::string, int>::iterator it = str_mp.begin(); it != str_mp.end(); ++it)
+		std::cout << "- key: \"" << it->first << "\"\t& value: " << it->second << std::endl;
+	std::cout << "find /api/v1/users/42: " << str_mp.find("/api/v1/users/42")->second << std::endl;
+	std::cout << "find /api/v1/users/4 == end: " << ((str_mp.find("/api/v1/users/4") == str_mp.end()) ? "OK" : "KO") << std::endl;
+	std::cout << "count \"\": " << str_mp.count("") << std::endl;
+	std::cout << "count /api: " << str_mp.count("/api") << std::endl;
+	std::cout << "erase /api/v1/user: " << str_mp.erase("/api/v1/user") << std::endl;
+	std::cout << "size: " << str_mp.size() << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== stateful comparator =====" << std::endl;
+	TESTED_NAMESPACE::map<T1, T2, dir_less> desc(dir_less(true));
+	for (int i = 0; i < 6; ++i)
+		desc.insert(TESTED_NAMESPACE::make_pair(i * 3 % 7, std::string(i + 1, 'a' + i)));
+	printKeys(desc);
+	std::cout << "key_comp().reverse: " << desc.key_comp().reverse << std::endl;
+	std::cout << "value_comp()(1, 2): " << desc.value_comp()(TESTED_NAMESPACE::make_pair(1, std::string()), TESTED_NAMESPACE::make_pair(2, std::string())) << std::endl;
+	std::cout << "lower_bound(4): " << desc.lower_bound(4)->first << std::endl;
+	std::cout << "upper_bound(4): " << desc.upper_bound(4)->first << std::endl;
+	std::cout << "find(5): " << desc.find(5)->second << std::endl;
+
+	TESTED_NAMESPACE::map<T1, T2, dir_less> desc_copy(desc);
+	desc_copy[10] = "copy";
+	printKeys(desc_copy);
+
+	TESTED_NAMESPACE::map<T1, T2, dir_less> asc;
+	asc[7] = "asc";
+	asc[1] = "asc";
+	asc = desc;
+	std::cout << "after assign key_comp().reverse: " << asc.key_comp().reverse << std::endl;
+	asc[-1] = "assign";
+	printKeys(asc);
+
+	TESTED_NAMESPACE::map<T1, T2, dir_less> asc_range(desc.begin(), desc.end(), dir_less(false));
+	printKeys(asc_range);
+	asc_range.swap(desc_copy);
+	std::cout << "after swap key_comp().reverse: " << asc_range.key_comp().reverse << " " << desc_copy.key_comp().reverse << std::endl;
+	asc_range[8] = "swap";
+	desc_copy[8] = "swap";
+	printKeys(asc_range);
+	printKeys(desc_copy);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== compact =====" << std::endl;
+	TESTED_NAMESPACE::map<T1, T2> frag;
+	for (int i = 0; i < 40; ++i)
+		frag[i * 7 % 41] = std::string(i % 5 + 1, 'a' + i % 26);
+	for (int i = 0; i < 40; i += 3)
+		frag.erase(i);
+	ext_test::TESTED_NAMESPACE::compact(frag);
+	printContainers(frag);
+	for (TESTED_NAMESPACE::map<T1, T2>::reverse_iterator rit = frag.rbegin(); rit != frag.rend(); ++rit)
+		std::cout << rit->first << " ";
+	std::cout << std::endl;
+	std::cout << "find 20: " << frag.find(20)->second << std::endl;
+	frag.erase(20);
+	frag[100] = "after";
+	frag[-5] = "after";
+	ext_test::TESTED_NAMESPACE::compact(frag);
+	TESTED_NAMESPACE::map<T1, T2> frag_copy(frag);
+	frag.clear();
+	ext_test::TESTED_NAMESPACE::compact(frag);
+	printContainers(frag);
+	printContainers(frag_copy);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== reserve | shrink_to_fit =====" << std::endl;
+	TESTED_NAMESPACE::map<T1, T2> pre;
+	ext_test::TESTED_NAMESPACE::reserve(pre, 32);
+	for (int i = 0; i < 20; ++i)
+		pre[i * 11 % 23] = std::string(i % 3 + 1, 'k');
+	TESTED_NAMESPACE::map<T1, T2>::iterator pre_it = pre.find(11);
+	for (int i = 0; i < 23; i += 2)
+		pre.erase(i);
+	ext_test::TESTED_NAMESPACE::reserve(pre, 64);
+	ext_test::TESTED_NAMESPACE::shrink_to_fit(pre);
+	std::cout << "iterator after shrink_to_fit: " << pre_it->first << " " << pre_it->second << std::endl;
+	for (int i = 30; i < 60; ++i)
+		pre[i] = "new";
+	printContainers(pre);
+	pre.clear();
+	ext_test::TESTED_NAMESPACE::shrink_to_fit(pre);
+	pre[1] = "one";
+	printContainers(pre);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== erase_if =====" << std::endl;
+	TESTED_NAMESPACE::map<T1, T2> cond;
+	for (int i = 0; i < 60; ++i)
+		cond[i * 13 % 61] = std::string(i % 4 + 1, 'a' + i % 26);
+	TESTED_NAMESPACE::map<T1, T2>::iterator cond_it = cond.find(26);
+	//few: 남는 노드를 하나씩 지운다. most: 남는 노드로 tree를 다시 만든다.
+	std::cout << "removed (few): " << ext_test::TESTED_NAMESPACE::erase_if(cond, key_multiple<7>()) << std::endl;
+	std::cout << "removed (most): " << ext_test::TESTED_NAMESPACE::erase_if(cond, key_not_multiple<2>()) << std::endl;
+	std::cout << "iterator after erase_if: " << cond_it->first << " " << cond_it->second << std::endl;
+	printContainers(cond);
+	for (TESTED_NAMESPACE::map<T1, T2>::reverse_iterator rit = cond.rbegin(); rit != cond.rend(); ++rit)
+		std::cout << rit->first << " ";
+	std::cout << std::endl;
+	for (int i = 0; i < 60; i += 5)
+		cond[i] = "again";
+	cond.erase(30);
+	printKeys(cond);
+	std::cout << "removed (all): " << ext_test::TESTED_NAMESPACE::erase_if(cond, key_multiple<1>()) << std::endl;
+	cond[3] = "three";
+	printContainers(cond);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== prefixed_string key =====" << std::endl;
+	//8 byte보다 짧은 key, 앞 8 byte가 같은 key, 중간과 끝의 '\0', 0x80 이상의 byte를 섞는다.
+	const std::string raw_keys[] = {
+		raw(""), raw("a"), raw("ab"), raw("ab\0"), raw("abc\0def"), raw("abc\0defg0"), raw("abc\0defg"), raw("abcdefg"),
+		raw("abcdefg\xff"), raw("abcdefgh"), raw("abcdefgh\0"), raw("abcdefghi"), raw("abcdefgha"), raw("abcdefgh\x80"),
+		raw("abcdefgh\x7f"), raw("abcdefgi"), raw("\x80"), raw("\xff\xfe"), raw("\x7f"), raw("zz"), raw("abcdefgh"),
+		raw("ab\0"), raw("\xff\xfe\0\0\0\0\0\0\x01")
+	};
+	const size_t raw_count = sizeof(raw_keys) / sizeof(raw_keys[0]);
+	prefix_test::TESTED_NAMESPACE::map_type pmap;
+	for (size_t i = 0; i < raw_count; ++i)
+		pmap.insert(prefix_test::TESTED_NAMESPACE::map_type::value_type(raw_keys[i], static_cast<int>(i)));
+	std::cout << "size: " << pmap.size() << std::endl;
+	for (prefix_test::TESTED_NAMESPACE::map_type::iterator it = pmap.begin(); it != pmap.end(); ++it) {
+		std::cout << "- ";
+		printEscaped(key_str(it->first));
+		std::cout << "\t& value: " << it->second << std::endl;
+	}
+	const std::string probe_keys[] = { raw("abcdefgh"), raw("abcdefg\0"), raw("abcdefgh\x01"), raw("ab"), raw("\xff"), raw("abc\0de") };
+	for (size_t i = 0; i < 6; ++i) {
+		const std::string& probe = probe_keys[i];
+		prefix_test::TESTED_NAMESPACE::map_type::iterator lb = pmap.lower_bound(probe);
+		printEscaped(probe);
+		std::cout << ": count " << pmap.count(probe) << " / lower_bound ";
+		if (lb == pmap.end())
+			std::cout << "end";
+		else
+			printEscaped(key_str(lb->first));
+		std::cout << std::endl;
+	}
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== find_batch | find_sorted_batch | insert_sorted_batch =====" << std::endl;
+	TESTED_NAMESPACE::map<T1, T2> fing;
+	for (int i = 0; i <= 60; i += 3)
+		fing[i] = std::string(1, 'a' + i / 3);
+	//16개씩 묶어서 찾으므로 묶음보다 짧은 경우, 정확히 한 묶음, 묶음의 배수가 아닌 경우를 확인한다.
+	T1 batch_keys[37];
+	for (int i = 0; i < 37; ++i)
+		batch_keys[i] = (i * 7) % 67 - 3;
+	TESTED_NAMESPACE::map<T1, T2>::iterator batch_out[37];
+	const size_t batch_sizes[] = { 0, 5, 16, 37 };
+	for (size_t i = 0; i < 4; ++i) {
+		ext_test::TESTED_NAMESPACE::find_batch(fing, batch_keys, batch_sizes[i], batch_out);
+		printBatch(fing, batch_keys, batch_sizes[i], batch_out);
+	}
+	const TESTED_NAMESPACE::map<T1, T2>& batch_const = fing;
+	TESTED_NAMESPACE::map<T1, T2>::const_iterator batch_cout[37];
+	ext_test::TESTED_NAMESPACE::find_batch(batch_const, batch_keys + 3, 34, batch_cout);
+	printBatch(batch_const, batch_keys + 3, 34, batch_cout);
+	const T1 sorted_keys[] = { -5, 0, 0, 1, 3, 3, 4, 20, 21, 39, 39, 60, 100 };
+	TESTED_NAMESPACE::map<T1, T2>::iterator fing_out[13];
+	ext_test::TESTED_NAMESPACE::find_sorted_batch(fing, sorted_keys, 13, fing_out);
+	printBatch(fing, sorted_keys, 13, fing_out);
+	//순서가 거꾸로 된 key가 섞여 있어도 find와 같은 결과여야 한다.
+	const T1 unsorted_keys[] = { 30, 3, 27, -1, 12, 12, 0, 100, 6, 61, 59, 57 };
+	ext_test::TESTED_NAMESPACE::find_sorted_batch(fing, unsorted_keys, 12, fing_out);
+	printBatch(fing, unsorted_keys, 12, fing_out);
+	const TESTED_NAMESPACE::map<T1, T2>& fing_const = fing;
+	TESTED_NAMESPACE::map<T1, T2>::const_iterator fing_cout[13];
+	ext_test::TESTED_NAMESPACE::find_sorted_batch(fing_const, sorted_keys + 2, 11, fing_cout);
+	printBatch(fing_const, sorted_keys + 2, 11, fing_cout);
+	ext_test::TESTED_NAMESPACE::find_sorted_batch(fing_const, sorted_keys, 0, fing_cout);
+
+	std::list<T3> sorted_vals;
+	const T1 insert_keys[] = { -2, 1, 1, 2, 9, 10, 10, 58, 61, 61, 70 };
+	for (int i = 0; i < 11; ++i)
+		sorted_vals.push_back(T3(insert_keys[i], "s" + std::string(1, 'a' + i)));
+	ext_test::TESTED_NAMESPACE::insert_sorted_batch(fing, sorted_vals.begin(), sorted_vals.end());
+	printContainers(fing);
+	std::list<T3> unsorted_vals;
+	const T1 unsorted_insert[] = { 50, 5, 44, -3, 7, 7, 100, 4, 62, -2, 8, 65, 64 };
+	for (int i = 0; i < 13; ++i)
+		unsorted_vals.push_back(T3(unsorted_insert[i], "u" + std::string(1, 'a' + i)));
+	ext_test::TESTED_NAMESPACE::insert_sorted_batch(fing, unsorted_vals.begin(), unsorted_vals.end());
+	printContainers(fing);
+	//삽입 후에도 모든 key를 find로 찾을 수 있어야 한다. (tree의 순서가 깨지면 iteration은 맞아도 find가 실패한다.)
+	size_t found = 0;
+	for (TESTED_NAMESPACE::map<T1, T2>::iterator it = fing.begin(); it != fing.end(); ++it)
+		found += (fing.find(it->first) == it);
+	std::cout << "find after insert_sorted_batch: " << found << " / " << fing.size() << std::endl;
+	TESTED_NAMESPACE::map<T1, T2> fing_empty;
+	ext_test::TESTED_NAMESPACE::insert_sorted_batch(fing_empty, unsorted_vals.begin(), unsorted_vals.end());
+	printKeys(fing_empty);
 }
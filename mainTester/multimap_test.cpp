@@ -0,0 +1,120 @@
+#include "multimap.hpp"
+#include <iostream>
+#include <string>
+#include <list>
+#include <map>
+
+#ifndef TESTED_NAMESPACE
+#define TESTED_NAMESPACE ft
+#endif
+
+#define T1 int
+#define T2 std::string
+#define T3 TESTED_NAMESPACE::multimap<T1, T2>::value_type
+#define T_SIZE_TYPE typename TESTED_NAMESPACE::multimap<T1, T2>::size_type
+
+template <typename T>
+void printContainers(T const &mp, bool print_content = true) {
+	const T_SIZE_TYPE size = mp.size();
+
+	std::cout << "size: " << size << std::endl;
+	if (print_content) {
+		typename TESTED_NAMESPACE::multimap<T1, T2>::const_iterator it = mp.begin();
+		typename TESTED_NAMESPACE::multimap<T1, T2>::const_iterator ite = mp.end();
+		std::cout << "Content is:" << std::endl;
+		for (; it != ite; ++it)
+			std::cout << "- key: " << (*it).first << "\t& value: " << (*it).second << std::endl;
+	}
+	std::cout << "------------------------" << std::endl;
+}
+
+int main() {
+	std::cout << "################ Test Multimap ################" << std::endl;
+	std::cout << "===== default | range | copy constructor =====" << std::endl;
+	std::cout << "default constructor: " << std::endl;
+	TESTED_NAMESPACE::multimap<T1, T2> mp;
+	printContainers(mp);
+
+	std::cout << "range constructor (duplicated keys): " << std::endl;
+	std::list<T3> lst;
+	unsigned int lst_size = 12;
+
+	for (unsigned int i = 0; i < lst_size; ++i)
+		lst.push_back(T3(i % 4, std::string(i + 1, i + 65)));
+	TESTED_NAMESPACE::multimap<T1, T2> mp_range(lst.begin(), lst.end());
+	printContainers(mp_range);
+
+	std::cout << "copy constructor: " << std::endl;
+	TESTED_NAMESPACE::multimap<T1, T2> mp_copy(mp_range);
+	printContainers(mp_copy);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== insert | insert with hint =====" << std::endl;
+	for (int i = 0; i < 6; ++i)
+		mp.insert(T3(5 - (i % 3), std::string(1, i + 97)));
+	printContainers(mp);
+
+	std::cout << "hint begin: " << mp.insert(mp.begin(), T3(3, "begin"))->second << std::endl;
+	std::cout << "hint end: " << mp.insert(mp.end(), T3(5, "end"))->second << std::endl;
+	std::cout << "hint on equal key: " << mp.insert(mp.find(4), T3(4, "hint"))->second << std::endl;
+	std::cout << "wrong hint: " << mp.insert(mp.begin(), T3(9, "wrong"))->second << std::endl;
+	printContainers(mp);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== count | find | equal_range =====" << std::endl;
+	for (int k = -1; k < 6; ++k)
+		std::cout << "count " << k << ": " << mp_range.count(k) << std::endl;
+	std::cout << "find 2: " << mp_range.find(2)->second << std::endl;
+	std::cout << "find 7 == end: " << ((mp_range.find(7) == mp_range.end()) ? "OK" : "KO") << std::endl;
+
+	TESTED_NAMESPACE::pair<TESTED_NAMESPACE::multimap<T1, T2>::iterator, TESTED_NAMESPACE::multimap<T1, T2>::iterator> range = mp_range.equal_range(1);
+	std::cout << "equal_range 1:";
+	for (; range.first != range.second; ++range.first)
+		std::cout << " " << range.first->second;
+	std::cout << std::endl;
+	std::cout << "lower_bound 2: " << mp_range.lower_bound(2)->second << std::endl;
+	std::cout << "upper_bound 2: " << mp_range.upper_bound(2)->second << std::endl;
+	std::cout << "upper_bound 3 == end: " << ((mp_range.upper_bound(3) == mp_range.end()) ? "OK" : "KO") << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== erase =====" << std::endl;
+	std::cout << "erase key 1: " << mp_range.erase(1) << std::endl;
+	std::cout << "erase key 7: " << mp_range.erase(7) << std::endl;
+	printContainers(mp_range);
+
+	mp_range.erase(mp_range.find(2));
+	printContainers(mp_range);
+
+	mp_range.erase(++mp_range.begin(), --mp_range.end());
+	printContainers(mp_range);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== swap | clear =====" << std::endl;
+	swap(mp_range, mp_copy);
+	printContainers(mp_range);
+	printContainers(mp_copy);
+	mp_copy.clear();
+	printContainers(mp_copy);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== relational operators =====" << std::endl;
+	TESTED_NAMESPACE::multimap<T1, T2> lhs(mp_range);
+	TESTED_NAMESPACE::multimap<T1, T2> rhs(mp_range);
+
+	std::cout << "same multimap..." << std::endl;
+	std::cout << "operator==: " << ((lhs == rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator!=: " << ((lhs != rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator<:  " << ((lhs < rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator<=: " << ((lhs <= rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator>:  " << ((lhs > rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator>=: " << ((lhs >= rhs) ? "OK" : "KO") << std::endl;
+
+	lhs.insert(T3(2, "A"));
+	std::cout << "different multimap..." << std::endl;
+	std::cout << "operator==: " << ((lhs == rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator!=: " << ((lhs != rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator<:  " << ((lhs < rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator<=: " << ((lhs <= rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator>:  " << ((lhs > rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator>=: " << ((lhs >= rhs) ? "OK" : "KO") << std::endl;
+}
@@ -0,0 +1,87 @@
+#include "multiset.hpp"
+#include <iostream>
+#include <string>
+#include <list>
+#include <set>
+
+#ifndef TESTED_NAMESPACE
+#define TESTED_NAMESPACE ft
+#endif
+
+#define T1 int
+#define T_SIZE_TYPE typename TESTED_NAMESPACE::multiset<T1>::size_type
+
+template <typename T>
+void printContainers(T const &st, bool print_content = true) {
+	const T_SIZE_TYPE size = st.size();
+
+	std::cout << "size: " << size << std::endl;
+	if (print_content) {
+		typename TESTED_NAMESPACE::multiset<T1>::const_iterator it = st.begin();
+		typename TESTED_NAMESPACE::multiset<T1>::const_iterator ite = st.end();
+		std::cout << "Content is:" << std::endl;
+		for (; it != ite; ++it)
+			std::cout << "- key: " << *it << std::endl;
+	}
+	std::cout << "------------------------" << std::endl;
+}
+
+int main() {
+	std::cout << "################ Test Multiset ################" << std::endl;
+	std::cout << "===== default | range | copy constructor =====" << std::endl;
+	TESTED_NAMESPACE::multiset<T1> st;
+	printContainers(st);
+
+	std::list<T1> lst;
+	const T1 seed[] = { 5, 1, 9, 3, 7, 3, 8, 1, 6, 3, 0, 9 };
+	for (unsigned int i = 0; i < sizeof(seed) / sizeof(seed[0]); ++i)
+		lst.push_back(seed[i]);
+	TESTED_NAMESPACE::multiset<T1> st_range(lst.begin(), lst.end());
+	printContainers(st_range);
+
+	TESTED_NAMESPACE::multiset<T1> st_copy(st_range);
+	printContainers(st_copy);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== insert | count | equal_range =====" << std::endl;
+	for (int i = 0; i < 10; ++i)
+		st.insert(i % 3);
+	st.insert(st.end(), 2);
+	st.insert(st.begin(), 0);
+	st.insert(st.find(1), 1);
+	printContainers(st);
+
+	for (int k = -1; k < 4; ++k)
+		std::cout << "count " << k << ": " << st.count(k) << std::endl;
+	TESTED_NAMESPACE::pair<TESTED_NAMESPACE::multiset<T1>::iterator, TESTED_NAMESPACE::multiset<T1>::iterator> range = st_range.equal_range(3);
+	int n = 0;
+	for (; range.first != range.second; ++range.first)
+		++n;
+	std::cout << "equal_range 3: " << n << std::endl;
+	std::cout << "lower_bound 4: " << *st_range.lower_bound(4) << std::endl;
+	std::cout << "upper_bound 3: " << *st_range.upper_bound(3) << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== erase =====" << std::endl;
+	std::cout << "erase 3: " << st_range.erase(3) << std::endl;
+	std::cout << "erase 4: " << st_range.erase(4) << std::endl;
+	st_range.erase(st_range.find(9));
+	printContainers(st_range);
+	st_range.erase(st_range.begin(), st_range.find(7));
+	printContainers(st_range);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== swap | relational operators =====" << std::endl;
+	st_copy.swap(st_range);
+	printContainers(st_copy);
+	printContainers(st_range);
+
+	TESTED_NAMESPACE::multiset<T1> lhs(st_range);
+	TESTED_NAMESPACE::multiset<T1> rhs(st_range);
+	std::cout << "operator==: " << ((lhs == rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator<:  " << ((lhs < rhs) ? "OK" : "KO") << std::endl;
+	rhs.insert(4);
+	std::cout << "operator==: " << ((lhs == rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator<:  " << ((lhs < rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator>=: " << ((lhs >= rhs) ? "OK" : "KO") << std::endl;
+}
@@ -0,0 +1,260 @@
+#include "priority_queue.hpp"
+#include <iostream>
+#include <string>
+#include <queue>
+#include <vector>
+#include <list>
+#include <functional>
+#include <map>
+#include <algorithm>
+#include <stdexcept>
+
+#ifndef TESTED_NAMESPACE
+#define TESTED_NAMESPACE ft
+#endif
+
+//ft에만 있는 기능(Arity, push_range, swap, indexed_priority_queue)은 std에서 같은 결과를 내는 방법으로 대신한다.
+namespace ext_test
+{
+	namespace ft
+	{
+		template <typename T, size_t Arity> struct heap_of { typedef ::ft::priority_queue<T, ::ft::vector<T>, ::ft::less<T>, Arity> type; };
+		template <typename Queue, typename InputIterator> void push_range(Queue& pq, InputIterator first, InputIterator last) { pq.push_range(first, last); }
+		template <typename Queue> void swap(Queue& x, Queue& y) { ::ft::swap(x, y); }
+		template <typename T> struct indexed_of { typedef ::ft::indexed_priority_queue<T, ::ft::less<T>, 3> type; };
+	}
+	namespace std
+	{
+		template <typename T, size_t Arity> struct heap_of { typedef ::std::priority_queue<T> type; };
+		template <typename Queue, typename InputIterator> void push_range(Queue& pq, InputIterator first, InputIterator last)
+		{
+			for (; first != last; ++first)
+				pq.push(*first);
+		}
+		//C++98의 std::priority_queue에는 swap 멤버가 없으므로 복사로 맞바꾼다.
+		template <typename Queue> void swap(Queue& x, Queue& y) { ::std::swap(x, y); }
+
+		//id -> key를 map에 두고 top을 찾을 때마다 전부 비교한다.
+		template <typename T>
+		class naive_indexed_queue
+		{
+			private:
+				typedef ::std::map<size_t, T>	map_type;
+				map_type	_keys;
+
+				typename map_type::const_iterator best() const
+				{
+					typename map_type::const_iterator top = _keys.begin();
+					for (typename map_type::const_iterator it = _keys.begin(); it != _keys.end(); ++it)
+						if (top->second < it->second)
+							top = it;
+					return (top);
+				}
+
+			public:
+				explicit naive_indexed_queue(size_t = 0) {}
+				bool empty() const { return (_keys.empty()); }
+				size_t size() const { return (_keys.size()); }
+				bool contains(size_t id) const { return (_keys.count(id) != 0); }
+				const T& key(size_t id) const
+				{
+					if (!contains(id))
+						throw(::std::out_of_range("Error: naive_indexed_queue::key"));
+					return (_keys.find(id)->second);
+				}
+				const T& top() const { return (best()->second); }
+				size_t top_id() const { return (best()->first); }
+				void push(size_t id, const T& val)
+				{
+					if (contains(id))
+						throw(::std::invalid_argument("Error: naive_indexed_queue::push"));
+					_keys[id] = val;
+				}
+				void pop() { _keys.erase(best()->first); }
+				void decrease_key(size_t id, const T& val)
+				{
+					if (!contains(id) || val < _keys[id])
+						throw(::std::invalid_argument("Error: naive_indexed_queue::decrease_key"));
+					_keys[id] = val;
+				}
+				void update(size_t id, const T& val)
+				{
+					if (!contains(id))
+						throw(::std::invalid_argument("Error: naive_indexed_queue::update"));
+					_keys[id] = val;
+				}
+				void erase(size_t id) { _keys.erase(id); }
+				void clear() { _keys.clear(); }
+		};
+		template <typename T> struct indexed_of { typedef naive_indexed_queue<T> type; };
+	}
+}
+
+#define TYPE int
+#define T_SIZE_TYPE typename TESTED_NAMESPACE::priority_queue<T>::size_type
+
+template <typename T>
+void printContainers(TESTED_NAMESPACE::priority_queue<T> pq, bool print_content = true) {
+	const T_SIZE_TYPE size = pq.size();
+
+	std::cout << "size: " << size << std::endl;
+	if (print_content) {
+		std::cout << "Content was:" << std::endl;
+		while (pq.size() != 0) {
+			std::cout << "- " << pq.top() << std::endl;
+			pq.pop();
+		}
+	}
+	std::cout << "------------------------" << std::endl;
+}
+
+template <typename Queue>
+void printHeap(Queue pq, bool print_content = true) {
+	std::cout << "size: " << pq.size() << std::endl;
+	if (print_content) {
+		std::cout << "Content was:" << std::endl;
+		while (!pq.empty()) {
+			std::cout << "- " << pq.top() << std::endl;
+			pq.pop();
+		}
+	}
+	std::cout << "------------------------" << std::endl;
+}
+
+template <typename T, typename C, typename Comp>
+void printContainers(TESTED_NAMESPACE::priority_queue<T, C, Comp> pq, bool print_content = true) {
+	printHeap(pq, print_content);
+}
+
+//indexed priority queue를 비우면서 id와 key를 출력한다.
+template <typename Queue>
+void printIndexed(Queue ipq) {
+	std::cout << "size: " << ipq.size() << std::endl;
+	while (!ipq.empty()) {
+		std::cout << "- " << ipq.top_id() << ": " << ipq.top() << std::endl;
+		ipq.pop();
+	}
+	std::cout << "------------------------" << std::endl;
+}
+
+int main() {
+	std::cout << "################ Test Priority Queue ################" << std::endl;
+	std::cout << "===== push | copy =====" << std::endl;
+	TESTED_NAMESPACE::priority_queue<TYPE> pq;
+	const TYPE seed[] = { 5, 1, 9, 3, 7, 3, 8, 2, 6, 4, 0, 9 };
+	const unsigned int seed_size = sizeof(seed) / sizeof(seed[0]);
+
+	for (unsigned int i = 0; i < seed_size; ++i)
+		pq.push(seed[i]);
+	std::cout << "original priority_queue: " << std::endl;
+	printContainers(pq);
+
+	TESTED_NAMESPACE::priority_queue<TYPE> pq_copy(pq);
+	std::cout << "copied priority_queue: " << std::endl;
+	printContainers(pq_copy);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== range constructor =====" << std::endl;
+	std::list<TYPE> lst;
+	for (unsigned int i = 0; i < 20; ++i)
+		lst.push_back((i * 7) % 13);
+	TESTED_NAMESPACE::priority_queue<TYPE> pq_range(lst.begin(), lst.end());
+	printContainers(pq_range);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== top | pop | empty =====" << std::endl;
+	while (!pq_copy.empty()) {
+		std::cout << "top: " << pq_copy.top() << " / size: " << pq_copy.size() << std::endl;
+		pq_copy.pop();
+	}
+	std::cout << "Is empty: " << (pq_copy.empty() ? "OK" : "KO") << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== greater (min-heap) =====" << std::endl;
+	TESTED_NAMESPACE::priority_queue<TYPE, TESTED_NAMESPACE::vector<TYPE>, TESTED_NAMESPACE::greater<TYPE> > pq_min(seed, seed + seed_size);
+	printContainers(pq_min);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== string | interleaved push / pop =====" << std::endl;
+	TESTED_NAMESPACE::priority_queue<std::string> pq_str;
+	for (unsigned int i = 0; i < 10; ++i) {
+		pq_str.push(std::string(i % 4 + 1, 'a' + (i * 3) % 7));
+		if (i % 3 == 2) {
+			std::cout << "pop: " << pq_str.top() << std::endl;
+			pq_str.pop();
+		}
+	}
+	printContainers(pq_str);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== swap =====" << std::endl;
+	TESTED_NAMESPACE::priority_queue<TYPE> pq_swap(seed, seed + 4);
+	ext_test::TESTED_NAMESPACE::swap(pq, pq_swap);
+	printContainers(pq);
+	printContainers(pq_swap);
+	pq_swap.push(100);
+	std::cout << "top after push: " << pq_swap.top() << " / " << pq.top() << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== arity | push_range =====" << std::endl;
+	//추가하는 개수가 기존 크기보다 작으면 하나씩 sift up, 크면 다시 heapify 한다.
+	ext_test::TESTED_NAMESPACE::heap_of<TYPE, 3>::type pq_3;
+	ext_test::TESTED_NAMESPACE::push_range(pq_3, seed, seed + seed_size);
+	ext_test::TESTED_NAMESPACE::push_range(pq_3, seed, seed + 3);
+	printHeap(pq_3);
+	ext_test::TESTED_NAMESPACE::heap_of<TYPE, 4>::type pq_4;
+	ext_test::TESTED_NAMESPACE::push_range(pq_4, lst.begin(), lst.end());
+	for (unsigned int i = 0; i < 5; ++i)
+		pq_4.pop();
+	ext_test::TESTED_NAMESPACE::push_range(pq_4, lst.begin(), lst.end());
+	printHeap(pq_4);
+	ext_test::TESTED_NAMESPACE::heap_of<std::string, 8>::type pq_8;
+	for (unsigned int i = 0; i < 40; ++i) {
+		pq_8.push(std::string(i % 5 + 1, 'a' + (i * 11) % 26));
+		if (i % 4 == 3)
+			pq_8.pop();
+	}
+	printHeap(pq_8);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== indexed priority queue =====" << std::endl;
+	ext_test::TESTED_NAMESPACE::indexed_of<TYPE>::type ipq(8);
+	for (unsigned int i = 0; i < 10; ++i)
+		ipq.push(i, (i * 37) % 101);
+	ipq.push(20, 50);
+	std::cout << "size: " << ipq.size() << " / top: " << ipq.top_id() << ": " << ipq.top() << std::endl;
+	ipq.decrease_key(3, 200);
+	std::cout << "decrease_key 3 -> top: " << ipq.top_id() << ": " << ipq.top() << std::endl;
+	ipq.update(3, 1);
+	ipq.update(20, 150);
+	std::cout << "update 3, 20 -> top: " << ipq.top_id() << ": " << ipq.top() << " / key 3: " << ipq.key(3) << std::endl;
+	ipq.erase(20);
+	ipq.erase(20);
+	ipq.erase(0);
+	std::cout << "contains 20: " << ipq.contains(20) << " / contains 5: " << ipq.contains(5) << " / contains 100: " << ipq.contains(100) << std::endl;
+	try {
+		ipq.key(20);
+	} catch (std::out_of_range&) {
+		std::cout << "key 20: out_of_range" << std::endl;
+	}
+	const size_t bad_ids[] = { 5, 4, 99, 20 };
+	for (unsigned int i = 0; i < 4; ++i) {
+		try {
+			if (i == 0)
+				ipq.push(bad_ids[i], 1);
+			else if (i == 1)
+				ipq.decrease_key(bad_ids[i], ipq.key(bad_ids[i]) - 1);
+			else if (i == 2)
+				ipq.decrease_key(bad_ids[i], 1000);
+			else
+				ipq.update(bad_ids[i], 1);
+			std::cout << "id " << bad_ids[i] << ": no exception" << std::endl;
+		} catch (std::invalid_argument&) {
+			std::cout << "id " << bad_ids[i] << ": invalid_argument" << std::endl;
+		}
+	}
+	printIndexed(ipq);
+	ipq.clear();
+	ipq.push(20, 7);
+	printIndexed(ipq);
+}
@@ -0,0 +1,110 @@
+#include "radix_map.hpp"
+#include <iostream>
+#include <string>
+#include <list>
+#include <map>
+
+#ifndef TESTED_NAMESPACE
+#define TESTED_NAMESPACE ft
+#endif
+
+//radix_map은 std에 대응하는 컨테이너가 없으므로 std::map<std::string, T>와 비교한다.
+namespace radix_test
+{
+	namespace ft { template <typename T> struct map_of { typedef ::ft::radix_map<T> type; }; }
+	namespace std { template <typename T> struct map_of { typedef ::std::map< ::std::string, T> type; }; }
+}
+
+#define T2 int
+#define RADIX_MAP radix_test::TESTED_NAMESPACE::map_of<T2>::type
+#define T3 RADIX_MAP::value_type
+
+void printContainers(RADIX_MAP const &mp, bool print_content = true) {
+	std::cout << "size: " << mp.size() << std::endl;
+	if (print_content) {
+		RADIX_MAP::const_iterator it = mp.begin();
+		RADIX_MAP::const_iterator ite = mp.end();
+		std::cout << "Content is:" << std::endl;
+		for (; it != ite; ++it)
+			std::cout << "- key: " << (*it).first << "\t& value: " << it->second << std::endl;
+	}
+	std::cout << "------------------------" << std::endl;
+}
+
+int main() {
+	const char* urls[] = {
+		"/api/v1/users", "/api/v1/users/42", "/api/v1/user", "/api/v2/users", "/api",
+		"/static/css/main.css", "/static/js/app.js", "/static/js/app.js.map", "/", "",
+		"/api/v1/users/42/posts", "/static/css/", "/about", "/api/v1/users"
+	};
+	const unsigned int url_count = sizeof(urls) / sizeof(urls[0]);
+
+	std::cout << "################ Test Radix Map ################" << std::endl;
+	std::cout << "===== default | range | copy constructor =====" << std::endl;
+	RADIX_MAP mp;
+	printContainers(mp);
+
+	std::list<T3> lst;
+	for (unsigned int i = 0; i < url_count; ++i)
+		lst.push_back(T3(urls[i], i));
+	RADIX_MAP mp_range(lst.begin(), lst.end());
+	printContainers(mp_range);
+
+	RADIX_MAP mp_copy(mp_range);
+	printContainers(mp_copy);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== insert | operator[] =====" << std::endl;
+	for (unsigned int i = 0; i < url_count; ++i)
+		std::cout << urls[i] << ": " << (mp.insert(T3(urls[i], i * 10)).second ? "inserted" : "exists") << std::endl;
+	mp["/api/v1/users/42"] = 4242;
+	mp["/api/v1/users/4"] = 4;
+	mp["/static"] += 1;
+	printContainers(mp);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== find | count | lower_bound | upper_bound =====" << std::endl;
+	std::cout << "find /api/v1/users/42: " << mp.find("/api/v1/users/42")->second << std::endl;
+	std::cout << "find /api/v1/use == end: " << ((mp.find("/api/v1/use") == mp.end()) ? "OK" : "KO") << std::endl;
+	std::cout << "count /about: " << mp.count("/about") << std::endl;
+	std::cout << "count /abou: " << mp.count("/abou") << std::endl;
+	const char* bounds[] = { "", "/api/v1/users/", "/api/v1/users/42", "/api/v1/users/5", "/b", "/static/css/main", "~" };
+	for (unsigned int i = 0; i < sizeof(bounds) / sizeof(bounds[0]); ++i) {
+		RADIX_MAP::iterator lb = mp.lower_bound(bounds[i]);
+		RADIX_MAP::iterator ub = mp.upper_bound(bounds[i]);
+		std::cout << "bounds \"" << bounds[i] << "\": "
+			<< (lb == mp.end() ? "end" : lb->first) << ", "
+			<< (ub == mp.end() ? "end" : ub->first) << std::endl;
+	}
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== reverse walk =====" << std::endl;
+	RADIX_MAP::iterator it = mp.end();
+	while (it != mp.begin()) {
+		--it;
+		std::cout << it->first << std::endl;
+	}
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== erase =====" << std::endl;
+	std::cout << "erase /api: " << mp.erase("/api") << std::endl;
+	std::cout << "erase /api: " << mp.erase("/api") << std::endl;
+	std::cout << "erase /api/v1/user: " << mp.erase("/api/v1/user") << std::endl;
+	mp.erase(mp.find("/static/js/app.js"));
+	printContainers(mp);
+	mp.erase(mp.lower_bound("/api/v1/users/"), mp.lower_bound("/b"));
+	printContainers(mp);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== swap | clear | operator== =====" << std::endl;
+	mp.swap(mp_copy);
+	printContainers(mp);
+	printContainers(mp_copy);
+	std::cout << "operator==: " << ((mp == mp_range) ? "OK" : "KO") << std::endl;
+	mp["/new"] = 1;
+	std::cout << "operator!=: " << ((mp != mp_range) ? "OK" : "KO") << std::endl;
+	mp.clear();
+	printContainers(mp);
+	mp["/after/clear"] = 7;
+	printContainers(mp);
+}
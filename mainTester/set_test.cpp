@@ -12,6 +12,76 @@
 #define T3 TESTED_NAMESPACE::set<T1>::value_type
 #define T_SIZE_TYPE typename TESTED_NAMESPACE::set<T1>::size_type
 
+//정렬 방향을 멤버로 가지는 비교 함수 객체. 컨테이너는 생성자로 받은 객체를 그대로 사용해야 한다.
+struct dir_less
+{
+	bool	reverse;
+
+	dir_less(bool r = false) : reverse(r) {}
+	bool operator()(int x, int y) const { return (reverse ? y < x : x < y); }
+};
+
+//ft::set은 빈 비교 함수 객체와 allocator에 공간을 쓰지 않는다. (root, nil, size) std의 크기는 구현마다 다르므로 확인하지 않는다.
+namespace size_test
+{
+	namespace ft { static const bool compact = (sizeof(::ft::set<int>) == 3 * sizeof(void*)); }
+	namespace std { static const bool compact = true; }
+}
+typedef char set_size_check[size_test::TESTED_NAMESPACE::compact ? 1 : -1];
+
+//batch 탐색과 삽입은 ft에만 있으므로 std에서는 key마다 find/insert 한다.
+namespace ext_test
+{
+	namespace ft
+	{
+		template <typename Set, typename Key, typename Iter>
+		void find_batch(Set& st, const Key* keys, size_t n, Iter* out) { st.find_batch(keys, n, out); }
+		template <typename Set, typename Key, typename Iter>
+		void find_sorted_batch(Set& st, const Key* keys, size_t n, Iter* out) { st.find_sorted_batch(keys, n, out); }
+		template <typename Set, typename InputIterator>
+		void insert_sorted_batch(Set& st, InputIterator first, InputIterator last) { st.insert_sorted_batch(first, last); }
+	}
+	namespace std
+	{
+		template <typename Set, typename Key, typename Iter>
+		void find_batch(Set& st, const Key* keys, size_t n, Iter* out)
+		{
+			for (size_t i = 0; i < n; ++i)
+				out[i] = st.find(keys[i]);
+		}
+		template <typename Set, typename Key, typename Iter>
+		void find_sorted_batch(Set& st, const Key* keys, size_t n, Iter* out)
+		{
+			for (size_t i = 0; i < n; ++i)
+				out[i] = st.find(keys[i]);
+		}
+		template <typename Set, typename InputIterator>
+		void insert_sorted_batch(Set& st, InputIterator first, InputIterator last) { st.insert(first, last); }
+	}
+}
+
+template <typename Set>
+void printKeys(Set const &st) {
+	std::cout << "size: " << st.size() << " keys:";
+	for (typename Set::const_iterator it = st.begin(); it != st.end(); ++it)
+		std::cout << " " << *it;
+	std::cout << std::endl;
+}
+
+//batch 탐색 결과를 key마다 출력한다.
+template <typename Set, typename Iter>
+void printBatch(Set &st, const T1* keys, size_t n, Iter* out) {
+	std::cout << "batch:";
+	for (size_t i = 0; i < n; ++i) {
+		std::cout << " " << keys[i] << "->";
+		if (out[i] == st.end())
+			std::cout << "end";
+		else
+			std::cout << *out[i];
+	}
+	std::cout << std::endl;
+}
+
 template <typename T>
 void printContainers(T const &st, bool print_content = true) {
 	const T_SIZE_TYPE size = st.size();
@@ -136,4 +206,84 @@ int main() {
 	std::cout << "operator<=: " << ((lhs <= rhs) ? "OK" : "KO") << std::endl;
 	std::cout << "operator>:  " << ((lhs > rhs) ? "OK" : "KO") << std::endl;
 	std::cout << "operator>=: " << ((lhs >= rhs) ? "OK" : "KO") << std::endl;
-} 
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== stateful comparator =====" << std::endl;
+	TESTED_NAMESPACE::set<T1, dir_less> desc(dir_less(true));
+	for (int i = 0; i < 8; ++i)
+		desc.insert(i * 5 % 11);
+	printKeys(desc);
+	std::cout << "key_comp().reverse: " << desc.key_comp().reverse << std::endl;
+	std::cout << "value_comp()(1, 2): " << desc.value_comp()(1, 2) << std::endl;
+	std::cout << "lower_bound(6): " << *desc.lower_bound(6) << std::endl;
+	std::cout << "upper_bound(6): " << *desc.upper_bound(6) << std::endl;
+	std::cout << "count(3): " << desc.count(3) << std::endl;
+
+	TESTED_NAMESPACE::set<T1, dir_less> desc_copy(desc);
+	desc_copy.insert(20);
+	printKeys(desc_copy);
+
+	TESTED_NAMESPACE::set<T1, dir_less> asc;
+	asc.insert(7);
+	asc = desc;
+	std::cout << "after assign key_comp().reverse: " << asc.key_comp().reverse << std::endl;
+	asc.insert(-1);
+	printKeys(asc);
+
+	TESTED_NAMESPACE::set<T1, dir_less> asc_range(desc.begin(), desc.end(), dir_less(false));
+	printKeys(asc_range);
+	asc_range.swap(desc_copy);
+	std::cout << "after swap key_comp().reverse: " << asc_range.key_comp().reverse << " " << desc_copy.key_comp().reverse << std::endl;
+	asc_range.insert(12);
+	desc_copy.insert(12);
+	printKeys(asc_range);
+	printKeys(desc_copy);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== find_batch | find_sorted_batch | insert_sorted_batch =====" << std::endl;
+	TESTED_NAMESPACE::set<T1> fing;
+	for (int i = 0; i <= 60; i += 3)
+		fing.insert(i);
+	//16개씩 묶어서 찾으므로 묶음보다 짧은 경우, 정확히 한 묶음, 묶음의 배수가 아닌 경우를 확인한다.
+	T1 batch_keys[37];
+	for (int i = 0; i < 37; ++i)
+		batch_keys[i] = (i * 7) % 67 - 3;
+	TESTED_NAMESPACE::set<T1>::iterator batch_out[37];
+	const size_t batch_sizes[] = { 0, 5, 16, 37 };
+	for (size_t i = 0; i < 4; ++i) {
+		ext_test::TESTED_NAMESPACE::find_batch(fing, batch_keys, batch_sizes[i], batch_out);
+		printBatch(fing, batch_keys, batch_sizes[i], batch_out);
+	}
+	const TESTED_NAMESPACE::set<T1>& batch_const = fing;
+	TESTED_NAMESPACE::set<T1>::const_iterator batch_cout[37];
+	ext_test::TESTED_NAMESPACE::find_batch(batch_const, batch_keys + 3, 34, batch_cout);
+	printBatch(batch_const, batch_keys + 3, 34, batch_cout);
+	const T1 sorted_keys[] = { -5, 0, 0, 1, 3, 3, 4, 20, 21, 39, 39, 60, 100 };
+	TESTED_NAMESPACE::set<T1>::iterator fing_out[13];
+	ext_test::TESTED_NAMESPACE::find_sorted_batch(fing, sorted_keys, 13, fing_out);
+	printBatch(fing, sorted_keys, 13, fing_out);
+	//순서가 거꾸로 된 key가 섞여 있어도 find와 같은 결과여야 한다.
+	const T1 unsorted_keys[] = { 30, 3, 27, -1, 12, 12, 0, 100, 6, 61, 59, 57 };
+	ext_test::TESTED_NAMESPACE::find_sorted_batch(fing, unsorted_keys, 12, fing_out);
+	printBatch(fing, unsorted_keys, 12, fing_out);
+	const TESTED_NAMESPACE::set<T1>& fing_const = fing;
+	TESTED_NAMESPACE::set<T1>::const_iterator fing_cout[13];
+	ext_test::TESTED_NAMESPACE::find_sorted_batch(fing_const, sorted_keys + 2, 11, fing_cout);
+	printBatch(fing_const, sorted_keys + 2, 11, fing_cout);
+	ext_test::TESTED_NAMESPACE::find_sorted_batch(fing_const, sorted_keys, 0, fing_cout);
+
+	const T1 insert_keys[] = { -2, 1, 1, 2, 9, 10, 10, 58, 61, 61, 70 };
+	ext_test::TESTED_NAMESPACE::insert_sorted_batch(fing, insert_keys, insert_keys + 11);
+	printKeys(fing);
+	const T1 unsorted_insert[] = { 50, 5, 44, -3, 7, 7, 100, 4, 62, -2, 8, 65, 64 };
+	std::list<T1> unsorted_list(unsorted_insert, unsorted_insert + 13);
+	ext_test::TESTED_NAMESPACE::insert_sorted_batch(fing, unsorted_list.begin(), unsorted_list.end());
+	printKeys(fing);
+	//삽입 후에도 모든 key를 find로 찾을 수 있어야 한다. (tree의 순서가 깨지면 iteration은 맞아도 find가 실패한다.)
+	size_t found = 0;
+	for (TESTED_NAMESPACE::set<T1>::iterator it = fing.begin(); it != fing.end(); ++it)
+		found += (fing.find(*it) == it);
+	std::cout << "find after insert_sorted_batch: " << found << " / " << fing.size() << std::endl;
+	TESTED_NAMESPACE::set<T1> fing_empty;
+	ext_test::TESTED_NAMESPACE::insert_sorted_batch(fing_empty, unsorted_list.begin(), unsorted_list.end());
+	printKeys(fing_empty);
+}
@@ -0,0 +1,248 @@
+#include "soa_vector.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#ifndef TESTED_NAMESPACE
+#define TESTED_NAMESPACE ft
+#endif
+
+//soa_vector는 std에 대응하는 컨테이너가 없으므로 레코드를 통째로 저장하는 std::vector<record>와 비교한다.
+//레코드 접근(row proxy, column<K>())은 ext_test의 함수로 감싸서 두 쪽이 같은 출력을 내게 한다.
+struct record
+{
+	int			id;
+	double		price;
+	std::string	name;
+
+	record(int i = 0, double p = 0, const std::string& n = std::string()) : id(i), price(p), name(n) {}
+};
+
+inline bool operator==(const record& lhs, const record& rhs)
+{
+	return (lhs.id == rhs.id && lhs.price == rhs.price && lhs.name == rhs.name);
+}
+
+namespace ext_test
+{
+	namespace ft
+	{
+		typedef ::ft::soa_vector<int, double, std::string>	table;
+		inline table::value_type make(int id, double price, const ::std::string& name) { return (table::value_type(id, price, name)); }
+		inline int id(const table& t, size_t i) { return (t[i].get<0>()); }
+		inline double price(const table& t, size_t i) { return (t[i].get<1>()); }
+		inline const ::std::string& name(const table& t, size_t i) { return (t[i].get<2>()); }
+		inline void set_price(table& t, size_t i, double p) { t[i].get<1>() = p; }
+		inline void assign_row(table& t, size_t dst, size_t src) { t[dst] = t[src]; }
+		inline void assign_value(table& t, size_t dst, const table::value_type& val) { t[dst] = val; }
+		//row를 value_type으로 복사한 후 읽는다.
+		inline ::std::string loaded_name(const table& t, size_t i) { table::value_type val = t[i]; return (::ft::soa_get<2>::get(val)); }
+		//column은 연속된 배열이어야 하고 모든 column의 크기는 레코드 수와 같아야 한다.
+		inline double price_sum(const table& t)
+		{
+			::ft::soa_span<const double> prices = t.column<1>();
+			if (prices.size() != t.size() || t.column<0>().size() != t.size() || t.column<2>().size() != t.size())
+				return (-1);
+			double sum = 0;
+			for (size_t i = 0; i < prices.size(); ++i)
+			{
+				if (prices.data() + i != &t[i].get<1>())
+					return (-1);
+				sum += prices[i];
+			}
+			return (sum);
+		}
+		inline void scale_prices(table& t, double k)
+		{
+			::ft::soa_span<double> prices = t.column<1>();
+			for (::ft::soa_span<double>::iterator it = prices.begin(); it != prices.end(); ++it)
+				*it *= k;
+		}
+	}
+	namespace std
+	{
+		typedef ::std::vector<record>	table;
+		inline record make(int id, double price, const ::std::string& name) { return (record(id, price, name)); }
+		inline int id(const table& t, size_t i) { return (t[i].id); }
+		inline double price(const table& t, size_t i) { return (t[i].price); }
+		inline const ::std::string& name(const table& t, size_t i) { return (t[i].name); }
+		inline void set_price(table& t, size_t i, double p) { t[i].price = p; }
+		inline void assign_row(table& t, size_t dst, size_t src) { t[dst] = t[src]; }
+		inline void assign_value(table& t, size_t dst, const record& val) { t[dst] = val; }
+		inline ::std::string loaded_name(const table& t, size_t i) { record val = t[i]; return (val.name); }
+		inline double price_sum(const table& t)
+		{
+			double sum = 0;
+			for (size_t i = 0; i < t.size(); ++i)
+				sum += t[i].price;
+			return (sum);
+		}
+		inline void scale_prices(table& t, double k)
+		{
+			for (size_t i = 0; i < t.size(); ++i)
+				t[i].price *= k;
+		}
+	}
+}
+
+#define EXT ext_test::TESTED_NAMESPACE
+#define TABLE EXT::table
+
+void printContainers(const TABLE& t) {
+	std::cout << "size: " << t.size() << " / empty: " << t.empty() << std::endl;
+	std::cout << "Content is:" << std::endl;
+	for (size_t i = 0; i < t.size(); ++i)
+		std::cout << "- " << EXT::id(t, i) << "\t" << EXT::price(t, i) << "\t" << EXT::name(t, i) << std::endl;
+	std::cout << "price sum: " << EXT::price_sum(t) << std::endl;
+	std::cout << "------------------------" << std::endl;
+}
+
+/**
+ * n번째 복사에서 예외를 던지는 column 타입. 끝에 추가하다 실패하면 모든 column이 원래 크기로 돌아와야 한다.
+ * soa_vector에만 해당하는 검사이므로 std 쪽은 같은 결과를 출력만 한다.
+ */
+struct thrower
+{
+	static int	countdown;
+	int			value;
+	thrower(int v = 0) : value(v) {}
+	thrower(const thrower& x) : value(x.value)
+	{
+		if (countdown > 0 && --countdown == 0)
+			throw(std::runtime_error("thrower"));
+	}
+};
+int thrower::countdown = 0;
+
+namespace ext_test
+{
+	namespace ft
+	{
+		typedef ::ft::soa_vector<int, thrower, int>	throw_table;
+
+		inline bool consistent(const throw_table& t, size_t size)
+		{
+			return (t.size() == size && t.column<1>().size() == size && t.column<2>().size() == size);
+		}
+
+		//push_back, 끝 위치의 insert, resize가 실패한 후 크기와 내용이 그대로인지 확인한다.
+		//처음 세 번은 capacity가 가득 찬 상태에서 재할당 중의 복사가 실패하므로 capacity도 그대로여야 한다.
+		//나머지 세 번은 재할당이 끝난 후 column에 추가하다 실패한다.
+		inline const char* rollback()
+		{
+			throw_table t;
+			for (int i = 0; i < 4; ++i)
+				t.push_back(throw_table::value_type(i, thrower(i), i));
+			if (t.capacity() != t.size())
+				return ("KO");
+			const throw_table::value_type val(9, thrower(9), 9);
+			//몇 번째 thrower 복사에서 실패할지. 재할당은 기존 4개를 먼저 복사하고, insert와 resize는 그 후 val을 한 번 복사해둔다.
+			const int copies[] = { 3, 3, 3, 5, 3, 7 };
+			for (int i = 0; i < 6; ++i)
+			{
+				thrower::countdown = copies[i];
+				try
+				{
+					if (i % 3 == 0)
+						t.push_back(val);
+					else if (i % 3 == 1)
+						t.insert(t.end(), 4, val);
+					else
+						t.resize(12, val);
+				}
+				catch (::std::runtime_error&)
+				{
+				}
+				if (thrower::countdown != 0)
+					return ("KO");
+				if (!consistent(t, 4) || (i < 3 && t.capacity() != 4))
+					return ("KO");
+			}
+			for (size_t i = 0; i < t.size(); ++i)
+				if (t[i].get<0>() != static_cast<int>(i) || t[i].get<1>().value != static_cast<int>(i) || t[i].get<2>() != static_cast<int>(i))
+					return ("KO");
+			return ("OK");
+		}
+	}
+	namespace std
+	{
+		inline const char* rollback() { return ("OK"); }
+	}
+}
+
+int main() {
+	const char* names[] = { "apple", "banana", "cherry", "durian", "elder", "fig", "grape", "honeydew" };
+	const size_t name_count = sizeof(names) / sizeof(names[0]);
+
+	std::cout << "################ Test SoA Vector ################" << std::endl;
+	std::cout << "===== push_back | pop_back | at =====" << std::endl;
+	TABLE t;
+	printContainers(t);
+	for (size_t i = 0; i < name_count; ++i)
+		t.push_back(EXT::make(static_cast<int>(i), 1.5 * i, names[i]));
+	printContainers(t);
+	t.pop_back();
+	std::cout << "back after pop_back: " << EXT::name(t, t.size() - 1) << std::endl;
+	try {
+		t.at(t.size());
+		std::cout << "at(size): no exception" << std::endl;
+	} catch (std::out_of_range&) {
+		std::cout << "at(size): out_of_range" << std::endl;
+	}
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== insert =====" << std::endl;
+	t.insert(t.begin(), EXT::make(-1, 0.25, "front"));
+	t.insert(t.begin() + 3, EXT::make(-3, 0.75, "middle"));
+	t.insert(t.end(), EXT::make(-9, 9.5, "back"));
+	printContainers(t);
+	t.insert(t.begin() + 2, 3, EXT::make(7, 7.0, "seven"));
+	t.insert(t.end(), 2, EXT::make(8, 8.0, "eight"));
+	t.insert(t.begin(), 0, EXT::make(0, 0.0, "none"));
+	printContainers(t);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== erase =====" << std::endl;
+	std::cout << "erase returns: " << EXT::id(t, t.erase(t.begin() + 1) - t.begin()) << std::endl;
+	t.erase(t.begin() + 2, t.begin() + 5);
+	t.erase(t.end() - 1);
+	t.erase(t.begin(), t.begin());
+	printContainers(t);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== row assignment | column =====" << std::endl;
+	EXT::assign_row(t, 0, t.size() - 1);
+	EXT::assign_value(t, 1, EXT::make(100, 10.0, "assigned"));
+	EXT::set_price(t, 2, 42.0);
+	//자기 자신에게 대입해도 값이 바뀌지 않는다.
+	EXT::assign_row(t, 3, 3);
+	printContainers(t);
+	EXT::scale_prices(t, 2.0);
+	printContainers(t);
+	std::cout << "loaded row 1: " << EXT::loaded_name(t, 1) << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== resize | copy | swap | clear =====" << std::endl;
+	TABLE copy(t);
+	std::cout << "copy == original: " << ((copy == t) ? "OK" : "KO") << std::endl;
+	t.resize(t.size() + 3, EXT::make(5, 5.5, "resized"));
+	printContainers(t);
+	t.resize(4);
+	printContainers(t);
+	t.resize(6);
+	printContainers(t);
+	std::cout << "copy != resized: " << ((copy != t) ? "OK" : "KO") << std::endl;
+	t.swap(copy);
+	printContainers(t);
+	printContainers(copy);
+	copy.clear();
+	printContainers(copy);
+	for (int i = 0; i < 100; ++i)
+		copy.push_back(EXT::make(i, i * 0.5, names[i % name_count]));
+	std::cout << "size after refill: " << copy.size() << " / price sum: " << EXT::price_sum(copy) << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== exception rollback =====" << std::endl;
+	std::cout << "columns keep the same size: " << EXT::rollback() << std::endl;
+}
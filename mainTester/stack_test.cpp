@@ -1,10 +1,15 @@
 #include "stack.hpp"
+#include "segmented_stack.hpp"
+#include "static_vector.hpp"
 #include <iostream>
 #include <stack>
 #include <string>
 #include <vector>
 #include <deque>
 #include <list>
+#include <stdexcept>
+#include <sstream>
+#include <iterator>
 
 #ifndef TESTED_NAMESPACE
 #define TESTED_NAMESPACE ft
@@ -16,6 +21,8 @@
 // #define UNDERLYING std::deque<TYPE>
 // #define UNDERLYING std::list<TYPE>
 // #define UNDERLYING ft::vector<TYPE>
+#define SEGMENTED ft::segmented_storage<TYPE, std::allocator<TYPE>, 4>
+#define STATIC ft::static_vector<TYPE, 16>
 
 template <typename T>
 void printContainers(TESTED_NAMESPACE::stack<T> st, bool print_content = true) {
@@ -47,6 +54,100 @@ void printContainers(TESTED_NAMESPACE::stack<T, U> st, bool print_content = true
 	std::cout << "------------------------" << std::endl;
 }
 
+/**
+ * n번째 복사에서 예외를 던지는 타입. chunk 경계에서 push가 실패해도 stack은 그대로여야 한다.
+ * std 쪽은 강한 예외 보장을 하는 std::deque를 쓰므로 두 쪽의 출력이 같아야 한다.
+ */
+struct thrower
+{
+	static int	countdown;
+	int			value;
+	thrower(int v = 0) : value(v) {}
+	thrower(const thrower& x) : value(x.value)
+	{
+		if (countdown > 0 && --countdown == 0)
+			throw(std::runtime_error("thrower"));
+	}
+};
+int thrower::countdown = 0;
+
+inline bool operator==(const thrower& lhs, const thrower& rhs) { return (lhs.value == rhs.value); }
+inline bool operator<(const thrower& lhs, const thrower& rhs) { return (lhs.value < rhs.value); }
+
+namespace stack_test
+{
+	namespace ft { struct throw_container { typedef ::ft::segmented_storage<thrower, std::allocator<thrower>, 4> type; }; }
+	namespace std { struct throw_container { typedef ::std::deque<thrower> type; }; }
+}
+
+#define THROW_CONTAINER stack_test::TESTED_NAMESPACE::throw_container::type
+
+/**
+ * static_vector를 std::vector와 직접 비교한다. (std::string 원소)
+ * capacity를 넘기는 삽입은 static_vector에만 있는 동작이므로 ft 쪽만 확인하고 std 쪽은 같은 결과를 출력만 한다.
+ */
+namespace static_test
+{
+	namespace ft
+	{
+		typedef ::ft::static_vector< ::std::string, 16>	vector_type;
+
+		//넘치는 삽입마다 length_error를 던지고 내용이 그대로인지 확인한다.
+		inline const char* overflow(vector_type& v)
+		{
+			const vector_type before(v);
+			const ::std::string words[] = { "x", "y", "z", "w", "v", "u", "t", "s", "r", "q", "p", "o", "n", "m", "l", "k", "j" };
+			const size_t room = v.capacity() - v.size();
+			for (int i = 0; i < 5; ++i)
+			{
+				try
+				{
+					if (i == 0)
+						v.insert(v.begin() + 1, room + 1, "overflow");
+					else if (i == 1)
+						v.insert(v.begin() + 1, words, words + room + 1);
+					else if (i == 2)
+					{
+						::std::istringstream in("a b c d e f g h i j k l m n o p q");
+						v.insert(v.begin() + 1, ::std::istream_iterator< ::std::string>(in), ::std::istream_iterator< ::std::string>());
+					}
+					else if (i == 3)
+						v.assign(17, "overflow");
+					else
+					{
+						v.insert(v.end(), room, "fill");
+						v.push_back("overflow");
+					}
+					return ("no exception");
+				}
+				catch (::std::length_error&)
+				{
+				}
+				if (i == 4)
+					v.erase(v.end() - room, v.end());
+				if (v != before)
+					return ("KO");
+			}
+			return ("OK");
+		}
+	}
+	namespace std
+	{
+		typedef ::std::vector< ::std::string>	vector_type;
+
+		inline const char* overflow(vector_type&) { return ("OK"); }
+	}
+}
+
+#define STATIC_STRINGS static_test::TESTED_NAMESPACE::vector_type
+
+void printStrings(const STATIC_STRINGS& v) {
+	std::cout << "size: " << v.size() << " /";
+	for (STATIC_STRINGS::const_iterator it = v.begin(); it != v.end(); ++it)
+		std::cout << " " << *it;
+	std::cout << std::endl;
+}
+
 int main() {
 	std::cout << "################ Test Stack ################" << std::endl;
 	std::cout << "===== push | copy =====" << std::endl;
@@ -141,4 +242,127 @@ int main() {
 
 	std::cout << "operator >=" << std::endl;
 	std::cout << ((lhs >= rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "\n################################################" << std::endl;
+
+	std::cout << "  == segmented container (chunk size 4) ==" << std::endl;
+	TESTED_NAMESPACE::stack<TYPE, SEGMENTED> st_seg;
+	for (int i = 0; i < 10; ++i)
+		st_seg.push(i * 2);
+	printContainers<TYPE, SEGMENTED>(st_seg);
+
+	std::cout << "pop across chunk boundary" << std::endl;
+	for (int i = 0; i < 3; ++i)
+		st_seg.pop();
+	std::cout << "top: " << st_seg.top() << std::endl;
+	for (int i = 0; i < 5; ++i)
+		st_seg.push(i + 100);
+	std::cout << "top: " << st_seg.top() << " / size: " << st_seg.size() << std::endl;
+	printContainers<TYPE, SEGMENTED>(st_seg);
+
+	TESTED_NAMESPACE::stack<TYPE, SEGMENTED> seg_lhs(st_seg);
+	TESTED_NAMESPACE::stack<TYPE, SEGMENTED> seg_rhs(st_seg);
+	std::cout << "operator ==: " << ((seg_lhs == seg_rhs) ? "OK" : "KO") << std::endl;
+	seg_rhs.pop();
+	seg_rhs.push(1000);
+	std::cout << "operator !=: " << ((seg_lhs != seg_rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator <:  " << ((seg_lhs < seg_rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator >=: " << ((seg_lhs >= seg_rhs) ? "OK" : "KO") << std::endl;
+
+	while (!seg_lhs.empty())
+		seg_lhs.pop();
+	std::cout << "Is empty: " << (seg_lhs.empty() ? "OK" : "KO") << std::endl;
+
+	std::cout << "push throws at chunk boundary" << std::endl;
+	TESTED_NAMESPACE::stack<thrower, THROW_CONTAINER> st_throw;
+	for (int i = 0; i < 4; ++i)
+		st_throw.push(thrower(i));
+	for (int i = 0; i < 2; ++i) {
+		thrower::countdown = 1;
+		try {
+			st_throw.push(thrower(9));
+			std::cout << "push: no exception" << std::endl;
+		} catch (std::runtime_error&) {
+			std::cout << "push: runtime_error" << std::endl;
+		}
+		thrower::countdown = 0;
+		std::cout << "top: " << st_throw.top().value << " / size: " << st_throw.size() << std::endl;
+	}
+	st_throw.push(thrower(4));
+	st_throw.push(thrower(5));
+	std::cout << "top: " << st_throw.top().value << " / size: " << st_throw.size() << std::endl;
+	std::cout << "pop:";
+	while (!st_throw.empty()) {
+		std::cout << " " << st_throw.top().value;
+		st_throw.pop();
+	}
+	std::cout << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "  == static container (capacity 16) ==" << std::endl;
+	TESTED_NAMESPACE::stack<TYPE, STATIC> st_static;
+	for (int i = 0; i < 16; ++i)
+		st_static.push(i * 3);
+	printContainers<TYPE, STATIC>(st_static);
+	try {
+		st_static.push(100);
+	} catch (std::length_error&) {
+		std::cout << "push on full stack: length_error" << std::endl;
+	}
+	std::cout << "top: " << st_static.top() << " / size: " << st_static.size() << std::endl;
+
+	TESTED_NAMESPACE::stack<TYPE, STATIC> static_lhs(st_static);
+	TESTED_NAMESPACE::stack<TYPE, STATIC> static_rhs;
+	static_rhs = st_static;
+	std::cout << "operator ==: " << ((static_lhs == static_rhs) ? "OK" : "KO") << std::endl;
+	static_rhs.pop();
+	static_rhs.push(1000);
+	std::cout << "operator !=: " << ((static_lhs != static_rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator <:  " << ((static_lhs < static_rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator >=: " << ((static_lhs >= static_rhs) ? "OK" : "KO") << std::endl;
+	while (!static_lhs.empty())
+		static_lhs.pop();
+	std::cout << "Is empty: " << (static_lhs.empty() ? "OK" : "KO") << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "  == static_vector<std::string, 16> ==" << std::endl;
+	STATIC_STRINGS sv;
+	for (int i = 0; i < 6; ++i)
+		sv.push_back(std::string(i + 1, 'a' + i));
+	printStrings(sv);
+	//뒤에 남는 원소가 넣는 수보다 많은 경우와 적은 경우
+	sv.insert(sv.begin() + 2, 3, "mid");
+	printStrings(sv);
+	sv.insert(sv.end() - 1, 4, "tail");
+	printStrings(sv);
+	std::cout << "insert returns: " << *sv.insert(sv.begin(), "front") << std::endl;
+	sv.erase(sv.begin() + 3, sv.begin() + 10);
+	std::cout << "erase returns: " << *sv.erase(sv.begin() + 1) << std::endl;
+	printStrings(sv);
+	//input iterator는 끝에 넣은 후 rotate 한다.
+	std::istringstream words("in put it er at or");
+	sv.insert(sv.begin() + 2, std::istream_iterator<std::string>(words), std::istream_iterator<std::string>());
+	printStrings(sv);
+	std::list<std::string> fwd;
+	fwd.push_back("fw1");
+	fwd.push_back("fw2");
+	sv.insert(sv.begin() + 5, fwd.begin(), fwd.end());
+	printStrings(sv);
+	sv.resize(sv.size() + 1, "grown");
+	printStrings(sv);
+	sv.resize(4);
+	printStrings(sv);
+	sv.resize(6);
+	printStrings(sv);
+	STATIC_STRINGS sv_other(3, "other");
+	sv.swap(sv_other);
+	printStrings(sv);
+	printStrings(sv_other);
+	sv.assign(5, "same");
+	printStrings(sv);
+	sv.assign(fwd.begin(), fwd.end());
+	printStrings(sv);
+	sv = sv_other;
+	std::cout << "operator ==: " << ((sv == sv_other) ? "OK" : "KO") << std::endl;
+	std::cout << "overflow leaves contents unchanged: " << static_test::TESTED_NAMESPACE::overflow(sv) << std::endl;
+	printStrings(sv);
 }
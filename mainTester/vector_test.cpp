@@ -2,6 +2,9 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include <list>
+#include <sstream>
+#include <iterator>
 
 #ifndef TESTED_NAMESPACE
 #define TESTED_NAMESPACE ft
@@ -28,6 +31,116 @@ void printContainers(TESTED_NAMESPACE::vector<T> const &vec, bool print_content
 	std::cout << "------------------------" << std::endl;
 }
 
+//ft::vector<bool>에만 있는 word 단위 연산과 ft::vector에만 있는 erase 함수들. std에서는 같은 결과를 원소마다 계산한다.
+namespace ext_test
+{
+	namespace ft
+	{
+		template <typename Vec, typename Pred> size_t erase_if(Vec& v, Pred pred) { return (::ft::erase_if(v, pred)); }
+		template <typename Vec> typename Vec::iterator unordered_erase(Vec& v, typename Vec::iterator pos) { return (v.unordered_erase(pos)); }
+		template <typename Vec, typename It> size_t erase_indices(Vec& v, It first, It last) { return (v.erase_indices(first, last)); }
+		template <typename Bits> size_t count(const Bits& v) { return (v.count()); }
+		template <typename Bits> size_t find_first(const Bits& v) { return (v.find_first()); }
+		template <typename Bits> size_t find_next(const Bits& v, size_t pos) { return (v.find_next(pos)); }
+		template <typename Bits> size_t rank(const Bits& v, size_t pos) { return (v.rank(pos)); }
+		template <typename Bits> void bit_and(Bits& v, const Bits& x) { v &= x; }
+		template <typename Bits> void bit_xor(Bits& v, const Bits& x) { v ^= x; }
+		//streaming store를 쓰기 시작할 byte 수를 바꾸고 이전 값을 돌려준다.
+		inline size_t stream_threshold(size_t n)
+		{
+			size_t prev = ::ft::stream_settings().threshold;
+			::ft::stream_settings().threshold = n;
+			return (prev);
+		}
+	}
+	namespace std
+	{
+		template <typename Vec, typename Pred> size_t erase_if(Vec& v, Pred pred)
+		{
+			size_t n = v.size();
+			for (typename Vec::iterator it = v.begin(); it != v.end(); )
+			{
+				if (pred(*it))
+					it = v.erase(it);
+				else
+					++it;
+			}
+			return (n - v.size());
+		}
+		template <typename Vec> typename Vec::iterator unordered_erase(Vec& v, typename Vec::iterator pos)
+		{
+			size_t n = pos - v.begin();
+			*pos = v.back();
+			v.pop_back();
+			return (v.begin() + n);
+		}
+		template <typename Vec, typename It> size_t erase_indices(Vec& v, It first, It last)
+		{
+			size_t n = 0;
+			while (first != last)
+			{
+				v.erase(v.begin() + *--last);
+				++n;
+			}
+			return (n);
+		}
+		template <typename Bits> size_t rank(const Bits& v, size_t pos)
+		{
+			size_t n = 0;
+			for (size_t i = 0; i < pos; ++i)
+				n += v[i];
+			return (n);
+		}
+		template <typename Bits> size_t count(const Bits& v) { return (rank(v, v.size())); }
+		template <typename Bits> size_t find_next(const Bits& v, size_t pos)
+		{
+			for (size_t i = pos + 1; i < v.size(); ++i)
+				if (v[i])
+					return (i);
+			return (static_cast<size_t>(-1));
+		}
+		template <typename Bits> size_t find_first(const Bits& v) { return (v.size() && v[0]) ? 0 : find_next(v, 0); }
+		template <typename Bits> void bit_and(Bits& v, const Bits& x)
+		{
+			for (size_t i = 0; i < v.size(); ++i)
+				v[i] = v[i] && x[i];
+		}
+		template <typename Bits> void bit_xor(Bits& v, const Bits& x)
+		{
+			for (size_t i = 0; i < v.size(); ++i)
+				v[i] = v[i] != x[i];
+		}
+		inline size_t stream_threshold(size_t n) { return (n); }
+	}
+}
+
+//sizeof가 3인 trivially copyable 타입. 원소 경계가 16 byte 정렬과 어긋나게 한다.
+struct rgb
+{
+	unsigned char r, g, b;
+};
+
+//원소의 위치와 값을 모두 반영하는 checksum
+template <typename Vec>
+unsigned long rgbSum(Vec const &v) {
+	unsigned long sum = v.size();
+	for (size_t i = 0; i < v.size(); ++i)
+		sum = sum * 31 + v[i].r + v[i].g * 7 + v[i].b * 13;
+	return (sum);
+}
+
+bool is_odd(int x) { return (x % 2 != 0); }
+bool is_long(const std::string& s) { return (s.size() > 3); }
+bool is_set(bool b) { return (b); }
+
+template <typename Bits>
+void printBits(Bits const &v) {
+	std::cout << "size: " << v.size() << " bits: ";
+	for (typename Bits::const_iterator it = v.begin(); it != v.end(); ++it)
+		std::cout << *it;
+	std::cout << std::endl;
+}
+
 int main() {
 	std::cout << "################ Test Vector ################" << std::endl;
 
@@ -221,6 +334,50 @@ int main() {
 	std::cout << "after clear: " << std::endl;
 	printContainers(v_clear);
 
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== range from list | istream_iterator =====" << std::endl;
+	std::list<TYPE> lst;
+	for (int i = 0; i < 6; ++i)
+		lst.push_back(i * 7);
+	TESTED_NAMESPACE::vector<TYPE> v_list(lst.begin(), lst.end());
+	printContainers(v_list);
+	v_list.insert(v_list.begin() + 2, lst.begin(), lst.end());
+	printContainers(v_list);
+	v_list.assign(++lst.begin(), lst.end());
+	printContainers(v_list);
+
+	std::istringstream in("4 8 15 16 23 42");
+	TESTED_NAMESPACE::vector<TYPE> v_stream((std::istream_iterator<TYPE>(in)), std::istream_iterator<TYPE>());
+	printContainers(v_stream);
+	std::istringstream in_insert("100 200 300");
+	v_stream.insert(v_stream.begin() + 1, std::istream_iterator<TYPE>(in_insert), std::istream_iterator<TYPE>());
+	printContainers(v_stream);
+	std::istringstream in_assign("1 2");
+	v_stream.assign(std::istream_iterator<TYPE>(in_assign), std::istream_iterator<TYPE>());
+	printContainers(v_stream);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== range insert | assign (pointer | string) =====" << std::endl;
+	const TYPE arr[] = { 3, 1, 4, 1, 5, 9, 2, 6 };
+	TESTED_NAMESPACE::vector<TYPE> v_arr(arr, arr + 4);
+	v_arr.reserve(32);
+	v_arr.insert(v_arr.begin() + 1, arr, arr + 8);
+	v_arr.insert(v_arr.end(), v_list.begin(), v_list.end());
+	v_arr.insert(v_arr.begin(), arr + 2, arr + 2);
+	printContainers(v_arr);
+	v_arr.assign(arr + 1, arr + 6);
+	printContainers(v_arr);
+
+	//capacity 안에서 삽입할 때 뒤로 밀리는 원소가 삽입하는 원소보다 많은 경우와 적은 경우
+	std::string words[] = { "zero", "one", "two", "three", "four", "five" };
+	TESTED_NAMESPACE::vector<std::string> v_str(words, words + 6);
+	v_str.reserve(20);
+	v_str.insert(v_str.begin() + 1, words + 4, words + 6);
+	v_str.insert(v_str.end() - 1, words, words + 3);
+	printContainers(v_str);
+	v_str.assign(words + 2, words + 5);
+	printContainers(v_str);
+
 	std::cout << "\n################################################" << std::endl;
 	std::cout << "===== relational operators =====" << std::endl;
 	TESTED_NAMESPACE::vector<TYPE> v_lhs(5);
@@ -249,4 +406,118 @@ int main() {
 	std::cout << "operator<=: " << ((v_lhs <= v_rhs) ? "OK" : "KO") << std::endl;
 	std::cout << "operator>:  " << ((v_lhs > v_rhs) ? "OK" : "KO") << std::endl;
 	std::cout << "operator>=: " << ((v_lhs >= v_rhs) ? "OK" : "KO") << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== vector<bool> =====" << std::endl;
+	TESTED_NAMESPACE::vector<bool> bits(70, false);
+	for (size_t i = 0; i < bits.size(); i += 3)
+		bits[i] = true;
+	bits.push_back(true);
+	bits.insert(bits.begin() + 5, 4, true);
+	bits.erase(bits.begin() + 60, bits.begin() + 66);
+	bits[1].flip();
+	bits.at(2) = bits[1];
+	printBits(bits);
+	TESTED_NAMESPACE::vector<bool> bits_rev(bits.rbegin(), bits.rend());
+	printBits(bits_rev);
+	bits.flip();
+	bits.resize(130, true);
+	bits.pop_back();
+	printBits(bits);
+	std::cout << "front: " << bits.front() << " back: " << bits.back() << std::endl;
+	std::cout << "count: " << ext_test::TESTED_NAMESPACE::count(bits) << std::endl;
+	std::cout << "rank(100): " << ext_test::TESTED_NAMESPACE::rank(bits, 100) << std::endl;
+	std::cout << "set bits:";
+	for (size_t i = ext_test::TESTED_NAMESPACE::find_first(bits); i != static_cast<size_t>(-1); i = ext_test::TESTED_NAMESPACE::find_next(bits, i))
+		if (i < 70)
+			std::cout << " " << i;
+	std::cout << std::endl;
+	TESTED_NAMESPACE::vector<bool> mask(bits.size(), true);
+	for (size_t i = 0; i < mask.size(); i += 2)
+		mask[i] = false;
+	ext_test::TESTED_NAMESPACE::bit_and(bits, mask);
+	printBits(bits);
+	ext_test::TESTED_NAMESPACE::bit_xor(bits, mask);
+	printBits(bits);
+	TESTED_NAMESPACE::vector<bool> bits_copy(bits);
+	std::cout << "operator==: " << ((bits_copy == bits) ? "OK" : "KO") << std::endl;
+	bits_copy.back() = !bits_copy.back();
+	std::cout << "operator<:  " << ((bits_copy < bits) ? "OK" : "KO") << std::endl;
+	try {
+		bits.at(bits.size());
+	} catch (std::out_of_range&) {
+		std::cout << "at: out_of_range" << std::endl;
+	}
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== erase_if =====" << std::endl;
+	TESTED_NAMESPACE::vector<TYPE> v_remove;
+	for (int i = 0; i < 20; ++i)
+		v_remove.push_back(i * 7 % 13);
+	std::cout << "removed: " << ext_test::TESTED_NAMESPACE::erase_if(v_remove, is_odd) << std::endl;
+	printContainers(v_remove);
+	std::cout << "removed: " << ext_test::TESTED_NAMESPACE::erase_if(v_remove, is_odd) << std::endl;
+	TESTED_NAMESPACE::vector<std::string> v_words;
+	for (int i = 0; i < 12; ++i)
+		v_words.push_back(std::string(i % 6 + 1, 'a' + i));
+	v_words.erase(v_words.begin() + 2, v_words.begin() + 4);
+	v_words.erase(v_words.begin());
+	std::cout << "removed: " << ext_test::TESTED_NAMESPACE::erase_if(v_words, is_long) << std::endl;
+	printContainers(v_words);
+	std::cout << "removed: " << ext_test::TESTED_NAMESPACE::erase_if(bits, is_set) << std::endl;
+	printBits(bits);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== unordered_erase | erase_indices =====" << std::endl;
+	TESTED_NAMESPACE::vector<TYPE> v_bag;
+	for (int i = 0; i < 10; ++i)
+		v_bag.push_back(i * 11);
+	std::cout << "unordered_erase: " << *ext_test::TESTED_NAMESPACE::unordered_erase(v_bag, v_bag.begin() + 2) << std::endl;
+	ext_test::TESTED_NAMESPACE::unordered_erase(v_bag, v_bag.begin());
+	TESTED_NAMESPACE::vector<TYPE>::iterator bag_it = ext_test::TESTED_NAMESPACE::unordered_erase(v_bag, v_bag.end() - 1);
+	std::cout << "unordered_erase last: " << (bag_it == v_bag.end() ? "end" : "KO") << std::endl;
+	printContainers(v_bag);
+	const int indices[] = { 0, 3, 4, 6 };
+	std::cout << "erase_indices: " << ext_test::TESTED_NAMESPACE::erase_indices(v_bag, indices, indices + 4) << std::endl;
+	printContainers(v_bag);
+	TESTED_NAMESPACE::vector<std::string> v_names;
+	for (int i = 0; i < 8; ++i)
+		v_names.push_back(std::string(i + 1, 'a' + i));
+	ext_test::TESTED_NAMESPACE::unordered_erase(v_names, v_names.begin() + 1);
+	std::cout << "erase_indices: " << ext_test::TESTED_NAMESPACE::erase_indices(v_names, indices + 1, indices + 4) << std::endl;
+	printContainers(v_names);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== streaming store (lowered threshold) =====" << std::endl;
+	//threshold를 16 byte보다 작게 두어 정렬되지 않은 앞부분과 짧은 뒷부분만 있는 복사/채우기를 확인한다.
+	rgb pixels[80];
+	for (int i = 0; i < 80; ++i) {
+		pixels[i].r = static_cast<unsigned char>(i);
+		pixels[i].g = static_cast<unsigned char>(i * 3 + 1);
+		pixels[i].b = static_cast<unsigned char>(255 - i);
+	}
+	const size_t thresholds[] = { 0, 1, 7, 15, 33 };
+	const size_t prev_threshold = ext_test::TESTED_NAMESPACE::stream_threshold(0);
+	for (size_t t = 0; t < sizeof(thresholds) / sizeof(thresholds[0]); ++t) {
+		ext_test::TESTED_NAMESPACE::stream_threshold(thresholds[t]);
+		unsigned long fill_sum = 0, range_sum = 0, insert_sum = 0, assign_sum = 0;
+		for (size_t n = 0; n < 24; ++n) {
+			TESTED_NAMESPACE::vector<rgb> v_fill(n, pixels[n]);
+			//원본의 시작을 한 원소씩 옮겨 source도 정렬되지 않게 한다.
+			TESTED_NAMESPACE::vector<rgb> v_range(pixels + n % 5, pixels + n % 5 + n);
+			TESTED_NAMESPACE::vector<rgb> v_copy(v_range);
+			//재할당하면서 중간(3 * n / 2 byte 위치)에 복사하므로 대상 주소가 정렬되지 않는다.
+			v_copy.insert(v_copy.begin() + n / 2, pixels + 1, pixels + 1 + n);
+			v_fill.assign(pixels + 7, pixels + 7 + 2 * n + 1);
+			fill_sum = fill_sum * 17 + rgbSum(TESTED_NAMESPACE::vector<rgb>(n, pixels[n]));
+			range_sum = range_sum * 17 + rgbSum(v_range);
+			insert_sum = insert_sum * 17 + rgbSum(v_copy);
+			assign_sum = assign_sum * 17 + rgbSum(v_fill);
+		}
+		std::cout << "threshold " << thresholds[t] << ": fill " << fill_sum << " / range " << range_sum
+			<< " / insert " << insert_sum << " / assign " << assign_sum << std::endl;
+	}
+	ext_test::TESTED_NAMESPACE::stream_threshold(prev_threshold);
+	TESTED_NAMESPACE::vector<rgb> v_restored(pixels, pixels + 80);
+	std::cout << "after restore: " << rgbSum(v_restored) << std::endl;
 }